@@ -6,7 +6,7 @@ auxsources= [ 'src/window_api.h', 'src/window_errors.h', 'src/window_shared.c' ]
 extrabuilddirs = [ 'doc' ]
 auxfiles = [ 'doc/doxygen.conf', 'doc/DoxygenLayout.xml', 'doc/main_doc.h', 'doc/examples/*' ]
 
-versioninfo = '0:0:0'
+versioninfo = '1:0:1'
 
 
 def get_replacements(mkdist):
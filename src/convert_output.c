@@ -19,7 +19,6 @@
 #include <stdlib.h>
 #include <string.h>
 #include <transcript/transcript.h>
-#include <unictype.h>
 #include <uninorm.h>
 
 #include "convert_output.h"
@@ -30,13 +29,17 @@
 #include "window.h"
 
 #define CONV_BUFFER_LEN (160)
+/** The initial size of the output buffer. */
+#define OUTPUT_BUFFER_START_SIZE 160
+/** The maximum factor by which conversion of UTF-8 text to Normalization Form C expands it. */
+#define NFC_MAX_EXPANSION 3
 
 static char *output_buffer;
 static size_t output_buffer_size, output_buffer_idx;
 static transcript_t *output_converter = NULL;
 
-static char *nfc_output;
-static size_t nfc_output_size;
+static char *can_draw_buffer;
+static size_t can_draw_buffer_size;
 static uint32_t replacement_char = '?';
 static char replacement_char_str[16] = "?";
 static size_t replacement_char_length = 1;
@@ -51,8 +54,8 @@ t3_bool _t3_init_output_buffer(void) {
   if (output_buffer != NULL) {
     return t3_true;
   }
-  output_buffer_size = 160;
-  return (output_buffer = malloc(output_buffer_size)) != NULL;
+  output_buffer_size = OUTPUT_BUFFER_START_SIZE;
+  return (output_buffer = _t3_malloc(output_buffer_size)) != NULL;
 }
 
 /** @internal
@@ -60,20 +63,68 @@ t3_bool _t3_init_output_buffer(void) {
 */
 void _t3_free_output_buffer(void) {
   if (output_buffer != NULL) {
-    free(output_buffer);
+    _t3_free(output_buffer);
     output_buffer = NULL;
   }
   if (output_converter != NULL) {
     transcript_close_converter(output_converter);
     output_converter = NULL;
   }
-  if (nfc_output != NULL) {
-    free(nfc_output);
-    nfc_output_size = 0;
-    nfc_output = NULL;
+  if (can_draw_buffer != NULL) {
+    _t3_free(can_draw_buffer);
+    can_draw_buffer_size = 0;
+    can_draw_buffer = NULL;
   }
 }
 
+/** @internal
+    @brief Add the memory used by the output buffers to a t3_memory_usage_t. */
+void _t3_output_memory_usage(t3_memory_usage_t *usage) {
+  usage->allocated += output_buffer_size + can_draw_buffer_size;
+  usage->used += output_buffer_idx;
+}
+
+/** @internal
+    @brief Shrink the output buffers to their initial size. */
+void _t3_output_compact(void) {
+  char *resized;
+
+  if (output_buffer != NULL && output_buffer_size > OUTPUT_BUFFER_START_SIZE &&
+      output_buffer_idx <= OUTPUT_BUFFER_START_SIZE &&
+      (resized = _t3_realloc(output_buffer, OUTPUT_BUFFER_START_SIZE)) != NULL) {
+    output_buffer = resized;
+    output_buffer_size = OUTPUT_BUFFER_START_SIZE;
+  }
+  _t3_free(can_draw_buffer);
+  can_draw_buffer = NULL;
+  can_draw_buffer_size = 0;
+}
+
+/** @internal
+    @brief Convert a UTF-8 string to Normalization Form C.
+    @param str The string to convert.
+    @param n The length of @p str.
+    @param buffer The buffer to store the result in, which must hold at least
+        ::NFC_MAX_EXPANSION * @p n bytes.
+    @param length The location to store the length of the result.
+    @return Either @p buffer, or @p str if the string could not be converted.
+
+    As @p buffer is large enough for any result, libunistring never allocates memory itself.
+*/
+static const char *normalize(const char *str, size_t n, char *buffer, size_t *length) {
+  uint8_t *result;
+
+  *length = NFC_MAX_EXPANSION * n;
+  result = u8_normalize(UNINORM_NFC, (const uint8_t *)str, n, (uint8_t *)buffer, length);
+  if (result == (uint8_t *)buffer) {
+    return buffer;
+  }
+  /* Memory allocated by libunistring must be released using the C library. */
+  free(result);
+  *length = n;
+  return str;
+}
+
 /** @internal
     @brief Initialize the characterset conversion used for output.
     @param encodig The encoding to convert to.
@@ -117,7 +168,7 @@ t3_bool t3_term_putc(char c) {
     if ((SIZE_MAX >> 1) > output_buffer_size) {
       output_buffer_size <<= 1;
     }
-    retval = realloc(output_buffer, output_buffer_size);
+    retval = _t3_realloc(output_buffer, output_buffer_size);
     if (retval == NULL) {
       return t3_false;
     }
@@ -166,19 +217,21 @@ t3_bool t3_term_putn(const char *s, size_t n) {
     @brief Print the characters in the output buffer.
 */
 void _t3_output_buffer_print(void) {
-  char *tmp_nfc_output;
+  const char *nfc_output;
+  char *nfc_buffer;
   size_t nfc_output_len;
   if (output_buffer_idx == 0) {
     return;
   }
 
-  nfc_output_len = nfc_output_size;
-  tmp_nfc_output = (char *)u8_normalize(UNINORM_NFC, (const uint8_t *)output_buffer,
-                                        output_buffer_idx, (uint8_t *)nfc_output, &nfc_output_len);
-  if (tmp_nfc_output != nfc_output) {
-    free(nfc_output);
-    nfc_output = tmp_nfc_output;
-    nfc_output_size = nfc_output_len;
+  /* The normalized text is only needed until it is written, so it is allocated from the frame
+     arena and released again at the end of this function. If no memory is available, the text
+     is written as is. */
+  if ((nfc_buffer = _t3_arena_alloc(NFC_MAX_EXPANSION * output_buffer_idx)) != NULL) {
+    nfc_output = normalize(output_buffer, output_buffer_idx, nfc_buffer, &nfc_output_len);
+  } else {
+    nfc_output = output_buffer;
+    nfc_output_len = output_buffer_idx;
   }
 
   // FIXME: for GB18030 we should also take the first option. However, it does need conversion...
@@ -187,6 +240,7 @@ void _t3_output_buffer_print(void) {
     size_t idx, codepoint_len, output_start;
     uint32_t c;
     uint_fast8_t available_since;
+    unsigned chardata;
     /* Filter out combining characters if the terminal is known not to support them (e.g.
        gnome-terminal).
        If the character is accepted, then don't do anything. If the character has to be filtered
@@ -198,18 +252,18 @@ void _t3_output_buffer_print(void) {
     for (idx = 0, output_start = 0; idx < nfc_output_len; idx += codepoint_len) {
       codepoint_len = nfc_output_len - idx;
       c = t3_utf8_get(nfc_output + idx, &codepoint_len);
-      available_since = get_chardata(c) & 0x3f;
+      chardata = get_chardata(c);
+      available_since = T3_CHARDATA_VERSION(chardata);
 
-      if (_t3_term_combining < available_since &&
-          uc_is_general_category_withtable(c, UC_CATEGORY_MASK_M)) {
+      if (_t3_term_combining < available_since && (chardata & T3_CHARDATA_MARK)) {
         fwrite(nfc_output + output_start, 1, idx - output_start, _t3_putp_file);
         /* For non-zero width combining characters, print a replacement character. */
-        if (t3_utf8_wcwidth(c) == 1) {
+        if (T3_CHARDATA_WIDTH(chardata) == 1) {
           print_replacement_character();
         }
         output_start = idx + codepoint_len;
       }
-      if (_t3_term_double_width < available_since && t3_utf8_wcwidth(c) == 2) {
+      if (_t3_term_double_width < available_since && T3_CHARDATA_WIDTH(chardata) == 2) {
         if (_t3_term_double_width < 0) {
           fwrite(nfc_output + output_start, 1, idx - output_start, _t3_putp_file);
           print_replacement_character();
@@ -289,6 +343,9 @@ void _t3_output_buffer_print(void) {
       fwrite(conversion_output, 1, conversion_output_ptr - conversion_output, _t3_putp_file);
     }
   }
+  if (nfc_buffer != NULL) {
+    _t3_arena_release(nfc_buffer);
+  }
   output_buffer_idx = 0;
 }
 
@@ -310,26 +367,28 @@ void _t3_output_buffer_print(void) {
     screen.
 */
 t3_bool t3_term_can_draw(const char *str, size_t str_len) {
-  size_t nfc_output_len;
-
-  if (str_len > 1 || nfc_output == NULL) {
-    char *tmp_nfc_output;
-    nfc_output_len = nfc_output_size;
-    tmp_nfc_output = (char *)u8_normalize(UNINORM_NFC, (const uint8_t *)str, str_len,
-                                          (uint8_t *)nfc_output, &nfc_output_len);
-    if (tmp_nfc_output != nfc_output) {
-      free(nfc_output);
-      nfc_output = tmp_nfc_output;
-      nfc_output_size = nfc_output_len;
+  const char *nfc_output = str;
+  size_t nfc_output_len = str_len;
+
+  /* This function may be called at any time, so a persistent buffer is used instead of the frame
+     arena. A single byte is always in Normalization Form C. */
+  if (str_len > 1) {
+    if (can_draw_buffer_size < NFC_MAX_EXPANSION * str_len) {
+      char *new_buffer;
+      if ((new_buffer = _t3_realloc(can_draw_buffer, NFC_MAX_EXPANSION * str_len)) != NULL) {
+        can_draw_buffer = new_buffer;
+        can_draw_buffer_size = NFC_MAX_EXPANSION * str_len;
+      }
+    }
+    if (can_draw_buffer_size >= NFC_MAX_EXPANSION * str_len) {
+      nfc_output = normalize(str, str_len, can_draw_buffer, &nfc_output_len);
     }
-  } else {
-    nfc_output[0] = *str;
-    nfc_output_len = 1;
   }
 
   if (output_converter == NULL) {
     size_t idx, codepoint_len;
     uint_fast8_t available_since;
+    unsigned chardata;
     uint32_t c;
 
     /* FIXME: should we filter out control characters, like in t3_win_addnstr? */
@@ -340,13 +399,13 @@ t3_bool t3_term_can_draw(const char *str, size_t str_len) {
     for (idx = 0; idx < nfc_output_len; idx += codepoint_len) {
       codepoint_len = nfc_output_len - idx;
       c = t3_utf8_get(nfc_output + idx, &codepoint_len);
-      available_since = get_chardata(c) & 0x3f;
+      chardata = get_chardata(c);
+      available_since = T3_CHARDATA_VERSION(chardata);
 
-      if (_t3_term_combining < available_since &&
-          uc_is_general_category_withtable(c, UC_CATEGORY_MASK_M)) {
+      if (_t3_term_combining < available_since && (chardata & T3_CHARDATA_MARK)) {
         return t3_false;
       }
-      if (_t3_term_double_width < available_since && t3_utf8_wcwidth(c) == 2) {
+      if (_t3_term_double_width < available_since && T3_CHARDATA_WIDTH(chardata) == 2) {
         return t3_false;
       }
     }
@@ -20,5 +20,7 @@ T3_WINDOW_LOCAL t3_bool _t3_init_output_buffer(void);
 T3_WINDOW_LOCAL void _t3_free_output_buffer(void);
 T3_WINDOW_LOCAL t3_bool _t3_init_output_converter(const char *encoding);
 T3_WINDOW_LOCAL void _t3_output_buffer_print(void);
+T3_WINDOW_LOCAL void _t3_output_memory_usage(t3_memory_usage_t *usage);
+T3_WINDOW_LOCAL void _t3_output_compact(void);
 
 #endif
@@ -70,7 +70,19 @@ int _t3_tigetflag(const char *name) {
   return tigetflag(name_buffer);
 }
 
-static int writechar(int c) { return fputc(c, _t3_putp_file); }
+static char *capture_buffer; /**< Buffer to capture output in, or @c NULL if not capturing. */
+static size_t capture_size,  /**< Size of ::capture_buffer. */
+    capture_fill;            /**< Number of bytes stored in ::capture_buffer. */
+static int capture_overflow; /**< Boolean indicating that ::capture_buffer was too small. */
+
+static int writechar(int c) {
+  if (capture_buffer != NULL) {
+    char byte = c;
+    _t3_putp_raw(&byte, 1);
+    return c;
+  }
+  return fputc(c, _t3_putp_file);
+}
 
 void _t3_putp(const char *string) {
   if (string == NULL) {
@@ -79,6 +91,44 @@ void _t3_putp(const char *string) {
   tputs(string, 1, writechar);
 }
 
+/** Write bytes to the terminal, without interpreting padding specifications. */
+void _t3_putp_raw(const char *string, size_t n) {
+  if (capture_buffer != NULL && !capture_overflow) {
+    if (capture_size - capture_fill >= n) {
+      memcpy(capture_buffer + capture_fill, string, n);
+      capture_fill += n;
+      return;
+    }
+    capture_overflow = 1;
+  }
+  if (capture_buffer == NULL) {
+    fwrite(string, 1, n, _t3_putp_file);
+  }
+}
+
+/** Start capturing the output of ::_t3_putp and ::_t3_putp_raw in a buffer.
+    @param buffer The buffer to store the output in.
+    @param size The size of @p buffer.
+
+    The captured output is not written to the terminal. The caller is responsible
+    for writing it after calling ::_t3_putp_stop_capture.
+*/
+void _t3_putp_start_capture(char *buffer, size_t size) {
+  capture_buffer = buffer;
+  capture_size = size;
+  capture_fill = 0;
+  capture_overflow = 0;
+}
+
+/** Stop capturing the output of ::_t3_putp and ::_t3_putp_raw.
+    @return The number of bytes stored in the buffer, or <code>(size_t)-1</code> if the
+        buffer was too small. In the latter case the output is lost.
+*/
+size_t _t3_putp_stop_capture(void) {
+  capture_buffer = NULL;
+  return capture_overflow ? (size_t)-1 : capture_fill;
+}
+
 char *_t3_tparm(char *string, int nr_of_args, ...) {
   int args[9], i;
   va_list arglist;
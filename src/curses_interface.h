@@ -24,6 +24,9 @@ T3_WINDOW_LOCAL char *_t3_tigetstr(const char *name);
 T3_WINDOW_LOCAL int _t3_tigetnum(const char *name);
 T3_WINDOW_LOCAL int _t3_tigetflag(const char *name);
 T3_WINDOW_LOCAL void _t3_putp(const char *string);
+T3_WINDOW_LOCAL void _t3_putp_raw(const char *string, size_t n);
+T3_WINDOW_LOCAL void _t3_putp_start_capture(char *buffer, size_t size);
+T3_WINDOW_LOCAL size_t _t3_putp_stop_capture(void);
 T3_WINDOW_LOCAL char *_t3_tparm(char *string, int nr_of_args, ...);
 
 #endif
@@ -1,6 +1,11 @@
 #!/usr/bin/python
 
-import sys, os, inspect
+from __future__ import print_function
+import sys, os, inspect, re
+
+if sys.version_info[0] >= 3:
+	unichr = chr
+	xrange = range
 
 old_versions = [ "1.0", "1.1", "2.0", "2.1", "3.0", "3.1", "3.2" ]
 versions = [ "4.0", "4.1", "5.0", "5.1", "5.2", "6.0", "6.1", "6.2", "6.3", "7.0", "8.0", "9.0", "10.0" ]
@@ -17,9 +22,133 @@ double_width_test_exclude_ranges = [(0x1100, 0x115f), (0x2329, 0x2329), (0x232a,
 	(0x3040, 0xa4cf), (0xac00, 0xd7a3), (0xf900, 0xfaff), (0xfe10, 0xfe19), (0xfe30, 0xfe6f), (0xff00, 0xff60),
 	(0xffe0, 0xffe6), (0x20000, 0x2fffd), (0x30000, 0x3fffd)]
 
+# Bits stored above the version (bits 0-5) and width (bits 6-7) in the chardata entries.
+CONTROL_FLAG = 0x100
+MARK_FLAG = 0x200
+UNASSIGNED_FLAG = 0x400
+
+control_categories = [ "Cs", "Cf", "Co", "Cc", "Zl", "Zp" ]
+mark_categories = [ "Mn", "Mc", "Me" ]
+
+# The Grapheme_Cluster_Break property is stored in bits 11-14, using the index in this list.
+GRAPHEME_BREAK_SHIFT = 11
+grapheme_break_values = [ "Other", "CR", "LF", "Control", "Extend", "ZWJ", "Regional_Indicator", "Prepend",
+	"SpacingMark", "L", "V", "T", "LV", "LVT" ]
+EXTENDED_PICTOGRAPHIC_FLAG = 0x8000
+
+# The table is split into blocks of (1 << BLOCK_SHIFT) entries, which are de-duplicated and found
+# through an index. The blocks for the code points below DIRECT_SIZE are not de-duplicated but stored
+# in order at the start, such that those code points can also be looked up without the index.
+DIRECT_SIZE = 0x800
+BLOCK_SHIFT = 7
+
+def category_flag(category):
+	if category in control_categories:
+		return CONTROL_FLAG
+	if category in mark_categories:
+		return MARK_FLAG
+	if category == "Cn":
+		return UNASSIGNED_FLAG
+	return 0
+
+def read_ranges(name):
+	"""Yield the (first, last, value) tuples from a file in the UCD property file format."""
+	data = open(name, "r")
+	for line in data:
+		line = line.strip()
+		if len(line) == 0 or line.startswith('#'):
+			continue
+		range, _ , value = line.partition(';')
+		value, _, _ = value.partition('#')
+		range_start, _, range_end = range.strip().partition('..')
+		range_start = int(range_start, 16)
+		range_end = int(range_end, 16) if range_end != '' else range_start
+		yield range_start, range_end, value.strip()
+	data.close()
+
+def file_version(name):
+	"""Return the version from the "# <name>-<version>.txt" first line of a UCD file."""
+	data = open(name, "r")
+	match = re.search(r'-([0-9.]+)\.txt', data.readline())
+	data.close()
+	return match.group(1) if match else "unknown"
+
+def write_array(out, values, per_line):
+	for i in xrange(0, len(values), per_line):
+		out.write("  " + ", ".join(["0x%04X" % x for x in values[i:i + per_line]]) + ",\n")
+
+def write_chardata(chardata, basename, data_versions):
+	block_size = 1 << BLOCK_SHIFT
+	blocks = []
+	block_numbers = {}
+	index = []
+	for i in xrange(0, 0x110000, block_size):
+		block = tuple(chardata[i:i + block_size])
+		if i < DIRECT_SIZE:
+			blocks.append(block)
+			index.append(len(blocks) - 1)
+			continue
+		if block not in block_numbers:
+			block_numbers[block] = len(blocks)
+			blocks.append(block)
+		index.append(block_numbers[block])
+	index_type = "uint8_t" if len(blocks) <= 0x100 else "uint16_t"
+
+	header = open(basename + ".h", "w+")
+	header.write("/* This file has been automtically generated by {0}. DO NOT EDIT. */\n".format(
+		os.path.basename(sys.argv[0])))
+	header.write(data_versions)
+	header.write(inspect.cleandoc("""#ifndef CHARDATA_H
+		#define CHARDATA_H
+		#include <stdint.h>
+		#include "t3window/window_api.h"
+
+		/* Each entry holds the Unicode version index in bits 0-5, the width + 1 in bits 6-7, the
+		   T3_CHARDATA_* category flags in bits 8-10, the Grapheme_Cluster_Break property (T3_GCB_*)
+		   in bits 11-14 and the Extended_Pictographic property in bit 15. */
+		#define T3_CHARDATA_CONTROL 0x%03X
+		#define T3_CHARDATA_MARK 0x%03X
+		#define T3_CHARDATA_UNASSIGNED 0x%03X
+		#define T3_CHARDATA_VERSION(data) ((data) & 0x3f)
+		#define T3_CHARDATA_WIDTH(data) ((int)(((data) >> 6) & 3) - 1)
+		#define T3_CHARDATA_EXTENDED_PICTOGRAPHIC 0x%04X
+		#define T3_CHARDATA_GRAPHEME_BREAK(data) (((data) >> %d) & 0xf)
+		enum {
+		%s
+		};
+
+		T3_WINDOW_LOCAL extern const %s _t3_window_chardata_index[0x%X];
+		T3_WINDOW_LOCAL extern const uint16_t _t3_window_chardata_blocks[0x%X];
+		#define get_chardata(x) \\
+		  (_t3_window_chardata_blocks[((uint32_t)_t3_window_chardata_index[(x) >> %d] << %d) | ((x) & 0x%X)])
+		/* Only valid for x < 0x%X. */
+		#define get_chardata_direct(x) (_t3_window_chardata_blocks[(x)])
+		#endif
+		""") % (CONTROL_FLAG, MARK_FLAG, UNASSIGNED_FLAG, EXTENDED_PICTOGRAPHIC_FLAG, GRAPHEME_BREAK_SHIFT,
+			",\n".join(["  T3_GCB_" + x.upper() for x in grapheme_break_values]), index_type, len(index),
+			len(blocks) * block_size, BLOCK_SHIFT, BLOCK_SHIFT, block_size - 1, DIRECT_SIZE))
+	header.write("\n")
+	header.close()
+
+	source = open(basename + ".c", "w+")
+	source.write("/* This file has been automtically generated by {0}. DO NOT EDIT. */\n".format(
+		os.path.basename(sys.argv[0])))
+	source.write(data_versions)
+	source.write("#include \"chardata.h\"\n")
+	source.write("const %s _t3_window_chardata_index[0x%X] = {\n" % (index_type, len(index)))
+	write_array(source, index, 12)
+	source.write("};\n")
+	source.write("const uint16_t _t3_window_chardata_blocks[0x%X] = {\n" % (len(blocks) * block_size))
+	for i in xrange(0, len(blocks)):
+		source.write("  /* Block 0x%02X */\n" % i)
+		write_array(source, blocks[i], 12)
+	source.write("};\n")
+	source.close()
+
 def main():
-	if len(sys.argv) != 4:
-		sys.stderr.write("Usage: generate_chardata.py <UnicodeData file> <EastAsianWidth file> <DerivedAge file>\n");
+	if len(sys.argv) != 6:
+		sys.stderr.write("Usage: generate_chardata.py <UnicodeData file> <EastAsianWidth file> <DerivedAge file> " +
+			"<GraphemeBreakProperty file> <emoji-data file>\n");
 		sys.exit(1)
 
 	available_since = [0xff] * 0x110000
@@ -40,7 +169,7 @@ def main():
 		elif version in versions:
 			value = versions.index(version)
 		else:
-			print >>sys.stderr, "Version {0} has not been assigned an index yet".format(version)
+			print("Version {0} has not been assigned an index yet".format(version), file=sys.stderr)
 			sys.exit(1)
 
 		for i in xrange(range_start, range_end + 1):
@@ -68,12 +197,21 @@ def main():
 	unicode_data = open(sys.argv[1], "r")
 	combining_characters = set()
 	name_mapping = {}
+	category_flags = [UNASSIGNED_FLAG] * 0x110000
+	range_start = None
 	for line in unicode_data:
 		line = line.strip()
 		if len(line) == 0 or line.startswith('#'):
 			continue
 		parts = line.split(';')
 		cp = int(parts[0], 16)
+		# Large blocks like the CJK ideographs are listed as a <..., First>/<..., Last> pair.
+		if parts[1].endswith(', First>'):
+			range_start = cp
+		elif parts[1].endswith(', Last>'):
+			for i in xrange(range_start, cp):
+				category_flags[i] = category_flag(parts[2])
+		category_flags[cp] = category_flag(parts[2])
 		name_mapping[cp] = parts[1]
 		if parts[4] == 'NSM' or parts[2] == 'Cf':
 			cell_width[cp] = 0
@@ -93,13 +231,20 @@ def main():
 					accept = True
 					break
 			if not accept:
-				print >>sys.stderr, "Cell width data available (%d), but no age for %04X!" % (cell_width[i], i)
+				print("Cell width data available (%d), but no age for %04X!" % (cell_width[i], i), file=sys.stderr)
 				sys.exit(1)
 
-	# Default is width 1 (value 2 << 6) and version 0x3f. I.e. 0xbf or 191
-	statrie = os.popen("statrie -p -r0x110000 -H'#include \"t3window/window_api.h\"' -e'T3_WINDOW_LOCAL extern' " +
-		"-d generated -D191 -f chardata -n get_chardata t3_window_chardata", "w")
+	for range_start, range_end, value in read_ranges(sys.argv[4]):
+		for i in xrange(range_start, range_end + 1):
+			category_flags[i] |= grapheme_break_values.index(value) << GRAPHEME_BREAK_SHIFT
+	for range_start, range_end, value in read_ranges(sys.argv[5]):
+		if value != "Extended_Pictographic":
+			continue
+		for i in xrange(range_start, range_end + 1):
+			category_flags[i] |= EXTENDED_PICTOGRAPHIC_FLAG
 
+	# Code points without any data get width 1 (value 2 << 6) and version 0x3f.
+	chardata = [0xbf | category_flags[i] for i in xrange(0, 0x110000)]
 	for i in xrange(0, 0x110000):
 		if available_since[i] == 0xff and cell_width[i] == 0xff:
 			continue
@@ -108,9 +253,11 @@ def main():
 			width = 1
 		# Shift range from -1-2 to 0-3.
 		width += 1
-		statrie.write('{0} {1}\n'.format(i, (available_since[i] & 0x3f) | (width << 6)))
+		chardata[i] = (available_since[i] & 0x3f) | (width << 6) | category_flags[i]
 
-	statrie.close()
+	data_versions = ("/* Unicode data: DerivedAge, EastAsianWidth and UnicodeData {0}, GraphemeBreakProperty and\n" +
+		"   emoji-data {1}. */\n").format(file_version(sys.argv[3]), file_version(sys.argv[4]))
+	write_chardata(chardata, "generated/chardata", data_versions)
 
 	versions_header = open("generated/versions.h", "w+")
 	versions_header.write("/* This file has been automtically generated by {0}. DO NOT EDIT. */\n".format(os.path.basename(sys.argv[0])))
@@ -167,18 +314,18 @@ def main():
 
 	for i in xrange(1, len(versions)):
 		if i in has_double_width and not i in double_width_tests:
-			print >>sys.stderr, "Could not find a suitable test for double width characters for version %s" % versions[version]
+			print("Could not find a suitable test for double width characters for version %s" % versions[i], file=sys.stderr)
 			sys.exit(1)
 		if i in has_zero_width and not i in zero_width_tests:
-			print >>sys.stderr, "Could not find a suitable test for zero width characters for version %s" % versions[version]
+			print("Could not find a suitable test for zero width characters for version %s" % versions[i], file=sys.stderr)
 			sys.exit(1)
 
 	tests_header = open("generated/capability_test.h", "w+")
 	tests_header.write("/* This file has been automtically generated by {0}. DO NOT EDIT. */\n".format(os.path.basename(sys.argv[0])))
-	sorted_zero_width_tests = sorted(zero_width_tests.iteritems())[1:]
+	sorted_zero_width_tests = sorted(zero_width_tests.items())[1:]
 	for version, codepoint in sorted_zero_width_tests:
-		utf8_str = unichr(codepoint).encode('utf-8')
-		test_str = ''.join(["\\x%02X" % ord(i) for i in utf8_str])
+		utf8_str = bytearray(unichr(codepoint).encode('utf-8'))
+		test_str = ''.join(["\\x%02X" % i for i in utf8_str])
 		tests_header.write(inspect.cleandoc("""/* [%s] U+002E FULL STOP / U+%04X %s */
 			TEST("\\x2e%s",
 				if (_t3_term_encoding == _T3_TERM_UTF8 && column == 1 && _t3_term_combining == T3_UNICODE_%s)
@@ -187,10 +334,10 @@ def main():
 				versions[version - 1].replace(".", ""), versions[version].replace(".", ""))))
 		tests_header.write('\n')
 
-	sorted_double_width_tests = sorted(double_width_tests.iteritems())[1:]
+	sorted_double_width_tests = sorted(double_width_tests.items())[1:]
 	for version, codepoint in sorted_double_width_tests:
-		utf8_str = unichr(codepoint).encode('utf-8')
-		test_str = ''.join(["\\x%02X" % ord(i) for i in utf8_str])
+		utf8_str = bytearray(unichr(codepoint).encode('utf-8'))
+		test_str = ''.join(["\\x%02X" % i for i in utf8_str])
 		tests_header.write(inspect.cleandoc("""/* [%s] U+%04X %s */
 			TEST("%s",
 				if (_t3_term_encoding == _T3_TERM_UTF8 && column == 2 && _t3_term_double_width == T3_UNICODE_%s)
@@ -1,1917 +1,3854 @@
-/* This file was generated by statrie. DO NOT EDIT. */
+/* This file has been automtically generated by generate_chardata.py. DO NOT EDIT. */
+/* Unicode data: DerivedAge, EastAsianWidth and UnicodeData 10.0.0, GraphemeBreakProperty and
+   emoji-data 14.0.0. */
 #include "chardata.h"
-const uint8_t _t3_window_chardata_data_2[228][2] = {
-{ 0x00, 0x00},
-{ 0x80, 0x80},
-{ 0x80, 0x00},
-{ 0x80, 0x81},
-{ 0x81, 0x81},
-{ 0x82, 0x82},
-{ 0x40, 0x40},
-{ 0x41, 0x41},
-{ 0x41, 0x40},
-{ 0x83, 0x83},
-{ 0xBF, 0xBF},
-{ 0x80, 0x82},
-{ 0x80, 0x89},
-{ 0x80, 0xBF},
-{ 0xBF, 0x80},
-{ 0x80, 0x83},
-{ 0x80, 0x40},
-{ 0x40, 0x43},
-{ 0x84, 0x84},
-{ 0x85, 0x85},
-{ 0x89, 0x89},
-{ 0xBF, 0x89},
-{ 0x89, 0x86},
-{ 0xBF, 0x40},
-{ 0x42, 0x40},
-{ 0x40, 0x80},
-{ 0x40, 0x41},
-{ 0x81, 0x41},
-{ 0x46, 0x49},
-{ 0x83, 0x81},
-{ 0x43, 0x43},
-{ 0x43, 0x80},
-{ 0x48, 0xBF},
-{ 0x81, 0x80},
-{ 0x85, 0x80},
-{ 0x41, 0x45},
-{ 0x40, 0xBF},
-{ 0x82, 0x42},
-{ 0x42, 0x42},
-{ 0x82, 0xBF},
-{ 0x44, 0x44},
-{ 0x84, 0x44},
-{ 0x84, 0xBF},
-{ 0x85, 0x45},
-{ 0x45, 0x45},
-{ 0x85, 0xBF},
-{ 0x8C, 0x8C},
-{ 0x8C, 0xBF},
-{ 0x86, 0x89},
-{ 0x86, 0x86},
-{ 0x89, 0x8A},
-{ 0x8A, 0xBF},
-{ 0x8B, 0x8B},
-{ 0x4B, 0x4B},
-{ 0x4B, 0x4A},
-{ 0x46, 0x46},
-{ 0x44, 0x40},
-{ 0x45, 0x85},
-{ 0x84, 0x85},
-{ 0x40, 0x44},
-{ 0x83, 0x85},
-{ 0x89, 0x84},
-{ 0x84, 0x82},
-{ 0x82, 0x81},
-{ 0x89, 0x40},
-{ 0x81, 0xBF},
-{ 0x80, 0x84},
-{ 0xBF, 0x43},
-{ 0x80, 0x43},
-{ 0x86, 0x80},
-{ 0xBF, 0x8A},
-{ 0x4C, 0x4C},
-{ 0x43, 0xBF},
-{ 0x83, 0xBF},
-{ 0x49, 0x80},
-{ 0x89, 0x80},
-{ 0xBF, 0x83},
-{ 0x8B, 0x49},
-{ 0xBF, 0x82},
-{ 0x4C, 0x49},
-{ 0x80, 0x85},
-{ 0x85, 0x4C},
-{ 0x4C, 0x83},
-{ 0x85, 0x8B},
-{ 0x8B, 0x80},
-{ 0x8B, 0x8A},
-{ 0x8B, 0x83},
-{ 0x83, 0x80},
-{ 0x83, 0x84},
-{ 0x43, 0x83},
-{ 0x83, 0x43},
-{ 0xBF, 0x86},
-{ 0x81, 0x86},
-{ 0xC0, 0xC0},
-{ 0xC4, 0xC4},
-{ 0xC4, 0xC0},
-{ 0xBF, 0x45},
-{ 0x45, 0x41},
-{ 0x80, 0x8A},
-{ 0x8A, 0x8A},
-{ 0x84, 0x80},
-{ 0x89, 0xBF},
-{ 0x41, 0x81},
-{ 0x44, 0x84},
-{ 0x44, 0xBF},
-{ 0xBF, 0x44},
-{ 0x49, 0x49},
-{ 0x49, 0xBF},
-{ 0x42, 0x82},
-{ 0x83, 0x46},
-{ 0x8B, 0xBF},
-{ 0x84, 0x86},
-{ 0x46, 0x86},
-{ 0x86, 0x8C},
-{ 0x42, 0x43},
-{ 0x43, 0x49},
-{ 0xBF, 0x4B},
-{ 0x45, 0x44},
-{ 0x48, 0x48},
-{ 0x81, 0x85},
-{ 0x87, 0x89},
-{ 0x8A, 0x8C},
-{ 0x81, 0x82},
-{ 0x82, 0x83},
-{ 0x80, 0xC0},
-{ 0xC0, 0x80},
-{ 0x84, 0xC5},
-{ 0xC5, 0xC5},
-{ 0xC5, 0x85},
-{ 0x85, 0xC5},
-{ 0x89, 0x8B},
-{ 0x8B, 0x8C},
-{ 0x81, 0xC1},
-{ 0x81, 0x83},
-{ 0xC1, 0xC1},
-{ 0x83, 0xC4},
-{ 0xC4, 0x84},
-{ 0xC5, 0x84},
-{ 0x85, 0x84},
-{ 0x84, 0xC4},
-{ 0x80, 0xC5},
-{ 0xC5, 0x80},
-{ 0x80, 0xC4},
-{ 0x82, 0x86},
-{ 0x83, 0x86},
-{ 0x82, 0xC3},
-{ 0xC3, 0x83},
-{ 0x83, 0x89},
-{ 0x84, 0x83},
-{ 0x81, 0x84},
-{ 0xBF, 0x81},
-{ 0xBF, 0xC0},
-{ 0xC0, 0xBF},
-{ 0x40, 0xC0},
-{ 0xC0, 0xC3},
-{ 0xCC, 0xBF},
-{ 0xC5, 0xBF},
-{ 0xC3, 0xC3},
-{ 0xC1, 0xC0},
-{ 0xFF, 0xFF},
-{ 0xC6, 0xCA},
-{ 0xCA, 0xCA},
-{ 0xCC, 0xCC},
-{ 0xCC, 0xFF},
-{ 0x4A, 0x46},
-{ 0x85, 0x8A},
-{ 0x85, 0x83},
-{ 0x43, 0x4B},
-{ 0xC4, 0xBF},
-{ 0xBF, 0x84},
-{ 0x89, 0x49},
-{ 0x49, 0x89},
-{ 0x46, 0xBF},
-{ 0xBF, 0x85},
-{ 0xC6, 0xC6},
-{ 0xC0, 0xC4},
-{ 0x4A, 0x4A},
-{ 0x81, 0x89},
-{ 0xBF, 0x8C},
-{ 0xBF, 0x41},
-{ 0x41, 0xBF},
-{ 0xBF, 0x49},
-{ 0x86, 0xBF},
-{ 0x86, 0x46},
-{ 0x86, 0x8A},
-{ 0x4A, 0x89},
-{ 0x4B, 0xBF},
-{ 0x4A, 0x49},
-{ 0x4B, 0x8B},
-{ 0xBF, 0x8B},
-{ 0xBF, 0x4A},
-{ 0x8A, 0x4A},
-{ 0x8C, 0x4C},
-{ 0x4C, 0x8C},
-{ 0x8B, 0x4B},
-{ 0x4C, 0xBF},
-{ 0xBF, 0x4C},
-{ 0x82, 0x89},
-{ 0xBF, 0x46},
-{ 0xCB, 0xCC},
-{ 0xCB, 0xCB},
-{ 0xCB, 0xBF},
-{ 0x4A, 0x8A},
-{ 0x85, 0x89},
-{ 0x84, 0x89},
-{ 0xC5, 0x8B},
-{ 0xC4, 0xC5},
-{ 0xC5, 0xCB},
-{ 0xC5, 0x89},
-{ 0x89, 0xCA},
-{ 0x89, 0xC5},
-{ 0xC5, 0xC9},
-{ 0xC9, 0x89},
-{ 0xC9, 0xC5},
-{ 0xCA, 0x8A},
-{ 0xCB, 0x89},
-{ 0x89, 0xC9},
-{ 0xC6, 0xC5},
-{ 0xC5, 0xC6},
-{ 0xC9, 0xCA},
-{ 0xCA, 0xC5},
-{ 0xCA, 0xCB},
-{ 0xCB, 0x8C},
-{ 0xC9, 0xBF},
-{ 0xCC, 0xCB},
-{ 0xCA, 0xBF},
-{ 0xC0, 0xFF},
-{ 0xC4, 0xFF}
+const uint16_t _t3_window_chardata_index[0x2200] = {
+  0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B,
+  0x000C, 0x000D, 0x000E, 0x000F, 0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017,
+  0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, 0x0020, 0x0021, 0x0022, 0x0023,
+  0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x0029, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D,
+  0x002E, 0x002F, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039,
+  0x0029, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, 0x0040, 0x0029, 0x0029, 0x0041, 0x0042,
+  0x0043, 0x0044, 0x0029, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x0029, 0x0029, 0x004A, 0x0029,
+  0x0029, 0x0029, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051, 0x0052, 0x0053, 0x0054,
+  0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053,
+  0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053,
+  0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053,
+  0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053,
+  0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x005B,
+  0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053,
+  0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053,
+  0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053,
+  0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053,
+  0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053,
+  0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053,
+  0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053,
+  0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053,
+  0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053,
+  0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053,
+  0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053,
+  0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053,
+  0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053,
+  0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x005C, 0x0053, 0x0053, 0x0053, 0x0053,
+  0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x005D, 0x005E, 0x005E, 0x005F, 0x0060, 0x0061, 0x0062,
+  0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E,
+  0x006F, 0x0070, 0x0071, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x006B, 0x006C,
+  0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071,
+  0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+  0x0070, 0x0071, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x006B, 0x006C, 0x006D,
+  0x006E, 0x006F, 0x0070, 0x0071, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x006B,
+  0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070,
+  0x0071, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x006B, 0x006C, 0x006D, 0x0072,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0053, 0x0053, 0x0074, 0x0075, 0x0076, 0x0077,
+  0x0029, 0x0029, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, 0x0080, 0x0081,
+  0x0082, 0x0083, 0x0084, 0x0085, 0x0029, 0x0086, 0x0087, 0x0082, 0x0088, 0x0088, 0x0089, 0x0082,
+  0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F, 0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0082,
+  0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F, 0x0082,
+  0x00A0, 0x00A1, 0x0082, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x0082, 0x00A6, 0x00A7, 0x00A8, 0x00A9,
+  0x00AA, 0x00AB, 0x0082, 0x0082, 0x00AC, 0x00AD, 0x00AE, 0x00AF, 0x0082, 0x00B0, 0x0082, 0x0082,
+  0x00B1, 0x00B1, 0x00B1, 0x00B1, 0x00B1, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x00B7, 0x00B7, 0x00B7, 0x00B7,
+  0x00B7, 0x00B7, 0x00B7, 0x00B7, 0x00B8, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x00B5, 0x00B5, 0x00B5, 0x00B5, 0x00B9, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x00BA, 0x00BA, 0x00BA, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x00BF, 0x00C0, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1,
+  0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1,
+  0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1,
+  0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1,
+  0x00C1, 0x00C1, 0x00C1, 0x00C2, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C3, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x00C4, 0x00C5, 0x00C6, 0x00C5, 0x00C5, 0x00C7, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x00C8, 0x00C9, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x00CA, 0x0082, 0x0029, 0x00CB, 0x00CC, 0x00CD, 0x00CE, 0x0082, 0x00CF, 0x0082,
+  0x00D0, 0x00D1, 0x00D2, 0x0029, 0x0029, 0x00D3, 0x0029, 0x00D4, 0x00B5, 0x00B5, 0x00B5, 0x00B5,
+  0x00D5, 0x00D6, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x00D7, 0x0082, 0x00D8, 0x0082, 0x0082, 0x00D9, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0088, 0x00DA, 0x00DB, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x00DC, 0x00DD, 0x0082, 0x0082, 0x00DE, 0x00DF, 0x00E0, 0x00E1,
+  0x00E2, 0x00E3, 0x00E4, 0x00E5, 0x00E6, 0x00E7, 0x00E8, 0x00E9, 0x00EA, 0x00EB, 0x00EC, 0x00ED,
+  0x00EE, 0x00EF, 0x00F0, 0x00F1, 0x00E3, 0x00E3, 0x0082, 0x0082, 0x00E3, 0x00E3, 0x00E3, 0x00E3,
+  0x00E3, 0x00E3, 0x00E3, 0x00F2, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053,
+  0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053,
+  0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053,
+  0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053,
+  0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053,
+  0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053,
+  0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053,
+  0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053,
+  0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053,
+  0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053,
+  0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053,
+  0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053,
+  0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053,
+  0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053,
+  0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053,
+  0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053,
+  0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053,
+  0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053,
+  0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053,
+  0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053,
+  0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053,
+  0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053,
+  0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053,
+  0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053,
+  0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053,
+  0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053,
+  0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053,
+  0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053,
+  0x0053, 0x00F3, 0x00F4, 0x00F4, 0x00F4, 0x00F4, 0x00F4, 0x00F4, 0x00F4, 0x00F4, 0x00F4, 0x00F4,
+  0x00F4, 0x00F4, 0x00F4, 0x00F4, 0x00F4, 0x00F4, 0x00F4, 0x00F4, 0x00F4, 0x00F4, 0x00F4, 0x00F4,
+  0x00F4, 0x00F4, 0x00F4, 0x00F4, 0x00F4, 0x00F4, 0x00F4, 0x00F4, 0x00F4, 0x00F4, 0x00F5, 0x00F6,
+  0x00F7, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8,
+  0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8,
+  0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8,
+  0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F9, 0x00C5, 0x00C5,
+  0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5,
+  0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5,
+  0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5,
+  0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5,
+  0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00FA, 0x00FB, 0x00FB, 0x00FB, 0x00FB,
+  0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB,
+  0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x0053, 0x0053, 0x0053, 0x0053,
+  0x00FC, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FD,
+  0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB,
+  0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB,
+  0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB,
+  0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB,
+  0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB,
+  0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB,
+  0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB,
+  0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB,
+  0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB,
+  0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB,
+  0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB,
+  0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB,
+  0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB,
+  0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB,
+  0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB,
+  0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB,
+  0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB,
+  0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB,
+  0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB,
+  0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB,
+  0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB,
+  0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB,
+  0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB,
+  0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB,
+  0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB,
+  0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB,
+  0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB,
+  0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB,
+  0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB,
+  0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB,
+  0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB,
+  0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB,
+  0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB,
+  0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB,
+  0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB,
+  0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB,
+  0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB,
+  0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB,
+  0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB,
+  0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB,
+  0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB,
+  0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB,
+  0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FB, 0x00FD, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x00FE, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x00FE,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x00FE, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x00FE, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x00FE,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x00FE, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x00FE, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x00FE,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x00FE, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x00FE, 0x00FF, 0x0100, 0x0101, 0x0102, 0x0100, 0x0100, 0x0100, 0x0100,
+  0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100,
+  0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x00FE,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0103, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+  0x0073, 0x0073, 0x0073, 0x0103,
 };
-const uint8_t _t3_window_chardata_data_1[640][8] = {
-{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-{ 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01},
-{ 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02},
-{ 0x01, 0x01, 0x01, 0x03, 0x04, 0x04, 0x04, 0x04},
-{ 0x04, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05},
-{ 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06},
-{ 0x06, 0x06, 0x06, 0x06, 0x07, 0x07, 0x08, 0x06},
-{ 0x09, 0x09, 0x01, 0x09, 0x0A, 0x0B, 0x05, 0x0C},
-{ 0x0A, 0x0A, 0x01, 0x01, 0x01, 0x0D, 0x0D, 0x01},
-{ 0x01, 0x0E, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01},
-{ 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0F},
-{ 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x04, 0x04},
-{ 0x01, 0x10, 0x06, 0x11, 0x06, 0x01, 0x01, 0x01},
-{ 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B},
-{ 0x01, 0x01, 0x01, 0x04, 0x01, 0x05, 0x05, 0x05},
-{ 0x05, 0x05, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09},
-{ 0x09, 0x09, 0x12, 0x13, 0x14, 0x14, 0x14, 0x14},
-{ 0x0E, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01},
-{ 0x01, 0x01, 0x01, 0x0D, 0x0E, 0x01, 0x01, 0x01},
-{ 0x01, 0x01, 0x01, 0x01, 0x0E, 0x0D, 0x15, 0x16},
-{ 0x17, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06},
-{ 0x06, 0x08, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06},
-{ 0x06, 0x06, 0x06, 0x06, 0x06, 0x18, 0x06, 0x10},
-{ 0x10, 0x19, 0x1A, 0x1B, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0x01, 0x01, 0x01, 0x01, 0x01, 0x0D, 0x0A, 0x0A},
-{ 0x01, 0x01, 0x0D, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0x06, 0x06, 0x1C, 0x09, 0x09, 0x1D, 0x01, 0x01},
-{ 0x06, 0x06, 0x06, 0x1E, 0x1E, 0x1F, 0x20, 0x21},
-{ 0x22, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01},
-{ 0x01, 0x01, 0x01, 0x01, 0x01, 0x0F, 0x09, 0x09},
-{ 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x06, 0x06},
-{ 0x06, 0x06, 0x06, 0x06, 0x1A, 0x07, 0x07, 0x23},
-{ 0x19, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01},
-{ 0x01, 0x01, 0x01, 0x06, 0x06, 0x06, 0x06, 0x10},
-{ 0x06, 0x06, 0x19, 0x10, 0x19, 0x06, 0x06, 0x01},
-{ 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x17},
-{ 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01},
-{ 0x06, 0x06, 0x06, 0x06, 0x06, 0x24, 0x0E, 0x01},
-{ 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04},
-{ 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x09},
-{ 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09},
-{ 0x01, 0x01, 0x01, 0x06, 0x06, 0x06, 0x06, 0x06},
-{ 0x19, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05},
-{ 0x05, 0x05, 0x05, 0x05, 0x05, 0x25, 0x26, 0x26},
-{ 0x26, 0x26, 0x05, 0x05, 0x05, 0x27, 0x0A, 0x0A},
-{ 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12},
-{ 0x12, 0x12, 0x12, 0x28, 0x28, 0x29, 0x28, 0x28},
-{ 0x28, 0x28, 0x29, 0x28, 0x29, 0x28, 0x28, 0x0A},
-{ 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x2A},
-{ 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13},
-{ 0x13, 0x13, 0x13, 0x13, 0x2B, 0x2C, 0x0A, 0x2D},
-{ 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2F, 0x0A, 0x0A},
-{ 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0x30, 0x31, 0x31, 0x31, 0x31, 0x31, 0x30, 0x14},
-{ 0x14, 0x32, 0x33, 0x34, 0x34, 0x34, 0x34, 0x0A},
-{ 0x0A, 0x0A, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35},
-{ 0x35, 0x36, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37},
-{ 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x1C},
-{ 0x38, 0x19, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01},
-{ 0x01, 0x01, 0x01, 0x01, 0x01, 0x39, 0x19, 0x01},
-{ 0x10, 0x06, 0x06, 0x06, 0x19, 0x01, 0x10, 0x3A},
-{ 0x10, 0x06, 0x3B, 0x2C, 0x01, 0x01, 0x01, 0x01},
-{ 0x01, 0x06, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01},
-{ 0x0F, 0x3C, 0x13, 0x13, 0x3D, 0x3E, 0x3F, 0x05},
-{ 0x40, 0x01, 0x0E, 0x01, 0x01, 0x01, 0x0D, 0x0E},
-{ 0x0D, 0x0E, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01},
-{ 0x01, 0x01, 0x01, 0x01, 0x0D, 0x01, 0x01, 0x01},
-{ 0x0D, 0x0D, 0x0A, 0x01, 0x01, 0x0A, 0x19, 0x01},
-{ 0x10, 0x06, 0x24, 0x0E, 0x0D, 0x0E, 0x10, 0x41},
-{ 0x0A, 0x0A, 0x0A, 0x0E, 0x0A, 0x0A, 0x01, 0x0E},
-{ 0x01, 0x06, 0x0A, 0x01, 0x01, 0x01, 0x01, 0x01},
-{ 0x01, 0x01, 0x01, 0x01, 0x01, 0x42, 0x2E, 0x0A},
-{ 0x17, 0x19, 0x0E, 0x01, 0x01, 0x0D, 0x0A, 0x0E},
-{ 0x0D, 0x01, 0x0E, 0x0D, 0x01, 0x0A, 0x24, 0x01},
-{ 0x10, 0x24, 0x0A, 0x17, 0x24, 0x17, 0x06, 0x0A},
-{ 0x43, 0x0A, 0x0A, 0x0A, 0x0E, 0x01, 0x0D, 0x0D},
-{ 0x0A, 0x0A, 0x0A, 0x01, 0x01, 0x01, 0x01, 0x01},
-{ 0x06, 0x01, 0x44, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0x17, 0x19, 0x0E, 0x01, 0x01, 0x01, 0x01, 0x0E},
-{ 0x0D, 0x01, 0x0E, 0x01, 0x01, 0x0A, 0x19, 0x01},
-{ 0x10, 0x06, 0x06, 0x17, 0x19, 0x0E, 0x10, 0x0A},
-{ 0x0D, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0x45, 0x0A, 0x0A, 0x0A, 0x46, 0x47, 0x47, 0x47},
-{ 0x17, 0x01, 0x0E, 0x01, 0x01, 0x01, 0x0D, 0x0E},
-{ 0x0D, 0x01, 0x0E, 0x01, 0x01, 0x0A, 0x19, 0x10},
-{ 0x10, 0x06, 0x48, 0x0E, 0x0D, 0x0E, 0x10, 0x0A},
-{ 0x0A, 0x0A, 0x0A, 0x19, 0x0A, 0x0A, 0x01, 0x0E},
-{ 0x01, 0x1E, 0x0A, 0x01, 0x01, 0x01, 0x01, 0x01},
-{ 0x01, 0x13, 0x13, 0x13, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0x0A, 0x19, 0x0E, 0x01, 0x01, 0x0D, 0x0A, 0x01},
-{ 0x0D, 0x01, 0x01, 0x0A, 0x0E, 0x0D, 0x0D, 0x01},
-{ 0x0A, 0x0E, 0x0D, 0x0A, 0x01, 0x0D, 0x0A, 0x01},
-{ 0x01, 0x01, 0x01, 0x21, 0x01, 0x0A, 0x0A, 0x01},
-{ 0x19, 0x0D, 0x0A, 0x01, 0x0D, 0x01, 0x10, 0x0A},
-{ 0x49, 0x0A, 0x0A, 0x0E, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0x0A, 0x0A, 0x0A, 0x21, 0x01, 0x01, 0x01, 0x01},
-{ 0x4A, 0x01, 0x0E, 0x01, 0x01, 0x01, 0x0D, 0x01},
-{ 0x0D, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01},
-{ 0x01, 0x01, 0x4B, 0x01, 0x01, 0x0A, 0x4C, 0x06},
-{ 0x19, 0x01, 0x0D, 0x06, 0x24, 0x06, 0x06, 0x0A},
-{ 0x0A, 0x0A, 0x17, 0x24, 0x09, 0x33, 0x0A, 0x0A},
-{ 0x0A, 0x0A, 0x0A, 0x0A, 0x09, 0x09, 0x09, 0x09},
-{ 0x4D, 0x01, 0x0E, 0x01, 0x01, 0x01, 0x0D, 0x01},
-{ 0x01, 0x01, 0x0E, 0x01, 0x01, 0x0A, 0x19, 0x01},
-{ 0x01, 0x01, 0x0D, 0x01, 0x0D, 0x01, 0x06, 0x0A},
-{ 0x0A, 0x0A, 0x0E, 0x0D, 0x0A, 0x0A, 0x0A, 0x0D},
-{ 0x01, 0x26, 0x0A, 0x01, 0x01, 0x01, 0x01, 0x01},
-{ 0x4E, 0x27, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0x4F, 0x01, 0x0E, 0x01, 0x01, 0x01, 0x0D, 0x01},
-{ 0x01, 0x01, 0x01, 0x01, 0x50, 0x01, 0x01, 0x01},
-{ 0x01, 0x01, 0x01, 0x01, 0x01, 0x51, 0x52, 0x01},
-{ 0x10, 0x06, 0x48, 0x01, 0x0D, 0x01, 0x10, 0x53},
-{ 0x0A, 0x0A, 0x34, 0x54, 0x34, 0x34, 0x34, 0x55},
-{ 0x09, 0x09, 0x09, 0x34, 0x56, 0x09, 0x09, 0x09},
-{ 0x0A, 0x01, 0x0E, 0x01, 0x01, 0x01, 0x01, 0x01},
-{ 0x01, 0x01, 0x01, 0x0D, 0x0A, 0x01, 0x01, 0x01},
-{ 0x01, 0x0E, 0x01, 0x01, 0x01, 0x01, 0x0E, 0x0A},
-{ 0x01, 0x01, 0x01, 0x0D, 0x0A, 0x24, 0x0A, 0x0E},
-{ 0x01, 0x06, 0x24, 0x24, 0x01, 0x01, 0x01, 0x01},
-{ 0x0A, 0x0A, 0x0A, 0x14, 0x14, 0x14, 0x14, 0x14},
-{ 0x0A, 0x01, 0x0D, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0x10, 0x01, 0x06, 0x06, 0x06, 0x24, 0x0A, 0x0E},
-{ 0x01, 0x01, 0x01, 0x10, 0x06, 0x06, 0x06, 0x19},
-{ 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0A, 0x0A},
-{ 0x0E, 0x0D, 0x0D, 0x0E, 0x0D, 0x0D, 0x0E, 0x0A},
-{ 0x0A, 0x0A, 0x01, 0x01, 0x0E, 0x01, 0x01, 0x01},
-{ 0x0E, 0x01, 0x0E, 0x0E, 0x0A, 0x01, 0x0E, 0x01},
-{ 0x10, 0x01, 0x06, 0x06, 0x06, 0x17, 0x19, 0x0A},
-{ 0x01, 0x01, 0x0D, 0x0D, 0x06, 0x06, 0x06, 0x0A},
-{ 0x01, 0x01, 0x01, 0x01, 0x01, 0x0A, 0x01, 0x31},
-{ 0x01, 0x01, 0x01, 0x01, 0x06, 0x01, 0x01, 0x01},
-{ 0x01, 0x01, 0x10, 0x10, 0x10, 0x01, 0x01, 0x01},
-{ 0x01, 0x01, 0x01, 0x01, 0x0E, 0x01, 0x01, 0x01},
-{ 0x01, 0x01, 0x01, 0x01, 0x01, 0x0F, 0x49, 0x0A},
-{ 0x17, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x19},
-{ 0x06, 0x06, 0x19, 0x06, 0x01, 0x01, 0x2B, 0x2C},
-{ 0x06, 0x06, 0x06, 0x06, 0x17, 0x06, 0x06, 0x06},
-{ 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x24, 0x01},
-{ 0x01, 0x01, 0x01, 0x19, 0x01, 0x01, 0x0D, 0x57},
-{ 0x04, 0x09, 0x58, 0x12, 0x3A, 0x2D, 0x0A, 0x0A},
-{ 0x01, 0x57, 0x01, 0x01, 0x57, 0x0F, 0x10, 0x06},
-{ 0x19, 0x11, 0x1E, 0x06, 0x10, 0x59, 0x5A, 0x59},
-{ 0x01, 0x01, 0x01, 0x01, 0x06, 0x09, 0x09, 0x1E},
-{ 0x59, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09},
-{ 0x5A, 0x1E, 0x59, 0x09, 0x09, 0x09, 0x09, 0x09},
-{ 0x09, 0x59, 0x5A, 0x59, 0x09, 0x09, 0x5A, 0x09},
-{ 0x09, 0x09, 0x09, 0x09, 0x09, 0x12, 0x29, 0x09},
-{ 0x01, 0x01, 0x01, 0x5B, 0x0A, 0x0A, 0x5B, 0x0A},
-{ 0x01, 0x01, 0x01, 0x01, 0x03, 0x21, 0x5C, 0x31},
-{ 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D},
-{ 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5E, 0x5E, 0x5F},
-{ 0x01, 0x42, 0x12, 0x12, 0x01, 0x01, 0x01, 0x01},
-{ 0x01, 0x01, 0x01, 0x01, 0x01, 0x12, 0x12, 0x12},
-{ 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x01, 0x01},
-{ 0x01, 0x01, 0x01, 0x03, 0x0D, 0x01, 0x01, 0x0A},
-{ 0x01, 0x01, 0x01, 0x0D, 0x0D, 0x01, 0x01, 0x0A},
-{ 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03},
-{ 0x0D, 0x01, 0x01, 0x0A, 0x01, 0x01, 0x01, 0x0D},
-{ 0x0D, 0x01, 0x01, 0x0A, 0x01, 0x01, 0x01, 0x03},
-{ 0x01, 0x01, 0x01, 0x0D, 0x01, 0x01, 0x01, 0x01},
-{ 0x01, 0x01, 0x01, 0x01, 0x01, 0x0D, 0x60, 0x61},
-{ 0x21, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01},
-{ 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0D, 0x0A},
-{ 0x04, 0x04, 0x04, 0x04, 0x04, 0x0A, 0x0A, 0x0A},
-{ 0x01, 0x01, 0x62, 0x0A, 0x63, 0x63, 0x63, 0x0A},
-{ 0x64, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01},
-{ 0x01, 0x01, 0x01, 0x42, 0x12, 0x12, 0x12, 0x12},
-{ 0x0C, 0x14, 0x14, 0x14, 0x65, 0x0A, 0x0A, 0x0A},
-{ 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0D, 0x01},
-{ 0x01, 0x06, 0x24, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0x01, 0x06, 0x19, 0x0D, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0x01, 0x06, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0x0D, 0x06, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0x01, 0x01, 0x06, 0x10, 0x06, 0x06, 0x06, 0x01},
-{ 0x01, 0x01, 0x01, 0x19, 0x10, 0x06, 0x06, 0x06},
-{ 0x06, 0x06, 0x01, 0x01, 0x01, 0x01, 0x10, 0x0A},
-{ 0x01, 0x01, 0x01, 0x01, 0x01, 0x0A, 0x0A, 0x0A},
-{ 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x06, 0x24},
-{ 0x01, 0x01, 0x01, 0x01, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0x01, 0x01, 0x10, 0x19, 0x01, 0x01, 0x01, 0x01},
-{ 0x01, 0x01, 0x01, 0x01, 0x10, 0x49, 0x0A, 0x0A},
-{ 0x12, 0x12, 0x12, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0C, 0x65},
-{ 0x06, 0x19, 0x01, 0x10, 0x19, 0x01, 0x0A, 0x0A},
-{ 0x01, 0x19, 0x01, 0x01, 0x10, 0x06, 0x0A, 0x0A},
-{ 0x0D, 0x0A, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01},
-{ 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0A},
-{ 0x04, 0x04, 0x04, 0x04, 0x04, 0x12, 0x0A, 0x0A},
-{ 0x04, 0x04, 0x04, 0x04, 0x04, 0x2A, 0x0A, 0x04},
-{ 0x04, 0x04, 0x04, 0x1B, 0x66, 0x1B, 0x0A, 0x04},
-{ 0x12, 0x12, 0x12, 0x67, 0x28, 0x28, 0x28, 0x68},
-{ 0x67, 0x67, 0x29, 0x28, 0x28, 0x28, 0x67, 0x12},
-{ 0x12, 0x29, 0x28, 0x28, 0x28, 0x28, 0x68, 0x69},
-{ 0x12, 0x12, 0x12, 0x12, 0x12, 0x0A, 0x0A, 0x0A},
-{ 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x0A},
-{ 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6B},
-{ 0x26, 0x26, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05},
-{ 0x05, 0x05, 0x6C, 0x26, 0x26, 0x6C, 0x6C, 0x05},
-{ 0x05, 0x6C, 0x05, 0x05, 0x05, 0x05, 0x0A, 0x0A},
-{ 0x26, 0x26, 0x05, 0x05, 0x05, 0x05, 0x27, 0x0A},
-{ 0x1E, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09},
-{ 0x09, 0x1E, 0x1E, 0x09, 0x1E, 0x6D, 0x37, 0x09},
-{ 0x09, 0x09, 0x09, 0x09, 0x09, 0x31, 0x31, 0x31},
-{ 0x13, 0x13, 0x13, 0x39, 0x2C, 0x13, 0x2B, 0x2B},
-{ 0x2C, 0x13, 0x0A, 0x0A, 0x0A, 0x0A, 0x13, 0x13},
-{ 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x1E, 0x1E},
-{ 0x1E, 0x1E, 0x09, 0x1E, 0x0A, 0x4C, 0x09, 0x09},
-{ 0x09, 0x09, 0x09, 0x09, 0x09, 0x0A, 0x4C, 0x09},
-{ 0x34, 0x34, 0x34, 0x34, 0x6E, 0x0A, 0x0A, 0x0A},
-{ 0x31, 0x31, 0x31, 0x31, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0x28, 0x67, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28},
-{ 0x67, 0x28, 0x28, 0x28, 0x67, 0x12, 0x29, 0x12},
-{ 0x12, 0x6F, 0x70, 0x71, 0x6A, 0x0A, 0x0A, 0x0A},
-{ 0x07, 0x07, 0x26, 0x26, 0x26, 0x72, 0x1E, 0x1E},
-{ 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E},
-{ 0x1E, 0x1E, 0x1E, 0x73, 0x6A, 0x6A, 0x6A, 0x6A},
-{ 0x6A, 0x6A, 0x6A, 0x47, 0x47, 0x74, 0x75, 0x26},
-{ 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x09},
-{ 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x09, 0x09},
-{ 0x01, 0x01, 0x01, 0x0A, 0x01, 0x01, 0x01, 0x0A},
-{ 0x01, 0x01, 0x01, 0x01, 0x0E, 0x0E, 0x0E, 0x0E},
-{ 0x01, 0x01, 0x0D, 0x01, 0x01, 0x01, 0x01, 0x01},
-{ 0x01, 0x01, 0x0A, 0x01, 0x01, 0x01, 0x0E, 0x01},
-{ 0x0A, 0x01, 0x0D, 0x01, 0x01, 0x01, 0x01, 0x0D},
-{ 0x01, 0x01, 0x01, 0x01, 0x01, 0x06, 0x06, 0x19},
-{ 0x01, 0x01, 0x03, 0x21, 0x04, 0x04, 0x04, 0x21},
-{ 0x06, 0x06, 0x48, 0x76, 0x76, 0x06, 0x06, 0x06},
-{ 0x01, 0x0A, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01},
-{ 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0D},
-{ 0x04, 0x04, 0x77, 0x13, 0x13, 0x13, 0x2D, 0x0A},
-{ 0x01, 0x04, 0x04, 0x12, 0x3A, 0x78, 0x14, 0x79},
-{ 0x06, 0x06, 0x06, 0x06, 0x06, 0x1A, 0x26, 0x26},
-{ 0x48, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x21, 0x01},
-{ 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x7A, 0x7B},
-{ 0x12, 0x64, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01},
-{ 0x01, 0x01, 0x7B, 0x09, 0x58, 0x63, 0x0A, 0x0A},
-{ 0x01, 0x01, 0x01, 0x01, 0x01, 0x5D, 0x01, 0x01},
-{ 0x01, 0x01, 0x01, 0x01, 0x7C, 0x7D, 0x01, 0x01},
-{ 0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x05, 0x05},
-{ 0x05, 0x05, 0x05, 0x05, 0x7E, 0x7F, 0x80, 0x13},
-{ 0x80, 0x81, 0x14, 0x14, 0x14, 0x82, 0x34, 0x83},
-{ 0x01, 0x01, 0x01, 0x0D, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x7C, 0x7D},
-{ 0x01, 0x01, 0x5D, 0x01, 0x21, 0x01, 0x01, 0x01},
-{ 0x01, 0x01, 0x01, 0x01, 0x5D, 0x5D, 0x5D, 0x5D},
-{ 0x5D, 0x5D, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01},
-{ 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x84},
-{ 0x01, 0x84, 0x04, 0x04, 0x04, 0x04, 0x85, 0x12},
-{ 0x7C, 0x04, 0x04, 0x04, 0x04, 0x86, 0x04, 0x04},
-{ 0x04, 0x7B, 0x09, 0x09, 0x09, 0x09, 0x87, 0x88},
-{ 0x09, 0x09, 0x5E, 0x12, 0x12, 0x12, 0x12, 0x89},
-{ 0x12, 0x12, 0x88, 0x12, 0x12, 0x12, 0x12, 0x12},
-{ 0x12, 0x8A, 0x13, 0x13, 0x12, 0x88, 0x12, 0x12},
-{ 0x12, 0x5E, 0x8B, 0x12, 0x12, 0x88, 0x8B, 0x12},
-{ 0x4B, 0x01, 0x8C, 0x01, 0x01, 0x7F, 0x01, 0x01},
-{ 0x01, 0x01, 0x01, 0x01, 0x8D, 0x01, 0x01, 0x01},
-{ 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x8D, 0x8D},
-{ 0x01, 0x8C, 0x7F, 0x8E, 0x01, 0x01, 0x01, 0x50},
-{ 0x01, 0x01, 0x8C, 0x7F, 0x01, 0x01, 0x01, 0x01},
-{ 0x8D, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x8C},
-{ 0x04, 0x04, 0x04, 0x7A, 0x05, 0x8F, 0x90, 0x13},
-{ 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x04},
-{ 0x04, 0x04, 0x05, 0x05, 0x05, 0x91, 0x92, 0x09},
-{ 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x93, 0x14},
-{ 0x92, 0x09, 0x87, 0x12, 0x12, 0x14, 0x14, 0x14},
-{ 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14},
-{ 0x14, 0x14, 0x0A, 0x14, 0x14, 0x14, 0x14, 0x14},
-{ 0x14, 0x14, 0x14, 0x0A, 0x14, 0x14, 0x14, 0x14},
-{ 0x14, 0x14, 0x14, 0x14, 0x14, 0x0A, 0x15, 0x14},
-{ 0x14, 0x14, 0x14, 0x14, 0x65, 0x14, 0x14, 0x14},
-{ 0x14, 0x2F, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x63, 0x63},
-{ 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x41},
-{ 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x7B, 0x09},
-{ 0x94, 0x09, 0x05, 0x05, 0x09, 0x09, 0x09, 0x12},
-{ 0x04, 0x04, 0x04, 0x04, 0x04, 0x95, 0x12, 0x29},
-{ 0x28, 0x31, 0x0A, 0x0A, 0x96, 0x04, 0x04, 0x04},
-{ 0x04, 0x04, 0x04, 0x5B, 0x0A, 0x0A, 0x5B, 0x0A},
-{ 0x04, 0x04, 0x04, 0x31, 0x0A, 0x0A, 0x0A, 0x96},
-{ 0x2D, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x60},
-{ 0x04, 0x04, 0x04, 0x41, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0x04, 0x04, 0x04, 0x41, 0x04, 0x04, 0x04, 0x41},
-{ 0x04, 0x04, 0x04, 0x04, 0x09, 0x09, 0x04, 0x09},
-{ 0x58, 0x31, 0x31, 0x31, 0x31, 0x31, 0x14, 0x14},
-{ 0x14, 0x82, 0x83, 0x2E, 0x2E, 0x0A, 0x0A, 0x0A},
-{ 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x97, 0x5D, 0x5D},
-{ 0x5D, 0x5D, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0x5D, 0x5D, 0x5D, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x0A, 0x0A},
-{ 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x06, 0x06, 0x5D},
-{ 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x7D},
-{ 0x97, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D},
-{ 0x5D, 0x5D, 0x5D, 0x98, 0x17, 0x99, 0x5D, 0x5D},
-{ 0x0A, 0x0A, 0x97, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D},
-{ 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x9A, 0x9B},
-{ 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x98},
-{ 0x5D, 0x5D, 0x5D, 0x5D, 0x7F, 0x9C, 0x0A, 0x0A},
-{ 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86},
-{ 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D},
-{ 0x9D, 0x9D, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0x5D, 0x5D, 0x5E, 0x5E, 0x12, 0x12, 0x12, 0x12},
-{ 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x9E},
-{ 0x5D, 0x5D, 0x5D, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F},
-{ 0x5D, 0x5D, 0x5D, 0x86, 0x86, 0x86, 0x86, 0x86},
-{ 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x9D, 0x9D},
-{ 0x9D, 0x9D, 0x5E, 0x5E, 0x5E, 0x5E, 0xA0, 0xA1},
-{ 0xA1, 0xA1, 0xA1, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2},
-{ 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA3, 0x9F, 0x9F},
-{ 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F},
-{ 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x98, 0x0A},
-{ 0x5D, 0x5D, 0x5D, 0x98, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0A, 0x0A},
-{ 0x13, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x5A},
-{ 0x1E, 0x59, 0x37, 0x37, 0x37, 0x37, 0x1E, 0x09},
-{ 0x09, 0x09, 0x09, 0x09, 0x14, 0x14, 0x14, 0xA4},
-{ 0x28, 0x12, 0x12, 0x12, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0x04, 0x04, 0x04, 0x7A, 0x05, 0x7B, 0x09, 0x09},
-{ 0x05, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09},
-{ 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x3C, 0xA5},
-{ 0x13, 0x31, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14},
-{ 0x13, 0x13, 0x13, 0x13, 0x13, 0x30, 0x14, 0x6E},
-{ 0x14, 0x63, 0x63, 0x63, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0x0A, 0x0A, 0x0A, 0x15, 0x31, 0xA6, 0x09, 0x09},
-{ 0x04, 0x66, 0x04, 0x66, 0x04, 0x1B, 0x04, 0x04},
-{ 0x04, 0x04, 0x1B, 0x66, 0x04, 0x04, 0x0A, 0x0A},
-{ 0x05, 0x05, 0x05, 0x05, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0x09, 0x09, 0xA7, 0x0A, 0x0A, 0x0A, 0x0A, 0x09},
-{ 0x09, 0x09, 0x09, 0x09, 0x09, 0x0A, 0x0A, 0x0A},
-{ 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28},
-{ 0x28, 0x12, 0x12, 0x12, 0x12, 0x12, 0x63, 0x0A},
-{ 0x09, 0x09, 0x09, 0x1E, 0x1E, 0x1E, 0x1E, 0x09},
-{ 0x09, 0x09, 0x09, 0x5A, 0x1E, 0x1E, 0x1E, 0x1E},
-{ 0x1E, 0x09, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x4C},
-{ 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E},
-{ 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0xA8, 0x0A},
-{ 0x28, 0x67, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12},
-{ 0x12, 0x29, 0x12, 0x28, 0x28, 0x12, 0x67, 0x12},
-{ 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0xA9},
-{ 0x12, 0x12, 0x12, 0x12, 0x12, 0x0A, 0x0A, 0x12},
-{ 0x14, 0x14, 0xAA, 0x14, 0x14, 0x14, 0x14, 0x14},
-{ 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x65},
-{ 0x09, 0x09, 0x09, 0x09, 0x5A, 0x1E, 0x1E, 0x59},
-{ 0x5A, 0x59, 0x5A, 0x48, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0x09, 0x5A, 0x09, 0x09, 0x09, 0x09, 0x59, 0x0A},
-{ 0x09, 0x09, 0x09, 0x09, 0x09, 0x0A, 0x09, 0x09},
-{ 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0xAB, 0x14},
-{ 0x67, 0x28, 0x67, 0x29, 0x67, 0x12, 0x12, 0x28},
-{ 0x29, 0x2A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0xA9, 0x12, 0x12},
-{ 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x37, 0x31},
-{ 0x31, 0x31, 0x31, 0xAC, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0xAD, 0x13, 0x13, 0x2D, 0xAD, 0x13, 0x13, 0x2D},
-{ 0xAD, 0x13, 0x13, 0x2D, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0x13, 0x13, 0x13, 0x2D, 0x13, 0x13, 0x13, 0x2D},
-{ 0x63, 0x63, 0x14, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63},
-{ 0x12, 0x12, 0x29, 0x12, 0x67, 0x12, 0x29, 0x0A},
-{ 0x12, 0x12, 0x12, 0x2A, 0x0A, 0xA9, 0x12, 0x12},
-{ 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x0A, 0x0A},
-{ 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0xAE},
-{ 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0xAF, 0x5E, 0x9F},
-{ 0x86, 0x86, 0x86, 0x86, 0x86, 0x9F, 0x9F, 0x9F},
-{ 0x0A, 0x0E, 0x01, 0x01, 0x0A, 0x0A, 0x0E, 0x19},
-{ 0x01, 0x01, 0x01, 0x0D, 0x01, 0x01, 0x0D, 0x0D},
-{ 0x01, 0x0E, 0x0D, 0x01, 0x01, 0x01, 0x01, 0x01},
-{ 0x01, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13},
-{ 0x13, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0x0A, 0x0E, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01},
-{ 0x0A, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01},
-{ 0x86, 0x86, 0x86, 0x86, 0x86, 0x0A, 0x0A, 0x0A},
-{ 0x06, 0x06, 0x1E, 0x73, 0x6A, 0x6A, 0x6A, 0xB0},
-{ 0x5D, 0x98, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D},
-{ 0x5D, 0x5D, 0x5D, 0x98, 0x5D, 0x5D, 0x0A, 0x0A},
-{ 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0D, 0x17},
-{ 0x7D, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01},
-{ 0x0A, 0x01, 0x01, 0x01, 0x0A, 0x01, 0x01, 0x01},
-{ 0x0A, 0x01, 0x01, 0x01, 0x0A, 0x01, 0x0D, 0x0A},
-{ 0x5D, 0x5D, 0x5D, 0x98, 0x01, 0x01, 0x01, 0x0D},
-{ 0x0A, 0x0A, 0x0A, 0x0A, 0x17, 0x06, 0x01, 0x01},
-{ 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0E, 0x01},
-{ 0x01, 0x01, 0x01, 0x01, 0x01, 0x0D, 0x01, 0x0E},
-{ 0x01, 0x0D, 0x0A, 0x0E, 0x01, 0x01, 0x01, 0x01},
-{ 0x01, 0x01, 0x0A, 0x0E, 0x01, 0x01, 0x01, 0x01},
-{ 0x04, 0x04, 0x04, 0x04, 0x04, 0xB1, 0x82, 0x6E},
-{ 0x65, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x5A, 0x0A},
-{ 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x49, 0x0A},
-{ 0x49, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0xAB, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14},
-{ 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x0A, 0x0A},
-{ 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0C},
-{ 0x01, 0x01, 0x0A, 0x0A, 0x0A, 0x0A, 0xB2, 0x2E},
-{ 0x14, 0x14, 0x14, 0x6A, 0x6A, 0x6B, 0x0A, 0x0A},
-{ 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0E},
-{ 0x04, 0x04, 0x0A, 0x0A, 0x04, 0x04, 0x04, 0x04},
-{ 0x04, 0x04, 0x04, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34},
-{ 0x34, 0x34, 0x0A, 0x0A, 0x34, 0x34, 0x34, 0x34},
-{ 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x0A, 0x0A},
-{ 0x14, 0x14, 0x14, 0x14, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0x14, 0x14, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x15},
-{ 0x14, 0x14, 0x14, 0x65, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0x14, 0x14, 0x14, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0x01, 0x01, 0x01, 0x0A, 0x0D, 0x01, 0x01, 0x01},
-{ 0x01, 0x01, 0x01, 0x0E, 0x0D, 0x0A, 0x0D, 0x0E},
-{ 0x12, 0x12, 0x12, 0xA9, 0x12, 0x12, 0x12, 0x12},
-{ 0x0A, 0x0A, 0x0A, 0x15, 0x14, 0x14, 0x14, 0x14},
-{ 0x63, 0x33, 0x63, 0x0A, 0x0A, 0x46, 0x63, 0x63},
-{ 0x05, 0x05, 0x05, 0x05, 0x05, 0x12, 0x0A, 0x4E},
-{ 0x09, 0x09, 0x09, 0x09, 0x09, 0x0A, 0x0A, 0x4C},
-{ 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31},
-{ 0x31, 0x31, 0x31, 0x31, 0x0A, 0x0A, 0x63, 0x31},
-{ 0x0A, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63},
-{ 0x1B, 0x07, 0xB3, 0xB4, 0x0A, 0x0A, 0x07, 0x07},
-{ 0x04, 0x04, 0x96, 0x04, 0x96, 0x04, 0x04, 0x04},
-{ 0x04, 0x04, 0x0A, 0x0A, 0x07, 0xB4, 0x0A, 0xB3},
-{ 0x04, 0x04, 0x04, 0x04, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0x04, 0x04, 0x04, 0x04, 0x41, 0x0A, 0x0A, 0x0A},
-{ 0x14, 0x14, 0xAA, 0x6B, 0x0A, 0x15, 0x14, 0x14},
-{ 0x12, 0x12, 0x12, 0x0A, 0xA9, 0x12, 0x12, 0x12},
-{ 0x12, 0x12, 0x12, 0x0A, 0x12, 0x12, 0x12, 0x12},
-{ 0x12, 0x2A, 0x0A, 0x0A, 0x12, 0x12, 0x12, 0x12},
-{ 0x14, 0x0A, 0x0A, 0x0A, 0x15, 0x14, 0x65, 0x0A},
-{ 0x0A, 0x0A, 0x0A, 0x0A, 0x15, 0x14, 0x14, 0x14},
-{ 0x12, 0x12, 0x12, 0x12, 0x2A, 0x0A, 0x0A, 0x0A},
-{ 0x63, 0x33, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0x63, 0x33, 0x0A, 0x0A, 0x0A, 0x63, 0x63, 0x63},
-{ 0x2B, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13},
-{ 0x13, 0x13, 0x13, 0x13, 0x2C, 0x2C, 0x2C, 0x2C},
-{ 0x2C, 0x2C, 0x2C, 0x39, 0x13, 0x13, 0x13, 0x0A},
-{ 0x0A, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13},
-{ 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0xB5},
-{ 0x28, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12},
-{ 0x12, 0x29, 0x28, 0x67, 0x29, 0x67, 0x29, 0x12},
-{ 0x12, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0x31, 0x31, 0x31, 0x31, 0xB6, 0x0A, 0x0A, 0x0A},
-{ 0x31, 0x31, 0x31, 0x31, 0x31, 0x0A, 0x0A, 0x0A},
-{ 0x37, 0x70, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31},
-{ 0x31, 0x31, 0x31, 0xB7, 0x37, 0x37, 0xB7, 0x37},
-{ 0x37, 0x37, 0xAC, 0x31, 0x31, 0x31, 0x31, 0x31},
-{ 0x31, 0x31, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0x14, 0xAA, 0x14, 0x65, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0x37, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31},
-{ 0x31, 0x31, 0x31, 0x37, 0x37, 0x37, 0x37, 0x70},
-{ 0x31, 0x31, 0x31, 0x31, 0xB8, 0xB0, 0xB9, 0x0A},
-{ 0x31, 0x31, 0x31, 0x31, 0x31, 0x32, 0x63, 0x63},
-{ 0x15, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14},
-{ 0x14, 0x14, 0x65, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0x14, 0x15, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14},
-{ 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0xAA},
-{ 0x6A, 0x14, 0xAB, 0x6A, 0x14, 0x14, 0x14, 0xBA},
-{ 0x63, 0x63, 0x63, 0x33, 0x33, 0x63, 0x63, 0x46},
-{ 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x46},
-{ 0x63, 0x63, 0x63, 0x63, 0x63, 0x0A, 0x0A, 0x0A},
-{ 0x14, 0xAA, 0x6A, 0x6A, 0x6A, 0x6B, 0x0A, 0x0A},
-{ 0x14, 0x14, 0x14, 0x14, 0x14, 0x0A, 0x0A, 0x0A},
-{ 0xBB, 0x14, 0x15, 0x14, 0x14, 0x14, 0x65, 0x15},
-{ 0x65, 0x15, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14},
-{ 0x65, 0x14, 0x15, 0x14, 0x14, 0x0A, 0xAB, 0x14},
-{ 0xAB, 0x14, 0x65, 0x15, 0x65, 0x15, 0x14, 0x0A},
-{ 0x33, 0x0A, 0x0A, 0x15, 0x0A, 0x0A, 0x15, 0x14},
-{ 0x14, 0x14, 0x0A, 0x6A, 0x6A, 0x6A, 0x6B, 0x0A},
-{ 0x6A, 0x6A, 0x6B, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0x34, 0x34, 0x34, 0x34, 0x35, 0x35, 0x35, 0x35},
-{ 0x34, 0x35, 0xBC, 0xBC, 0x34, 0x34, 0x34, 0x34},
-{ 0x34, 0x34, 0x34, 0x34, 0x34, 0xBD, 0xBD, 0x0A},
-{ 0x14, 0xAA, 0x6A, 0x6A, 0xAB, 0xAB, 0x14, 0xAA},
-{ 0xAB, 0x6A, 0x14, 0x14, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0x14, 0x6A, 0x6A, 0x0A, 0x14, 0x14, 0x6A, 0xAA},
-{ 0xAB, 0x14, 0x14, 0x14, 0x14, 0x63, 0x63, 0x63},
-{ 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0xB0, 0x0A},
-{ 0x14, 0xAA, 0x6A, 0x6A, 0x6A, 0xAB, 0xAA, 0xAA},
-{ 0xAB, 0x14, 0x65, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x6E, 0x0A},
-{ 0x31, 0x31, 0x31, 0x31, 0x31, 0xB7, 0xB7, 0x31},
-{ 0x37, 0x37, 0x37, 0xB7, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0x63, 0x63, 0x63, 0x63, 0x63, 0x0A, 0xBE, 0xB0},
-{ 0x63, 0xB0, 0xB0, 0xBF, 0xB0, 0xB0, 0x0A, 0x0A},
-{ 0x14, 0x65, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x15},
-{ 0xC0, 0x47, 0x47, 0xC1, 0xC0, 0xC1, 0x2E, 0x2E},
-{ 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E},
-{ 0x2E, 0xC0, 0x47, 0x47, 0xC1, 0xC0, 0x47, 0xC1},
-{ 0x2E, 0x2E, 0x2E, 0xC0, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0xC0, 0x47, 0x47, 0xC1, 0xC0, 0x47, 0x2E, 0x2E},
-{ 0x2E, 0x2E, 0x0A, 0x2E, 0x2E, 0x47, 0x47, 0x47},
-{ 0x47, 0x47, 0x47, 0xC1, 0x47, 0x2E, 0x2F, 0x2E},
-{ 0x2E, 0x2F, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0x14, 0x14, 0x14, 0x14, 0x65, 0x0A, 0x0A, 0x0A},
-{ 0x34, 0x34, 0x34, 0x34, 0x6E, 0x34, 0x34, 0x34},
-{ 0x35, 0x35, 0x35, 0xBA, 0x35, 0x35, 0x35, 0x34},
-{ 0x34, 0x34, 0x34, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0x0A, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35},
-{ 0x35, 0x35, 0x35, 0x35, 0xBD, 0x35, 0x35, 0x35},
-{ 0xBC, 0x35, 0xC2, 0xBA, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0x2E, 0x2E, 0x2E, 0x2F, 0x2E, 0xB2, 0x2E, 0x2E},
-{ 0xC0, 0x47, 0x47, 0xC3, 0x0A, 0xC3, 0x47, 0xC4},
-{ 0x47, 0x47, 0x47, 0xC0, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x0A, 0x0A, 0x0A},
-{ 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0xC5},
-{ 0x14, 0x14, 0x14, 0x14, 0x32, 0x0A, 0x0A, 0x0A},
-{ 0x05, 0xC5, 0x14, 0x14, 0x14, 0x14, 0x14, 0x65},
-{ 0x05, 0x05, 0x65, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0x63, 0x63, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0x63, 0x63, 0x63, 0x33, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0x13, 0x13, 0x13, 0x13, 0x2D, 0x0A, 0x0A, 0x0A},
-{ 0x14, 0x14, 0x14, 0x14, 0x14, 0x0A, 0x0A, 0x14},
-{ 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x0A},
-{ 0x6A, 0x6A, 0xAB, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0x6A, 0x6A, 0x6A, 0xAB, 0x14, 0x14, 0x14, 0x14},
-{ 0x14, 0x14, 0x14, 0x14, 0x14, 0x15, 0x14, 0x14},
-{ 0x14, 0x14, 0x14, 0x14, 0x0A, 0x0A, 0x15, 0x14},
-{ 0x31, 0x31, 0xB6, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0xB6},
-{ 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0xC6},
-{ 0xC7, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8},
-{ 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC9, 0x0A},
-{ 0xC8, 0xC9, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0x7F, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2},
-{ 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2},
-{ 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0x9B},
-{ 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0x0A, 0x0A},
-{ 0x14, 0x14, 0x14, 0x14, 0x14, 0x65, 0x0A, 0x0A},
-{ 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x65, 0x0A},
-{ 0x14, 0x14, 0x14, 0x14, 0x14, 0x0A, 0xAA, 0xAB},
-{ 0x6A, 0x6A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0x01, 0x01, 0x01, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0x01, 0x01, 0x01, 0x0D, 0x4C, 0x01, 0x01, 0x01},
-{ 0x01, 0x01, 0x01, 0x10, 0x06, 0x01, 0x01, 0x01},
-{ 0x01, 0x10, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06},
-{ 0x06, 0x19, 0x10, 0x06, 0x06, 0x06, 0x01, 0x01},
-{ 0x01, 0x01, 0x01, 0x01, 0x01, 0x06, 0x06, 0x01},
-{ 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x63},
-{ 0x63, 0x63, 0x63, 0x63, 0x33, 0x0A, 0x0A, 0x0A},
-{ 0x04, 0x07, 0x66, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0x05, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0x0A, 0x0D, 0x0E, 0x0D, 0x0E, 0x01, 0x0D, 0x01},
-{ 0x01, 0x01, 0x01, 0x01, 0x01, 0x0E, 0x0E, 0x01},
-{ 0x01, 0x01, 0x0E, 0x01, 0x01, 0x01, 0x01, 0x01},
-{ 0x01, 0x01, 0x01, 0x0E, 0x01, 0x0D, 0x0E, 0x01},
-{ 0x01, 0x01, 0x0D, 0x01, 0x01, 0x01, 0x0D, 0x01},
-{ 0x01, 0x01, 0x01, 0x01, 0x01, 0x0E, 0x01, 0x0D},
-{ 0x01, 0x01, 0x0D, 0x0D, 0x0A, 0x01, 0x01, 0x01},
-{ 0x01, 0x01, 0x04, 0x0A, 0x01, 0x01, 0x01, 0x01},
-{ 0x01, 0x01, 0x01, 0x01, 0x01, 0x05, 0x0A, 0x01},
-{ 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0},
-{ 0xB0, 0xB0, 0xB0, 0xCA, 0x63, 0xBF, 0xB0, 0xB0},
-{ 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xCA, 0x63},
-{ 0x63, 0x63, 0xBF, 0x63, 0x63, 0x63, 0x63, 0x63},
-{ 0x63, 0x63, 0xCA, 0x63, 0x63, 0x63, 0x0A, 0x0A},
-{ 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0xBE, 0xB0, 0xB0},
-{ 0xBE, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0},
-{ 0x35, 0x35, 0x35, 0xBA, 0x35, 0x35, 0x35, 0x35},
-{ 0x35, 0x35, 0x35, 0x35, 0xBA, 0x74, 0x35, 0x35},
-{ 0x35, 0x74, 0xBA, 0x35, 0x35, 0xBA, 0x0A, 0x0A},
-{ 0x14, 0x14, 0x65, 0x15, 0x14, 0x14, 0x14, 0x14},
-{ 0x6A, 0x6A, 0x6A, 0x6B, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0x34, 0x34, 0x35, 0x35, 0x35, 0xBA, 0x0A, 0x0A},
-{ 0x34, 0x34, 0x34, 0x34, 0x34, 0x0A, 0x0A, 0x34},
-{ 0x31, 0x31, 0x5B, 0x31, 0x31, 0x31, 0x31, 0x31},
-{ 0x5B, 0xB6, 0xB6, 0x5B, 0x5B, 0x31, 0x31, 0x31},
-{ 0x31, 0xB6, 0x31, 0x31, 0x5B, 0x5B, 0x0A, 0x0A},
-{ 0x0A, 0xB6, 0x0A, 0x5B, 0x5B, 0x5B, 0x5B, 0x31},
-{ 0x5B, 0xB6, 0xB6, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B},
-{ 0x5B, 0xB6, 0xB6, 0x5B, 0x31, 0xB6, 0x31, 0x31},
-{ 0x31, 0xB6, 0x31, 0x31, 0x5B, 0x31, 0xB6, 0xB6},
-{ 0x31, 0x31, 0x31, 0x31, 0x31, 0x5B, 0x31, 0x31},
-{ 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x0A, 0x0A},
-{ 0x5B, 0x31, 0x5B, 0x31, 0x31, 0x5B, 0x31, 0x31},
-{ 0x31, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0x09, 0x09, 0x92, 0x09, 0x09, 0x09, 0x09, 0x09},
-{ 0x09, 0x09, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x2D},
-{ 0xAD, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0xCB},
-{ 0xAD, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x81},
-{ 0xAD, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13},
-{ 0x12, 0x12, 0x12, 0x12, 0x12, 0xCC, 0x65, 0x0A},
-{ 0x8A, 0x13, 0x13, 0x13, 0x13, 0x13, 0x8A, 0x8A},
-{ 0x13, 0x3A, 0x13, 0x3A, 0x13, 0x12, 0x12, 0x3A},
-{ 0x13, 0x13, 0x13, 0x8A, 0x13, 0x13, 0x13, 0x8A},
-{ 0x13, 0x13, 0x13, 0x13, 0x13, 0x31, 0x0A, 0x0A},
-{ 0x13, 0x13, 0x13, 0x13, 0x8A, 0x8A, 0x3A, 0x8A},
-{ 0x13, 0x13, 0x13, 0x13, 0x13, 0x12, 0x12, 0x80},
-{ 0x7E, 0x7F, 0x7F, 0x7F, 0x7F, 0xCD, 0x34, 0x34},
-{ 0x0A, 0x0A, 0x0A, 0x13, 0x13, 0x13, 0x13, 0x13},
-{ 0xCE, 0x9C, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0x5E, 0x7F, 0x7F, 0x7F, 0x7F, 0xCF, 0x0A, 0x0A},
-{ 0x5E, 0x5E, 0x5E, 0x5E, 0xA8, 0x0A, 0x0A, 0x0A},
-{ 0x7F, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0xA2, 0xA2, 0xA2, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F},
-{ 0xD0, 0x14, 0x14, 0x14, 0x14, 0x14, 0xD1, 0xA1},
-{ 0x7F, 0x7F, 0x7F, 0xD2, 0x7F, 0x7F, 0x7F, 0x7F},
-{ 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0xD0, 0xA1},
-{ 0x7F, 0x7F, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14},
-{ 0x7F, 0x7F, 0xD3, 0x7F, 0x7F, 0xD0, 0x14, 0xD1},
-{ 0xA1, 0xA1, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14},
-{ 0xD0, 0x14, 0xD4, 0x14, 0xA1, 0xA1, 0xA1, 0xA1},
-{ 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0xD0},
-{ 0xD0, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F},
-{ 0x7F, 0x7F, 0x7F, 0x7F, 0xD5, 0x7F, 0xD0, 0xD1},
-{ 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x14},
-{ 0x31, 0x31, 0x14, 0x14, 0x14, 0xD1, 0xA1, 0xD6},
-{ 0x7F, 0x7F, 0x7F, 0x7F, 0x14, 0x14, 0x14, 0x14},
-{ 0x14, 0x14, 0x14, 0x14, 0x14, 0xD7, 0x14, 0x14},
-{ 0x14, 0x14, 0xD8, 0xD4, 0x14, 0x14, 0x14, 0x14},
-{ 0x14, 0x14, 0xD7, 0x14, 0x14, 0x14, 0x14, 0x14},
-{ 0x14, 0x14, 0x14, 0x14, 0x14, 0xD2, 0x7F, 0x7F},
-{ 0xD9, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F},
-{ 0xDA, 0x7F, 0xDA, 0xDA, 0xDA, 0xDA, 0x7F, 0xDA},
-{ 0x7F, 0x7F, 0x7F, 0xAE, 0x7F, 0x7F, 0xD9, 0xAE},
-{ 0x7F, 0x7F, 0xD9, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F},
-{ 0xD3, 0xDB, 0xDC, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F},
-{ 0x7F, 0x7F, 0x7F, 0x14, 0x14, 0x14, 0xD4, 0x14},
-{ 0xDD, 0xDE, 0x2F, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0x14, 0x14, 0x14, 0x14, 0x14, 0xD8, 0xDF, 0x0A},
-{ 0x14, 0x14, 0xC8, 0xC7, 0x9B, 0x0A, 0x0A, 0x0A},
-{ 0x13, 0x13, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x0A, 0x0A},
-{ 0xA1, 0xA1, 0xA1, 0xA1, 0xDD, 0xC8, 0xC8, 0xC7},
-{ 0xC8, 0xC8, 0xC8, 0xC8, 0xA2, 0xA2, 0xA2, 0xA2},
-{ 0xC7, 0xE0, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC9},
-{ 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0x9B, 0x0A},
-{ 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC7},
-{ 0xA1, 0xA1, 0xDD, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8},
-{ 0xC8, 0xA2, 0xA2, 0xA2, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0xE1, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0xA2, 0xA2, 0xA2, 0x9B, 0x0A, 0x0A, 0x0A, 0x0A},
-{ 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x01},
-{ 0x5D, 0x5D, 0x5D, 0xE2, 0x9F, 0x9F, 0x9F, 0x9F},
-{ 0x5E, 0x5E, 0xE3, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F},
-{ 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x9F},
-{ 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1},
-{ 0xA1, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F},
-{ 0xA3, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F},
-{ 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x9F},
-{ 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x01},
-{ 0x17, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A}
+const uint16_t _t3_window_chardata_blocks[0x8200] = {
+  /* Block 0x00 */
+  0x1900, 0x1900, 0x1900, 0x1900, 0x1900, 0x1900, 0x1900, 0x1900, 0x1900, 0x1900, 0x1100, 0x1900,
+  0x1900, 0x0900, 0x1900, 0x1900, 0x1900, 0x1900, 0x1900, 0x1900, 0x1900, 0x1900, 0x1900, 0x1900,
+  0x1900, 0x1900, 0x1900, 0x1900, 0x1900, 0x1900, 0x1900, 0x1900, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x1900,
+  /* Block 0x01 */
+  0x1900, 0x1900, 0x1900, 0x1900, 0x1900, 0x1900, 0x1900, 0x1900, 0x1900, 0x1900, 0x1900, 0x1900,
+  0x1900, 0x1900, 0x1900, 0x1900, 0x1900, 0x1900, 0x1900, 0x1900, 0x1900, 0x1900, 0x1900, 0x1900,
+  0x1900, 0x1900, 0x1900, 0x1900, 0x1900, 0x1900, 0x1900, 0x1900, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x8080, 0x0080, 0x0080, 0x0080, 0x1980, 0x8080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  /* Block 0x02 */
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  /* Block 0x03 */
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  /* Block 0x04 */
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081,
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  /* Block 0x05 */
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  /* Block 0x06 */
+  0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240,
+  0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240,
+  0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240,
+  0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240,
+  0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240,
+  0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240,
+  0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240,
+  0x2240, 0x2240, 0x2240, 0x2240, 0x2241, 0x2241, 0x2241, 0x2241, 0x2241, 0x2240, 0x2240, 0x2240,
+  0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240,
+  0x2240, 0x2240, 0x2240, 0x2240, 0x0083, 0x0083, 0x0083, 0x0083, 0x0080, 0x0080, 0x0083, 0x0083,
+  0x04BF, 0x04BF, 0x0080, 0x0082, 0x0082, 0x0082, 0x0080, 0x0089,
+  /* Block 0x07 */
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x04BF,
+  0x0080, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x04BF, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0083, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0081, 0x0081, 0x0081, 0x0081,
+  /* Block 0x08 */
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  /* Block 0x09 */
+  0x0080, 0x0080, 0x0080, 0x2240, 0x2240, 0x2240, 0x2240, 0x2243, 0x2240, 0x2240, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0082, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0081, 0x0081,
+  0x0080, 0x0080, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  /* Block 0x0A */
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0082, 0x0082, 0x0082, 0x0082, 0x0083, 0x0083, 0x0083, 0x0083,
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  0x0084, 0x0084, 0x0085, 0x0085, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x04BF, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  /* Block 0x0B */
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x04BF, 0x0080, 0x0080, 0x04BF,
+  0x04BF, 0x0089, 0x0089, 0x0086, 0x04BF, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240,
+  0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2241, 0x2240,
+  0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240,
+  0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2242, 0x2240,
+  0x2240, 0x2240, 0x0080, 0x2240, 0x0080, 0x2240, 0x2240, 0x0080, 0x2240, 0x2241, 0x0081, 0x2241,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0x0C */
+  0x3940, 0x3940, 0x3940, 0x3940, 0x3946, 0x3949, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0081,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2243, 0x2243,
+  0x2243, 0x2243, 0x2243, 0x0080, 0x1948, 0x04BF, 0x0081, 0x0080, 0x0085, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0083,
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240,
+  0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2241, 0x2241, 0x2241, 0x2241, 0x2241, 0x2241, 0x2245,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x2240, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  /* Block 0x0D */
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x3940, 0x0080, 0x2240,
+  0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x0080, 0x0080, 0x2240, 0x2240, 0x0080, 0x2240, 0x2240,
+  0x2240, 0x2240, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  /* Block 0x0E */
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x04BF, 0x3940, 0x0080, 0x2240, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240,
+  0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240,
+  0x2240, 0x2240, 0x2240, 0x04BF, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0081, 0x0081, 0x0081, 0x0081,
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081,
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081,
+  0x0081, 0x0081, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  /* Block 0x0F */
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240,
+  0x2240, 0x0080, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x2242,
+  0x2242, 0x2242, 0x2242, 0x2242, 0x2242, 0x2242, 0x2242, 0x2242, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x04BF, 0x04BF, 0x24BF, 0x04BF, 0x04BF,
+  /* Block 0x10 */
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x2244, 0x2244,
+  0x2244, 0x2244, 0x0084, 0x2244, 0x2244, 0x2244, 0x2244, 0x2244, 0x2244, 0x2244, 0x2244, 0x2244,
+  0x0084, 0x2244, 0x2244, 0x2244, 0x0084, 0x2244, 0x2244, 0x2244, 0x2244, 0x2244, 0x04BF, 0x04BF,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x04BF, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085,
+  0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085,
+  0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x2245, 0x2245, 0x2245, 0x04BF, 0x04BF, 0x0085, 0x04BF,
+  0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0x11 */
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x3CBF, 0x3CBF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x0086, 0x0089, 0x0086, 0x0086,
+  0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x008A, 0x008A, 0x04BF, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B,
+  0x008B, 0x008B, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF,
+  0x224B, 0x224B, 0x224B, 0x224B, 0x224B, 0x224B, 0x224B, 0x224B, 0x224B, 0x224B, 0x224B, 0x224B,
+  0x224B, 0x224B, 0x394B, 0x224A, 0x2246, 0x2246, 0x2246, 0x2246, 0x2246, 0x2246, 0x2246, 0x2246,
+  0x2246, 0x2246, 0x2246, 0x2246, 0x2246, 0x2246, 0x2246, 0x2246, 0x2246, 0x2246, 0x2246, 0x2246,
+  0x2246, 0x2246, 0x2246, 0x2246, 0x2246, 0x2246, 0x2246, 0x2249,
+  /* Block 0x12 */
+  0x2244, 0x2240, 0x2240, 0x4280, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x2245, 0x4285,
+  0x2240, 0x0080, 0x4280, 0x4280, 0x4280, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240,
+  0x2240, 0x4280, 0x4280, 0x4280, 0x4280, 0x2240, 0x4284, 0x4285, 0x0080, 0x2240, 0x2240, 0x2240,
+  0x2240, 0x2244, 0x2245, 0x2245, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x2240, 0x2240, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0083, 0x0083, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085,
+  0x0089, 0x0084, 0x0084, 0x0082, 0x0082, 0x0081, 0x0082, 0x0082,
+  /* Block 0x13 */
+  0x0089, 0x2240, 0x4280, 0x4280, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x04BF, 0x04BF, 0x0080, 0x0080, 0x04BF, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x04BF, 0x0080, 0x04BF, 0x04BF, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x04BF, 0x04BF,
+  0x2240, 0x0080, 0x2280, 0x4280, 0x4280, 0x2240, 0x2240, 0x2240, 0x2240, 0x04BF, 0x04BF, 0x4280,
+  0x4280, 0x04BF, 0x04BF, 0x4280, 0x4280, 0x2240, 0x0081, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x2280, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0080, 0x0080, 0x04BF, 0x0080,
+  0x0080, 0x0080, 0x2240, 0x2240, 0x04BF, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0084, 0x008C, 0x008C, 0x24BF, 0x04BF,
+  /* Block 0x14 */
+  0x04BF, 0x2240, 0x2240, 0x4280, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x0080, 0x0080, 0x04BF, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x04BF, 0x0080, 0x0080, 0x04BF, 0x0080, 0x0080, 0x04BF, 0x0080, 0x0080, 0x04BF, 0x04BF,
+  0x2240, 0x04BF, 0x4280, 0x4280, 0x4280, 0x2240, 0x2240, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x2240,
+  0x2240, 0x04BF, 0x04BF, 0x2240, 0x2240, 0x2240, 0x04BF, 0x04BF, 0x04BF, 0x2243, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x04BF, 0x0080, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x2240, 0x2240, 0x0080, 0x0080, 0x0080, 0x2243, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0x15 */
+  0x04BF, 0x2240, 0x2240, 0x4280, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x04BF, 0x0080, 0x0080, 0x0080, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x04BF, 0x0080, 0x0080, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x04BF, 0x04BF,
+  0x2240, 0x0080, 0x4280, 0x4280, 0x4280, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x04BF, 0x2240,
+  0x2240, 0x4280, 0x04BF, 0x4280, 0x4280, 0x2240, 0x04BF, 0x04BF, 0x0080, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x0080, 0x0080, 0x2240, 0x2240, 0x04BF, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0086, 0x0080, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x008A, 0x224C, 0x224C, 0x224C, 0x224C, 0x224C, 0x224C,
+  /* Block 0x16 */
+  0x04BF, 0x2240, 0x4280, 0x4280, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x04BF, 0x04BF, 0x0080, 0x0080, 0x04BF, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x04BF, 0x0080, 0x0080, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x04BF, 0x04BF,
+  0x2240, 0x0080, 0x2280, 0x2240, 0x4280, 0x2240, 0x2240, 0x2240, 0x2243, 0x04BF, 0x04BF, 0x4280,
+  0x4280, 0x04BF, 0x04BF, 0x4280, 0x4280, 0x2240, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x24BF, 0x2240, 0x2280, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0080, 0x0080, 0x04BF, 0x0080,
+  0x0080, 0x0080, 0x2243, 0x2243, 0x04BF, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0x17 */
+  0x04BF, 0x04BF, 0x2240, 0x0080, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x04BF,
+  0x04BF, 0x04BF, 0x0080, 0x0080, 0x0080, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x04BF, 0x04BF,
+  0x04BF, 0x0080, 0x0080, 0x04BF, 0x0080, 0x04BF, 0x0080, 0x0080, 0x04BF, 0x04BF, 0x04BF, 0x0080,
+  0x0080, 0x04BF, 0x04BF, 0x04BF, 0x0080, 0x0080, 0x0080, 0x04BF, 0x04BF, 0x04BF, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0081, 0x0080, 0x0080, 0x0080, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x2280, 0x4280, 0x2240, 0x4280, 0x4280, 0x04BF, 0x04BF, 0x04BF, 0x4280, 0x4280,
+  0x4280, 0x04BF, 0x4280, 0x4280, 0x4280, 0x2240, 0x04BF, 0x04BF, 0x0083, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x2280, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0081, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0x18 */
+  0x2249, 0x4280, 0x4280, 0x4280, 0x24BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x04BF, 0x0080, 0x0080, 0x0080, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0089, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x04BF, 0x04BF,
+  0x24BF, 0x0083, 0x2240, 0x2240, 0x2240, 0x4280, 0x4280, 0x4280, 0x4280, 0x04BF, 0x2240, 0x2240,
+  0x2240, 0x04BF, 0x2240, 0x2240, 0x2240, 0x2240, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x2240, 0x2240, 0x04BF, 0x0083, 0x0083, 0x008A, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x0080, 0x0080, 0x2243, 0x2243, 0x04BF, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  /* Block 0x19 */
+  0x008B, 0x2249, 0x4280, 0x4280, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x04BF, 0x0080, 0x0080, 0x0080, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x04BF, 0x04BF,
+  0x2240, 0x0080, 0x4280, 0x2280, 0x4280, 0x4280, 0x2280, 0x4280, 0x4280, 0x04BF, 0x2280, 0x4280,
+  0x4280, 0x04BF, 0x4280, 0x4280, 0x2240, 0x2240, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x2280, 0x2280, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0080, 0x04BF,
+  0x0080, 0x0080, 0x2242, 0x2242, 0x04BF, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x04BF, 0x0082, 0x0082, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0x1A */
+  0x224C, 0x2249, 0x4280, 0x4280, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x04BF, 0x0080, 0x0080, 0x0080, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0085, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0085, 0x224C,
+  0x224C, 0x0083, 0x2280, 0x4280, 0x4280, 0x2240, 0x2240, 0x2240, 0x2243, 0x04BF, 0x4280, 0x4280,
+  0x4280, 0x04BF, 0x4280, 0x4280, 0x4280, 0x2240, 0x3885, 0x008B, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x008B, 0x008B, 0x008B, 0x2280, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008A,
+  0x0080, 0x0080, 0x2243, 0x2243, 0x04BF, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x008B, 0x008B,
+  0x008B, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  /* Block 0x1B */
+  0x04BF, 0x24BF, 0x4280, 0x4280, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x04BF,
+  0x04BF, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x04BF, 0x0080, 0x04BF, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x04BF,
+  0x04BF, 0x04BF, 0x2240, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x2280, 0x4280, 0x4280, 0x2240, 0x2240,
+  0x2240, 0x04BF, 0x2240, 0x04BF, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x2280,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x04BF, 0x04BF, 0x4280, 0x4280, 0x0080, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0x1C */
+  0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x2240, 0x0080, 0x4080, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x2240,
+  0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0x1D */
+  0x04BF, 0x0080, 0x0080, 0x04BF, 0x0080, 0x04BF, 0x04BF, 0x0080, 0x0080, 0x04BF, 0x0080, 0x04BF,
+  0x04BF, 0x0080, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x04BF, 0x0080, 0x0080, 0x0080,
+  0x04BF, 0x0080, 0x04BF, 0x0080, 0x04BF, 0x04BF, 0x0080, 0x0080, 0x04BF, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x2240, 0x0080, 0x4080, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x24BF, 0x2240,
+  0x2240, 0x0080, 0x04BF, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x04BF, 0x0080, 0x04BF,
+  0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x04BF, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x04BF, 0x04BF, 0x0080, 0x0080, 0x0086, 0x0086,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0x1E */
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x2240, 0x2240, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x2240, 0x0080, 0x2240, 0x0080, 0x2240, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x4280, 0x4280, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0083,
+  0x0083, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240,
+  0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x4280,
+  /* Block 0x1F */
+  0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x0080, 0x2240, 0x2240, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0085, 0x2245, 0x2245, 0x2245, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240,
+  0x04BF, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240,
+  0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240,
+  0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240,
+  0x2240, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x2240, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x04BF, 0x0083, 0x0080, 0x0081, 0x0081, 0x0083, 0x0083,
+  0x0083, 0x0084, 0x0084, 0x0084, 0x0084, 0x0085, 0x0085, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0x20 */
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0083, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0083, 0x0080, 0x0080, 0x0283, 0x0280, 0x2240, 0x2240, 0x2240,
+  0x2240, 0x4280, 0x2240, 0x2243, 0x2243, 0x2243, 0x2240, 0x2240, 0x0280, 0x2240, 0x2243, 0x4283,
+  0x4283, 0x2243, 0x2243, 0x0083, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x4280, 0x4280, 0x2240, 0x2240, 0x0083, 0x0083, 0x0083, 0x0083, 0x2243, 0x2243,
+  0x2243, 0x0083, 0x0283, 0x0283, 0x0283, 0x0083, 0x0083, 0x0283, 0x0283, 0x0283, 0x0283, 0x0283,
+  0x0283, 0x0283, 0x0083, 0x0083, 0x0083, 0x2243, 0x2243, 0x2243, 0x2243, 0x0083, 0x0083, 0x0083,
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  /* Block 0x21 */
+  0x0083, 0x0083, 0x2243, 0x0283, 0x4283, 0x2243, 0x2243, 0x0283, 0x0283, 0x0283, 0x0283, 0x0283,
+  0x0283, 0x2243, 0x0083, 0x0283, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  0x0083, 0x0083, 0x0284, 0x0284, 0x0284, 0x2244, 0x0083, 0x0083, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x04BF, 0x0086,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0086, 0x04BF, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0081, 0x0081, 0x0080, 0x0081, 0x0086, 0x0086, 0x0086,
+  /* Block 0x22 */
+  0x48C0, 0x48C0, 0x48C0, 0x48C0, 0x48C0, 0x48C0, 0x48C0, 0x48C0, 0x48C0, 0x48C0, 0x48C0, 0x48C0,
+  0x48C0, 0x48C0, 0x48C0, 0x48C0, 0x48C0, 0x48C0, 0x48C0, 0x48C0, 0x48C0, 0x48C0, 0x48C0, 0x48C0,
+  0x48C0, 0x48C0, 0x48C0, 0x48C0, 0x48C0, 0x48C0, 0x48C0, 0x48C0, 0x48C0, 0x48C0, 0x48C0, 0x48C0,
+  0x48C0, 0x48C0, 0x48C0, 0x48C0, 0x48C0, 0x48C0, 0x48C0, 0x48C0, 0x48C0, 0x48C0, 0x48C0, 0x48C0,
+  0x48C0, 0x48C0, 0x48C0, 0x48C0, 0x48C0, 0x48C0, 0x48C0, 0x48C0, 0x48C0, 0x48C0, 0x48C0, 0x48C0,
+  0x48C0, 0x48C0, 0x48C0, 0x48C0, 0x48C0, 0x48C0, 0x48C0, 0x48C0, 0x48C0, 0x48C0, 0x48C0, 0x48C0,
+  0x48C0, 0x48C0, 0x48C0, 0x48C0, 0x48C0, 0x48C0, 0x48C0, 0x48C0, 0x48C0, 0x48C0, 0x48C0, 0x48C0,
+  0x48C0, 0x48C0, 0x48C0, 0x48C0, 0x48C0, 0x48C0, 0x48C4, 0x48C4, 0x48C4, 0x48C4, 0x48C4, 0x48C0,
+  0x5080, 0x5080, 0x5080, 0x5080, 0x5080, 0x5080, 0x5080, 0x5080, 0x5080, 0x5080, 0x5080, 0x5080,
+  0x5080, 0x5080, 0x5080, 0x5080, 0x5080, 0x5080, 0x5080, 0x5080, 0x5080, 0x5080, 0x5080, 0x5080,
+  0x5080, 0x5080, 0x5080, 0x5080, 0x5080, 0x5080, 0x5080, 0x5080,
+  /* Block 0x23 */
+  0x5080, 0x5080, 0x5080, 0x5080, 0x5080, 0x5080, 0x5080, 0x5080, 0x5080, 0x5080, 0x5080, 0x5080,
+  0x5080, 0x5080, 0x5080, 0x5080, 0x5080, 0x5080, 0x5080, 0x5080, 0x5080, 0x5080, 0x5080, 0x5080,
+  0x5080, 0x5080, 0x5080, 0x5080, 0x5080, 0x5080, 0x5080, 0x5080, 0x5080, 0x5080, 0x5080, 0x5084,
+  0x5084, 0x5084, 0x5084, 0x5084, 0x5880, 0x5880, 0x5880, 0x5880, 0x5880, 0x5880, 0x5880, 0x5880,
+  0x5880, 0x5880, 0x5880, 0x5880, 0x5880, 0x5880, 0x5880, 0x5880, 0x5880, 0x5880, 0x5880, 0x5880,
+  0x5880, 0x5880, 0x5880, 0x5880, 0x5880, 0x5880, 0x5880, 0x5880, 0x5880, 0x5880, 0x5880, 0x5880,
+  0x5880, 0x5880, 0x5880, 0x5880, 0x5880, 0x5880, 0x5880, 0x5880, 0x5880, 0x5880, 0x5880, 0x5880,
+  0x5880, 0x5880, 0x5880, 0x5880, 0x5880, 0x5880, 0x5880, 0x5880, 0x5880, 0x5880, 0x5880, 0x5880,
+  0x5880, 0x5880, 0x5880, 0x5880, 0x5880, 0x5880, 0x5880, 0x5880, 0x5880, 0x5880, 0x5880, 0x5880,
+  0x5880, 0x5880, 0x5880, 0x5880, 0x5880, 0x5880, 0x5880, 0x5880, 0x5880, 0x5880, 0x5880, 0x5880,
+  0x5880, 0x5880, 0x5884, 0x5884, 0x5884, 0x5884, 0x5884, 0x5884,
+  /* Block 0x24 */
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0081, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0081,
+  0x0080, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x04BF, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x04BF, 0x0080, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x04BF, 0x04BF,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  /* Block 0x25 */
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0081, 0x0080, 0x04BF, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x04BF, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0081,
+  0x0080, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x04BF, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x04BF, 0x0080, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x04BF, 0x04BF,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0081, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0081, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  /* Block 0x26 */
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0081, 0x0080, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x04BF, 0x04BF,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0081, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0081,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x04BF, 0x04BF, 0x2245, 0x2245, 0x2241,
+  0x0081, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0x27 */
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081,
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081,
+  0x0081, 0x0081, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x008A, 0x04BF, 0x04BF,
+  0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x04BF, 0x04BF,
+  /* Block 0x28 */
+  0x0084, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  /* Block 0x29 */
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  /* Block 0x2A */
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  /* Block 0x2B */
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x04BF, 0x04BF, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0x2C */
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x2240, 0x2240, 0x2240, 0x44BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x2240, 0x2240, 0x4240, 0x0080, 0x0080, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x2240, 0x2240,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x04BF, 0x0080, 0x0080, 0x0080, 0x04BF, 0x2240, 0x2240, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0x2D */
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x2240, 0x2240, 0x4280, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240,
+  0x2240, 0x2240, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x2240, 0x4280,
+  0x4280, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x2240, 0x04BF, 0x04BF,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0x2E */
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x2240,
+  0x2240, 0x2240, 0x1940, 0x24BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0x2F */
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x2240, 0x2240, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x2240, 0x0083, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0x30 */
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0089, 0x0089, 0x04BF, 0x2240, 0x2240, 0x2240, 0x4280,
+  0x4280, 0x4280, 0x4280, 0x2240, 0x2240, 0x4280, 0x4280, 0x4280, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x4280, 0x4280, 0x2240, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x2240, 0x2240, 0x2240,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0080, 0x04BF, 0x04BF, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x04BF, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0x31 */
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081,
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081,
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081,
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0084, 0x0084, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081,
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081,
+  0x0081, 0x0081, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0081, 0x0081, 0x0081, 0x0081,
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0084, 0x04BF, 0x04BF, 0x04BF, 0x0081, 0x0081,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  /* Block 0x32 */
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081,
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x2241,
+  0x2241, 0x4281, 0x4281, 0x2241, 0x04BF, 0x04BF, 0x0081, 0x0081, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x4284, 0x2244, 0x4284, 0x2244, 0x2244, 0x2244, 0x2244, 0x2244, 0x2244, 0x2244, 0x04BF,
+  0x2244, 0x0284, 0x2244, 0x0284, 0x0284, 0x2244, 0x2244, 0x2244, 0x2244, 0x2244, 0x2244, 0x2244,
+  0x2244, 0x4284, 0x4284, 0x4284, 0x4284, 0x4284, 0x4284, 0x2244, 0x2244, 0x2244, 0x2244, 0x2244,
+  0x2244, 0x2244, 0x2244, 0x2244, 0x2244, 0x04BF, 0x04BF, 0x2244,
+  /* Block 0x33 */
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x04BF, 0x04BF,
+  0x2249, 0x2249, 0x2249, 0x2249, 0x2249, 0x2249, 0x2249, 0x2249, 0x2249, 0x2249, 0x2249, 0x2249,
+  0x2249, 0x2249, 0x2249, 0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF,
+  0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0x34 */
+  0x2242, 0x2242, 0x2242, 0x2242, 0x4282, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x2242, 0x2282, 0x2242, 0x2242, 0x2242, 0x2242, 0x2242, 0x4282,
+  0x2242, 0x4282, 0x4282, 0x4282, 0x4282, 0x4282, 0x2242, 0x4282, 0x4282, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x2242,
+  0x2242, 0x2242, 0x2242, 0x2242, 0x2242, 0x2242, 0x2242, 0x2242, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0x35 */
+  0x2243, 0x2243, 0x4283, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x4283, 0x2243, 0x2243,
+  0x2243, 0x2243, 0x4283, 0x4283, 0x2243, 0x2243, 0x4283, 0x2246, 0x2246, 0x2246, 0x0083, 0x0083,
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0086, 0x0086,
+  0x0086, 0x0086, 0x0086, 0x0086, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085,
+  0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085,
+  0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085,
+  0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x2245, 0x4285, 0x2245, 0x2245, 0x4285, 0x4285,
+  0x4285, 0x2245, 0x4285, 0x2245, 0x2245, 0x2245, 0x4285, 0x4285, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0085, 0x0085, 0x0085, 0x0085,
+  /* Block 0x36 */
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  0x4283, 0x4283, 0x4283, 0x4283, 0x4283, 0x4283, 0x4283, 0x4283, 0x2243, 0x2243, 0x2243, 0x2243,
+  0x2243, 0x2243, 0x2243, 0x2243, 0x4283, 0x4283, 0x2243, 0x2243, 0x04BF, 0x04BF, 0x04BF, 0x0083,
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  0x0083, 0x0083, 0x04BF, 0x04BF, 0x04BF, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  /* Block 0x37 */
+  0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x2244, 0x2244, 0x2244, 0x0084,
+  0x2244, 0x2244, 0x2244, 0x2244, 0x2244, 0x2244, 0x2244, 0x2244, 0x2244, 0x2244, 0x2244, 0x2244,
+  0x2244, 0x4284, 0x2244, 0x2244, 0x2244, 0x2244, 0x2244, 0x2244, 0x2244, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x2244, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0086, 0x2246, 0x0086, 0x0086, 0x428C,
+  0x2249, 0x2249, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0x38 */
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081,
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081,
+  /* Block 0x39 */
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081,
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081,
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081,
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081,
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081,
+  0x0081, 0x0081, 0x0081, 0x0081, 0x2241, 0x2241, 0x2241, 0x2241, 0x2242, 0x2242, 0x2242, 0x2242,
+  0x2242, 0x2242, 0x2242, 0x2243, 0x2243, 0x2243, 0x2243, 0x2243, 0x2243, 0x2243, 0x2243, 0x2243,
+  0x2243, 0x2243, 0x2243, 0x2243, 0x2243, 0x2243, 0x2243, 0x2243, 0x2243, 0x2243, 0x2243, 0x2243,
+  0x2243, 0x2243, 0x2243, 0x2243, 0x2243, 0x2243, 0x2243, 0x2249, 0x2249, 0x2249, 0x2249, 0x2249,
+  0x2249, 0x2249, 0x2249, 0x2249, 0x2249, 0x2249, 0x2249, 0x2249, 0x2249, 0x2249, 0x224C, 0x224C,
+  0x224C, 0x224C, 0x24BF, 0x224B, 0x2245, 0x2244, 0x2242, 0x2242,
+  /* Block 0x3A */
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0083, 0x0083, 0x0083, 0x0083, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  /* Block 0x3B */
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x04BF, 0x04BF,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x04BF, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x04BF, 0x04BF,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x04BF, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x04BF, 0x0080, 0x04BF, 0x0080, 0x04BF, 0x0080, 0x04BF, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x04BF, 0x04BF,
+  /* Block 0x3C */
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x04BF, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x04BF, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x04BF, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x04BF, 0x04BF, 0x0080, 0x0080, 0x0080, 0x04BF, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x04BF,
+  /* Block 0x3D */
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x1940,
+  0x2140, 0x2940, 0x1940, 0x1940, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x1980, 0x1980, 0x1940, 0x1940, 0x1940, 0x1940, 0x1940, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x8080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x8080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0081, 0x0081, 0x0080, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0080,
+  0x1940, 0x1940, 0x1940, 0x1940, 0x1943, 0x1CBF, 0x1948, 0x1948, 0x1948, 0x1948, 0x1940, 0x1940,
+  0x1940, 0x1940, 0x1940, 0x1940, 0x0080, 0x0080, 0x04BF, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  /* Block 0x3E */
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x04BF, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0085, 0x0085, 0x0085,
+  0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x04BF, 0x04BF, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0081, 0x0081, 0x0081, 0x0081, 0x0084, 0x0084, 0x0084, 0x0085, 0x0087, 0x0089,
+  0x0089, 0x0089, 0x008A, 0x008C, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x2240, 0x2240, 0x2240, 0x2240,
+  0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240,
+  0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2241,
+  0x2242, 0x2242, 0x2242, 0x2242, 0x2243, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0x3F */
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x8080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x8080, 0x0080, 0x0080,
+  0x0081, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0081, 0x0082, 0x0082, 0x0083, 0x0084, 0x0084, 0x0084, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  /* Block 0x40 */
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0082, 0x0083, 0x0083, 0x0083, 0x0083, 0x0084, 0x008A, 0x008A,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x8080, 0x8080, 0x8080, 0x8080,
+  0x8080, 0x8080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x8080, 0x8080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  /* Block 0x41 */
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x80C0, 0x80C0, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x8080, 0x00C0, 0x00C0, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  /* Block 0x42 */
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x8080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x8080, 0x0080, 0x0081, 0x0081, 0x0081,
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0084, 0x80C5, 0x80C5, 0x80C5,
+  0x80C5, 0x8085, 0x8085, 0x8085, 0x80C5, 0x8085, 0x8085, 0x80C5, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x8089, 0x8089, 0x8089, 0x008B, 0x008B, 0x008B, 0x008B, 0x008C,
+  /* Block 0x43 */
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  /* Block 0x44 */
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x8080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  /* Block 0x45 */
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x8080, 0x8080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x8080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x8080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x8080, 0x8080, 0x80C0, 0x80C0, 0x0080,
+  /* Block 0x46 */
+  0x8080, 0x8080, 0x8080, 0x8080, 0x8080, 0x8080, 0x0080, 0x8080, 0x8080, 0x8080, 0x8080, 0x8080,
+  0x8080, 0x8080, 0x8080, 0x8080, 0x8080, 0x8080, 0x8080, 0x0080, 0x80C0, 0x80C0, 0x8080, 0x8080,
+  0x8081, 0x8080, 0x8080, 0x8080, 0x8080, 0x8080, 0x8080, 0x8080, 0x8080, 0x8080, 0x8080, 0x8080,
+  0x8080, 0x8080, 0x8080, 0x8080, 0x8080, 0x8080, 0x8080, 0x8080, 0x8080, 0x8080, 0x8080, 0x8080,
+  0x8080, 0x8080, 0x8080, 0x8080, 0x8080, 0x8080, 0x8080, 0x8080, 0x8080, 0x8080, 0x8080, 0x8080,
+  0x8080, 0x8080, 0x8080, 0x8080, 0x8080, 0x8080, 0x8080, 0x8080, 0x8080, 0x8080, 0x8080, 0x8080,
+  0x80C0, 0x80C0, 0x80C0, 0x80C0, 0x80C0, 0x80C0, 0x80C0, 0x80C0, 0x80C0, 0x80C0, 0x80C0, 0x80C0,
+  0x8080, 0x8080, 0x8080, 0x8080, 0x8080, 0x8080, 0x8080, 0x8080, 0x8080, 0x8080, 0x8080, 0x8080,
+  0x8080, 0x8080, 0x8080, 0x8080, 0x8080, 0x8080, 0x8080, 0x8080, 0x8080, 0x8080, 0x8080, 0x8080,
+  0x8080, 0x8080, 0x8080, 0x8080, 0x8080, 0x8080, 0x8080, 0x8080, 0x8080, 0x8080, 0x8080, 0x8080,
+  0x8080, 0x8080, 0x8080, 0x8080, 0x8080, 0x8080, 0x8081, 0x80C1,
+  /* Block 0x47 */
+  0x8080, 0x8080, 0x8080, 0x8080, 0x8080, 0x8080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x8080, 0x8080, 0x8081, 0x80C1, 0x8081, 0x8081, 0x8081, 0x8081,
+  0x8081, 0x8081, 0x8081, 0x8081, 0x8081, 0x8083, 0x8084, 0x8084, 0x8080, 0x80C0, 0x8081, 0x8081,
+  0x8081, 0x8081, 0x8081, 0x8081, 0x8081, 0x8081, 0x80C1, 0x80C1, 0x8081, 0x8081, 0x8081, 0x8081,
+  0x8081, 0x8081, 0x8082, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083,
+  0x8083, 0x80C4, 0x80C4, 0x8084, 0x8083, 0x8083, 0x8083, 0x8083, 0x80C4, 0x80C4, 0x8084, 0x8084,
+  0x8084, 0x8084, 0x8084, 0x8084, 0x8084, 0x8084, 0x80C5, 0x8084, 0x8084, 0x8084, 0x8084, 0x8084,
+  0x80C4, 0x8084, 0x8084, 0x8084, 0x8084, 0x8084, 0x8084, 0x8084, 0x8084, 0x8084, 0x8084, 0x8084,
+  0x8084, 0x8084, 0x8085, 0x8084, 0x8085, 0x8085, 0x8085, 0x8085, 0x8084, 0x8084, 0x80C4, 0x8084,
+  0x8084, 0x8084, 0x8084, 0x8084, 0x8084, 0x8084, 0x80C4, 0x80C4, 0x8084, 0x80C4, 0x8084, 0x8084,
+  0x8084, 0x8084, 0x80C4, 0x8084, 0x8084, 0x80C4, 0x8084, 0x8084,
+  /* Block 0x48 */
+  0x8089, 0x8080, 0x8080, 0x8080, 0x8080, 0x80C5, 0x0080, 0x0080, 0x8080, 0x8080, 0x80C5, 0x80C5,
+  0x8080, 0x8080, 0x8080, 0x8080, 0x8080, 0x8080, 0x8080, 0x0080, 0x8080, 0x0080, 0x8080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x8080, 0x0080, 0x0080, 0x0080, 0x8080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x80C5, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x8080, 0x8080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x8080, 0x0080, 0x0080, 0x8080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x80C5, 0x0080, 0x80C5, 0x0080, 0x0080, 0x0080, 0x0080, 0x80C5,
+  0x80C5, 0x80C5, 0x0080, 0x80C4, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0085,
+  0x0085, 0x0080, 0x0080, 0x8080, 0x8080, 0x8080, 0x8080, 0x8080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  /* Block 0x49 */
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x80C5, 0x80C5, 0x80C5,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x8080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x80C5, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x80C5, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0086, 0x0083, 0x0086, 0x0085, 0x0085, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  /* Block 0x4A */
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x8080, 0x8080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  /* Block 0x4B */
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x8080, 0x8080, 0x8080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x80C3, 0x80C3, 0x0083, 0x0083, 0x0083, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0089, 0x0089, 0x0089, 0x80C3, 0x0083, 0x0083, 0x0083,
+  0x0083, 0x80C4, 0x0084, 0x0084, 0x0084, 0x0084, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x04BF, 0x04BF, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  /* Block 0x4C */
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x04BF, 0x04BF,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x04BF, 0x04BF,
+  0x04BF, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x04BF, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x008C, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x008A, 0x008A, 0x008A, 0x008A, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0x4D */
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081,
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081,
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081,
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x04BF,
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081,
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081,
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081,
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x04BF,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0083, 0x0083, 0x0083, 0x0084, 0x0083, 0x0083, 0x0083, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0084, 0x0084,
+  /* Block 0x4E */
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081,
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081,
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081,
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081,
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081,
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081,
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081,
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081,
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x2244, 0x2244, 0x2244, 0x0086, 0x0086, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081,
+  /* Block 0x4F */
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081,
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081,
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081,
+  0x0081, 0x0081, 0x04BF, 0x0086, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0086, 0x04BF, 0x04BF,
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081,
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081,
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081,
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081,
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0086, 0x0086, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x0081, 0x0085, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x2245,
+  /* Block 0x50 */
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081,
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0081, 0x0081, 0x0081, 0x0081,
+  0x0081, 0x0081, 0x0081, 0x04BF, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x04BF,
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x04BF, 0x0081, 0x0081, 0x0081, 0x0081,
+  0x0081, 0x0081, 0x0081, 0x04BF, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x04BF,
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x04BF, 0x0081, 0x0081, 0x0081, 0x0081,
+  0x0081, 0x0081, 0x0081, 0x04BF, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x04BF,
+  0x2243, 0x2243, 0x2243, 0x2243, 0x2243, 0x2243, 0x2243, 0x2243, 0x2243, 0x2243, 0x2243, 0x2243,
+  0x2243, 0x2243, 0x2243, 0x2243, 0x2243, 0x2243, 0x2243, 0x2243, 0x2243, 0x2243, 0x2243, 0x2243,
+  0x2243, 0x2243, 0x2243, 0x2243, 0x2243, 0x2243, 0x2243, 0x2243,
+  /* Block 0x51 */
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081,
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081,
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0081, 0x0081, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  0x0083, 0x0084, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x008B, 0x008B, 0x008C, 0x008C, 0x008C,
+  0x008C, 0x008C, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0x52 */
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x04BF, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0x53 */
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  /* Block 0x54 */
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0x55 */
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x2240, 0x2240, 0x2240, 0x2240, 0x22C0, 0x22C0,
+  0x80C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x80C0, 0x00C0, 0x0080, 0x04BF, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  /* Block 0x56 */
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x04BF,
+  0x04BF, 0x2240, 0x2240, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  /* Block 0x57 */
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C3, 0x00CC, 0x04BF,
+  0x04BF, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  /* Block 0x58 */
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x04BF, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C5, 0x00C5, 0x00C5, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1,
+  0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C3, 0x00C3, 0x00C3, 0x00C3,
+  0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3,
+  0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  /* Block 0x59 */
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x04BF, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C4, 0x00C4, 0x00C4, 0x00C4,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C1, 0x00C0,
+  /* Block 0x5A */
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x80C0,
+  0x00C0, 0x80C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x04BF,
+  /* Block 0x5B */
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF,
+  0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  /* Block 0x5C */
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1,
+  0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1,
+  0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C3, 0x00C4, 0x00C4, 0x00C4, 0x00C4,
+  0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C6, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA,
+  0x00CA, 0x00CA, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC,
+  0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x04FF,
+  0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF,
+  0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF,
+  /* Block 0x5D */
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x04BF, 0x04BF, 0x04BF, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  /* Block 0x5E */
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  /* Block 0x5F */
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  0x0085, 0x0085, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  0x0083, 0x0083, 0x0083, 0x2243, 0x2243, 0x2243, 0x2243, 0x0083, 0x2246, 0x2246, 0x2246, 0x2246,
+  0x2246, 0x2246, 0x2246, 0x2246, 0x2243, 0x2243, 0x0083, 0x0083,
+  /* Block 0x60 */
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x224A, 0x2246, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x2244, 0x2244, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0x61 */
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081,
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0082, 0x0082, 0x0083, 0x0083,
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  /* Block 0x62 */
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  0x0083, 0x0085, 0x0085, 0x008A, 0x0085, 0x0085, 0x0086, 0x0086, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0085, 0x0085, 0x0085, 0x0085,
+  0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0086, 0x0089, 0x0089, 0x0089, 0x008B, 0x04BF,
+  0x0089, 0x0089, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0089,
+  0x0086, 0x0086, 0x0085, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  /* Block 0x63 */
+  0x0081, 0x0081, 0x2241, 0x0081, 0x0081, 0x0081, 0x2241, 0x0081, 0x0081, 0x0081, 0x0081, 0x2241,
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081,
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x4281,
+  0x4281, 0x2241, 0x2241, 0x4281, 0x0081, 0x0081, 0x0081, 0x0081, 0x24BF, 0x04BF, 0x04BF, 0x04BF,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0x64 */
+  0x4283, 0x4283, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  0x0083, 0x0083, 0x0083, 0x0083, 0x4283, 0x4283, 0x4283, 0x4283, 0x4283, 0x4283, 0x4283, 0x4283,
+  0x4283, 0x4283, 0x4283, 0x4283, 0x4283, 0x4283, 0x4283, 0x4283, 0x2243, 0x224B, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x2244, 0x2244, 0x2244, 0x2244, 0x2244, 0x2244, 0x2244, 0x2244, 0x2244, 0x2244, 0x2244, 0x2244,
+  0x2244, 0x2244, 0x2244, 0x2244, 0x2244, 0x2244, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x008A, 0x008A, 0x04BF, 0x24BF,
+  /* Block 0x65 */
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  0x0083, 0x0083, 0x2243, 0x2243, 0x2243, 0x2243, 0x2243, 0x2243, 0x2243, 0x2243, 0x0083, 0x0083,
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x2243,
+  0x2243, 0x2243, 0x2243, 0x2243, 0x2243, 0x2243, 0x2243, 0x2243, 0x2243, 0x2243, 0x4283, 0x4283,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0083,
+  0x48C4, 0x48C4, 0x48C4, 0x48C4, 0x48C4, 0x48C4, 0x48C4, 0x48C4, 0x48C4, 0x48C4, 0x48C4, 0x48C4,
+  0x48C4, 0x48C4, 0x48C4, 0x48C4, 0x48C4, 0x48C4, 0x48C4, 0x48C4, 0x48C4, 0x48C4, 0x48C4, 0x48C4,
+  0x48C4, 0x48C4, 0x48C4, 0x48C4, 0x48C4, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0x66 */
+  0x2244, 0x2244, 0x2244, 0x4284, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x2244, 0x4284, 0x4284, 0x2244, 0x2244, 0x2244, 0x2244, 0x4284, 0x4284,
+  0x2244, 0x2284, 0x4284, 0x4284, 0x4284, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x04BF, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0084, 0x0084,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x2249, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x04BF,
+  /* Block 0x67 */
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x2243, 0x2243, 0x2243, 0x2243, 0x2243, 0x2243, 0x4283,
+  0x4283, 0x2243, 0x2243, 0x4283, 0x4283, 0x2243, 0x2243, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0083, 0x0083, 0x0083, 0x2243, 0x0083, 0x0083, 0x0083, 0x0083,
+  0x0083, 0x0083, 0x0083, 0x0083, 0x2243, 0x4283, 0x04BF, 0x04BF, 0x0083, 0x0083, 0x0083, 0x0083,
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x04BF, 0x04BF, 0x0083, 0x0083, 0x0083, 0x0083,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x0284, 0x2249, 0x0289, 0x0089, 0x0089,
+  /* Block 0x68 */
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x2244, 0x0084, 0x2244, 0x2244, 0x2244, 0x0084, 0x0084, 0x2244, 0x2244, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x2244, 0x2244, 0x0084, 0x2244, 0x0084, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x4286,
+  0x2246, 0x2246, 0x4286, 0x4286, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x4286, 0x2246, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0x69 */
+  0x04BF, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x04BF, 0x04BF, 0x0085, 0x0085, 0x0085,
+  0x0085, 0x0085, 0x0085, 0x04BF, 0x04BF, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0085, 0x0085, 0x0085, 0x0085,
+  0x0085, 0x0085, 0x0085, 0x04BF, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x04BF,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x008A, 0x008A, 0x008A, 0x008A, 0x0089, 0x0089, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+  0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+  /* Block 0x6A */
+  0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+  0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+  0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+  0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+  0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+  0x008A, 0x008A, 0x008A, 0x008A, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x4284, 0x4284, 0x2244, 0x4284, 0x4284, 0x2244, 0x4284, 0x4284, 0x0084,
+  0x4284, 0x2244, 0x04BF, 0x04BF, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0x6B */
+  0x60C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0,
+  0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0,
+  0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x60C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0,
+  0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0,
+  0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x60C0, 0x68C0, 0x68C0, 0x68C0,
+  0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0,
+  0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0,
+  0x60C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0,
+  0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0,
+  0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x60C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0,
+  0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0,
+  /* Block 0x6C */
+  0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0,
+  0x60C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0,
+  0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0,
+  0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x60C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0,
+  0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0,
+  0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x60C0, 0x68C0, 0x68C0, 0x68C0,
+  0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0,
+  0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0,
+  0x60C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0,
+  0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0,
+  0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x60C0, 0x68C0, 0x68C0, 0x68C0,
+  /* Block 0x6D */
+  0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0,
+  0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0,
+  0x60C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0,
+  0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0,
+  0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x60C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0,
+  0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0,
+  0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x60C0, 0x68C0, 0x68C0, 0x68C0,
+  0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0,
+  0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0,
+  0x60C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0,
+  0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0,
+  /* Block 0x6E */
+  0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x60C0, 0x68C0, 0x68C0, 0x68C0,
+  0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0,
+  0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0,
+  0x60C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0,
+  0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0,
+  0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x60C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0,
+  0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0,
+  0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x60C0, 0x68C0, 0x68C0, 0x68C0,
+  0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0,
+  0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0,
+  0x60C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0,
+  /* Block 0x6F */
+  0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0,
+  0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x60C0, 0x68C0, 0x68C0, 0x68C0,
+  0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0,
+  0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0,
+  0x60C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0,
+  0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0,
+  0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x60C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0,
+  0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0,
+  0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x60C0, 0x68C0, 0x68C0, 0x68C0,
+  0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0,
+  0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0,
+  /* Block 0x70 */
+  0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x60C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0,
+  0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0,
+  0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x60C0, 0x68C0, 0x68C0, 0x68C0,
+  0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0,
+  0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0,
+  0x60C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0,
+  0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0,
+  0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x60C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0,
+  0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0,
+  0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x60C0, 0x68C0, 0x68C0, 0x68C0,
+  0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0,
+  /* Block 0x71 */
+  0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0,
+  0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x60C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0,
+  0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0,
+  0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x60C0, 0x68C0, 0x68C0, 0x68C0,
+  0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0,
+  0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0,
+  0x60C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0,
+  0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0,
+  0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x60C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0,
+  0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0,
+  0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0,
+  /* Block 0x72 */
+  0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x60C0, 0x68C0, 0x68C0, 0x68C0,
+  0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0,
+  0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x5084, 0x5084, 0x5084, 0x5084, 0x5084, 0x5084, 0x5084, 0x5084, 0x5084, 0x5084, 0x5084, 0x5084,
+  0x5084, 0x5084, 0x5084, 0x5084, 0x5084, 0x5084, 0x5084, 0x5084, 0x5084, 0x5084, 0x5084, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x5884, 0x5884, 0x5884, 0x5884, 0x5884, 0x5884, 0x5884, 0x5884, 0x5884,
+  0x5884, 0x5884, 0x5884, 0x5884, 0x5884, 0x5884, 0x5884, 0x5884, 0x5884, 0x5884, 0x5884, 0x5884,
+  0x5884, 0x5884, 0x5884, 0x5884, 0x5884, 0x5884, 0x5884, 0x5884, 0x5884, 0x5884, 0x5884, 0x5884,
+  0x5884, 0x5884, 0x5884, 0x5884, 0x5884, 0x5884, 0x5884, 0x5884, 0x5884, 0x5884, 0x5884, 0x5884,
+  0x5884, 0x5884, 0x5884, 0x5884, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0x73 */
+  0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180,
+  0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180,
+  0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180,
+  0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180,
+  0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180,
+  0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180,
+  0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180,
+  0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180,
+  0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180,
+  0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180,
+  0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180,
+  /* Block 0x74 */
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C6, 0x00C6,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C4,
+  0x00C4, 0x00C4, 0x04FF, 0x04FF, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1,
+  0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1,
+  /* Block 0x75 */
+  0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1,
+  0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1,
+  0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1,
+  0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1,
+  0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1,
+  0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1,
+  0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1,
+  0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF,
+  0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF,
+  0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF,
+  0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF,
+  /* Block 0x76 */
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0080, 0x2240, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x04BF, 0x0080, 0x04BF, 0x0080, 0x0080, 0x04BF, 0x0080, 0x0080, 0x04BF, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  /* Block 0x77 */
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085,
+  0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  /* Block 0x78 */
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  /* Block 0x79 */
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x04BF, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0480, 0x0480, 0x0480, 0x0480,
+  0x0480, 0x0480, 0x0480, 0x0480, 0x0480, 0x0480, 0x0480, 0x0480, 0x0480, 0x0480, 0x0480, 0x0480,
+  0x0480, 0x0480, 0x0480, 0x0480, 0x0480, 0x0480, 0x0480, 0x0480, 0x0480, 0x0480, 0x0480, 0x0480,
+  0x0480, 0x0480, 0x0480, 0x0480, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x04BF, 0x04BF,
+  /* Block 0x7A */
+  0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240,
+  0x2240, 0x2240, 0x2240, 0x2240, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1, 0x00C1,
+  0x00C1, 0x00C1, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x2240, 0x2240, 0x2240, 0x2240,
+  0x2243, 0x2243, 0x2243, 0x2249, 0x2249, 0x2249, 0x2249, 0x2249, 0x2249, 0x2249, 0x224A, 0x224A,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x04BF,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x04BF, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x04BF, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  /* Block 0x7B */
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x04BF, 0x04BF, 0x1940,
+  /* Block 0x7C */
+  0x04BF, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  /* Block 0x7D */
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x2080, 0x2080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x04BF, 0x04BF, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x04BF, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x04BF, 0x04BF, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x04BF, 0x04BF, 0x0080, 0x0080, 0x0080, 0x04BF, 0x04BF, 0x04BF,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x04BF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF,
+  0x1CBF, 0x1940, 0x1940, 0x1940, 0x0080, 0x0080, 0x0480, 0x0480,
+  /* Block 0x7E */
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x04BF,
+  0x0080, 0x0080, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x04BF, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0x7F */
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0x80 */
+  0x0080, 0x0080, 0x0080, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x04BF, 0x04BF, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081,
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081,
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081,
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081,
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081,
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081,
+  /* Block 0x81 */
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0089,
+  0x0089, 0x008B, 0x008B, 0x04BF, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  0x0083, 0x0083, 0x0083, 0x0083, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0089, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0083, 0x0083, 0x0083, 0x0083,
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x2243, 0x04BF, 0x04BF,
+  /* Block 0x82 */
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0x83 */
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x04BF, 0x04BF, 0x04BF, 0x0083, 0x0083, 0x0083, 0x0083,
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x2249, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0x84 */
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0089, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x008C, 0x008C, 0x008C,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x2249, 0x2249,
+  0x2249, 0x2249, 0x2249, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0x85 */
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x04BF, 0x0080, 0x0081, 0x0081, 0x0081, 0x0081,
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081,
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081,
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081,
+  0x0081, 0x0081, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0x86 */
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x04BF, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B,
+  0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B,
+  0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B,
+  0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B,
+  0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B,
+  0x008B, 0x008B, 0x008B, 0x008B, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0x87 */
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x0089, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0x88 */
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  /* Block 0x89 */
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0x8A */
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x04BF, 0x04BF, 0x0080, 0x04BF, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x04BF, 0x0080, 0x0080, 0x04BF, 0x04BF, 0x04BF,
+  0x0080, 0x04BF, 0x04BF, 0x0080, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x04BF, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  /* Block 0x8B */
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+  0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x04BF, 0x008A, 0x008A, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+  /* Block 0x8C */
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0084, 0x0084, 0x04BF, 0x04BF, 0x04BF, 0x0082, 0x0083, 0x0083, 0x0083, 0x0083,
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+  0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x0083, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0x8D */
+  0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086,
+  0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086,
+  0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086,
+  0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086,
+  0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x008A, 0x008A, 0x0086, 0x0086, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+  0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x04BF, 0x04BF, 0x008A, 0x008A,
+  0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+  0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+  0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+  0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+  /* Block 0x8E */
+  0x0081, 0x2241, 0x2241, 0x2241, 0x04BF, 0x2241, 0x2241, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x2241, 0x2241, 0x2241, 0x2241, 0x0081, 0x0081, 0x0081, 0x0081, 0x04BF, 0x0081, 0x0081, 0x0081,
+  0x04BF, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081,
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081,
+  0x0081, 0x0081, 0x0081, 0x0081, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x2241, 0x2241, 0x2241, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x2241, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0081, 0x0081, 0x0081, 0x0081,
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  /* Block 0x8F */
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x2249, 0x2249, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0x90 */
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x04BF, 0x04BF, 0x04BF, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x04BF, 0x04BF, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  /* Block 0x91 */
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x0089, 0x0089, 0x0089, 0x0089, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0x92 */
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0x93 */
+  0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+  0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+  0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+  0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+  0x008A, 0x008A, 0x008A, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+  0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+  0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+  0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+  0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+  /* Block 0x94 */
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0x95 */
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x04BF,
+  /* Block 0x96 */
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x24BF, 0x24BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0x97 */
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x24BF, 0x24BF,
+  0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0x98 */
+  0x04BF, 0x04BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0x99 */
+  0x4285, 0x2245, 0x4285, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085,
+  0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085,
+  0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085,
+  0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085,
+  0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x2245, 0x2245, 0x2245, 0x2245,
+  0x2245, 0x2245, 0x2245, 0x2245, 0x2245, 0x2245, 0x2245, 0x2245, 0x2245, 0x2245, 0x2245, 0x0085,
+  0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0085, 0x0085,
+  0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085,
+  0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085,
+  0x0085, 0x0085, 0x0085, 0x0085, 0x24BF, 0x04BF, 0x04BF, 0x24BF, 0x24BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x2249,
+  /* Block 0x9A */
+  0x2244, 0x2244, 0x4284, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x4284, 0x4284, 0x4284, 0x2244, 0x2244, 0x2244, 0x2244, 0x4284, 0x4284, 0x2244, 0x2244, 0x0084,
+  0x0084, 0x3944, 0x0084, 0x0084, 0x0084, 0x0084, 0x24BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x3CBF, 0x04BF, 0x04BF, 0x0086, 0x0086, 0x0086, 0x0086,
+  0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086,
+  0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086,
+  0x0086, 0x0086, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0x9B */
+  0x2246, 0x2246, 0x2246, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086,
+  0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086,
+  0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086,
+  0x0086, 0x0086, 0x0086, 0x2246, 0x2246, 0x2246, 0x2246, 0x2246, 0x4286, 0x2246, 0x2246, 0x2246,
+  0x2246, 0x2246, 0x2246, 0x2246, 0x2246, 0x04BF, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086,
+  0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x04BF, 0x44BF, 0x44BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x2249, 0x0089, 0x0089, 0x0089, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0x9C */
+  0x2246, 0x2246, 0x4286, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086,
+  0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086,
+  0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086,
+  0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086,
+  0x0086, 0x0086, 0x0086, 0x4286, 0x4286, 0x4286, 0x2246, 0x2246, 0x2246, 0x2246, 0x2246, 0x2246,
+  0x2246, 0x2246, 0x2246, 0x4286, 0x4286, 0x0086, 0x3886, 0x3886, 0x0086, 0x0086, 0x0086, 0x0086,
+  0x0086, 0x208A, 0x224A, 0x224A, 0x224A, 0x0089, 0x44BF, 0x24BF, 0x0086, 0x0086, 0x0086, 0x0086,
+  0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0089, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+  0x04BF, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0x9D */
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x04BF, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x4289, 0x4289, 0x4289, 0x2249,
+  0x2249, 0x2249, 0x4289, 0x4289, 0x2249, 0x4289, 0x2249, 0x2249, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x224B, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0x9E */
+  0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x04BF, 0x008A, 0x04BF, 0x008A, 0x008A,
+  0x008A, 0x008A, 0x04BF, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+  0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x04BF, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+  0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x2249,
+  0x4289, 0x4289, 0x4289, 0x2249, 0x2249, 0x2249, 0x2249, 0x2249, 0x2249, 0x2249, 0x2249, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0x9F */
+  0x224A, 0x2249, 0x4289, 0x4289, 0x04BF, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x04BF, 0x04BF, 0x0089, 0x0089, 0x04BF, 0x04BF, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x04BF, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x04BF, 0x0089, 0x0089, 0x04BF, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x04BF, 0x24BF,
+  0x2249, 0x0089, 0x2289, 0x4289, 0x2249, 0x4289, 0x4289, 0x4289, 0x4289, 0x04BF, 0x04BF, 0x4289,
+  0x4289, 0x04BF, 0x04BF, 0x4289, 0x4289, 0x4289, 0x04BF, 0x04BF, 0x008A, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x2289, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x4289, 0x4289, 0x04BF, 0x04BF, 0x2249, 0x2249, 0x2249, 0x2249, 0x2249, 0x2249,
+  0x2249, 0x04BF, 0x04BF, 0x04BF, 0x2249, 0x2249, 0x2249, 0x2249, 0x2249, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0xA0 */
+  0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B,
+  0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B,
+  0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B,
+  0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B,
+  0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x428B, 0x428B, 0x428B, 0x224B, 0x224B, 0x224B, 0x224B,
+  0x224B, 0x224B, 0x224B, 0x224B, 0x428B, 0x428B, 0x224B, 0x224B, 0x224B, 0x428B, 0x224B, 0x008B,
+  0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B,
+  0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x04BF, 0x008B, 0x04BF, 0x008B, 0x24BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0xA1 */
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x2289, 0x4289, 0x4289, 0x2249, 0x2249, 0x2249, 0x2249, 0x2249, 0x2249, 0x4289, 0x2249, 0x4289,
+  0x4289, 0x2289, 0x4289, 0x2249, 0x2249, 0x4289, 0x2249, 0x2249, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0xA2 */
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x2289,
+  0x4289, 0x4289, 0x2249, 0x2249, 0x2249, 0x2249, 0x04BF, 0x04BF, 0x4289, 0x4289, 0x4289, 0x4289,
+  0x2249, 0x2249, 0x4289, 0x2249, 0x2249, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+  0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x224A, 0x224A, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0xA3 */
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x4289, 0x4289, 0x4289, 0x2249, 0x2249, 0x2249, 0x2249, 0x2249, 0x2249, 0x2249, 0x2249, 0x4289,
+  0x4289, 0x2249, 0x4289, 0x2249, 0x2249, 0x0089, 0x0089, 0x0089, 0x0089, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B,
+  0x008B, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0xA4 */
+  0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086,
+  0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086,
+  0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086,
+  0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x2246, 0x4286, 0x2246, 0x4286, 0x4286,
+  0x2246, 0x2246, 0x2246, 0x2246, 0x2246, 0x2246, 0x4286, 0x2246, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086,
+  0x0086, 0x0086, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0xA5 */
+  0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+  0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+  0x008A, 0x008A, 0x04BF, 0x04BF, 0x04BF, 0x224A, 0x224A, 0x224A, 0x028A, 0x028A, 0x224A, 0x224A,
+  0x224A, 0x224A, 0x428A, 0x224A, 0x224A, 0x224A, 0x224A, 0x224A, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+  0x008A, 0x008A, 0x008A, 0x008A, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0xA6 */
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x44BF, 0x44BF, 0x44BF, 0x24BF,
+  0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x44BF, 0x24BF, 0x24BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0xA7 */
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0089,
+  /* Block 0xA8 */
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x24BF, 0x44BF, 0x44BF, 0x44BF, 0x44BF, 0x44BF, 0x04BF, 0x44BF, 0x44BF, 0x04BF, 0x04BF, 0x24BF,
+  0x24BF, 0x44BF, 0x24BF, 0x3CBF, 0x44BF, 0x3CBF, 0x44BF, 0x24BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0xA9 */
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x44BF, 0x44BF, 0x44BF,
+  0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x04BF, 0x04BF, 0x24BF, 0x24BF, 0x44BF, 0x44BF, 0x44BF, 0x44BF,
+  0x24BF, 0x04BF, 0x04BF, 0x04BF, 0x44BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0xAA */
+  0x008C, 0x224C, 0x224C, 0x224C, 0x224C, 0x224C, 0x224C, 0x228C, 0x228C, 0x224C, 0x224C, 0x008C,
+  0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C,
+  0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C,
+  0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C,
+  0x008C, 0x008C, 0x008C, 0x224C, 0x224C, 0x224C, 0x224C, 0x224C, 0x224C, 0x428C, 0x388C, 0x224C,
+  0x224C, 0x224C, 0x224C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x224C,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x008C, 0x224C, 0x224C, 0x224C,
+  0x224C, 0x224C, 0x224C, 0x428C, 0x428C, 0x224C, 0x224C, 0x224C, 0x008C, 0x008C, 0x008C, 0x008C,
+  0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C,
+  0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C,
+  0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C,
+  /* Block 0xAB */
+  0x008C, 0x008C, 0x008C, 0x008C, 0x3CBF, 0x3CBF, 0x388C, 0x388C, 0x388C, 0x388C, 0x224C, 0x224C,
+  0x224C, 0x224C, 0x224C, 0x224C, 0x224C, 0x224C, 0x224C, 0x224C, 0x224C, 0x224C, 0x224C, 0x428C,
+  0x224C, 0x224C, 0x008C, 0x008C, 0x008C, 0x04BF, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0xAC */
+  0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x04BF, 0x008B, 0x008B,
+  0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B,
+  0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B,
+  0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x428B,
+  0x224B, 0x224B, 0x224B, 0x224B, 0x224B, 0x224B, 0x224B, 0x04BF, 0x224B, 0x224B, 0x224B, 0x224B,
+  0x224B, 0x224B, 0x428B, 0x228B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x008B, 0x008B, 0x008B, 0x008B,
+  0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B,
+  0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B,
+  0x008B, 0x04BF, 0x04BF, 0x04BF, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B,
+  0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B,
+  /* Block 0xAD */
+  0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B,
+  0x008B, 0x008B, 0x008B, 0x008B, 0x04BF, 0x04BF, 0x224B, 0x224B, 0x224B, 0x224B, 0x224B, 0x224B,
+  0x224B, 0x224B, 0x224B, 0x224B, 0x224B, 0x224B, 0x224B, 0x224B, 0x224B, 0x224B, 0x224B, 0x224B,
+  0x224B, 0x224B, 0x224B, 0x224B, 0x04BF, 0x428B, 0x224B, 0x224B, 0x224B, 0x224B, 0x224B, 0x224B,
+  0x224B, 0x428B, 0x224B, 0x224B, 0x428B, 0x224B, 0x224B, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0xAE */
+  0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x04BF, 0x008C, 0x008C, 0x04BF, 0x008C,
+  0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C,
+  0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C,
+  0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C,
+  0x008C, 0x224C, 0x224C, 0x224C, 0x224C, 0x224C, 0x224C, 0x04BF, 0x04BF, 0x04BF, 0x224C, 0x04BF,
+  0x224C, 0x224C, 0x04BF, 0x224C, 0x224C, 0x224C, 0x224C, 0x224C, 0x224C, 0x224C, 0x388C, 0x224C,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x008C, 0x008C, 0x008C, 0x008C,
+  0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0xAF */
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x44BF, 0x44BF,
+  0x44BF, 0x44BF, 0x44BF, 0x04BF, 0x24BF, 0x24BF, 0x04BF, 0x44BF, 0x44BF, 0x24BF, 0x44BF, 0x24BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0xB0 */
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x24BF, 0x24BF, 0x44BF, 0x44BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0xB1 */
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  /* Block 0xB2 */
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  /* Block 0xB3 */
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x008A, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0xB4 */
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x04BF, 0x0082, 0x0082, 0x0082, 0x0082, 0x0089, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0xB5 */
+  0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+  0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+  0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+  0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+  0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+  0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+  0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+  0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+  0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+  0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+  0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+  /* Block 0xB6 */
+  0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+  0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+  0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+  0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+  0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+  0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0xB7 */
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  /* Block 0xB8 */
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x04BF,
+  0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0xB9 */
+  0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+  0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+  0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+  0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+  0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+  0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0xBA */
+  0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085,
+  0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085,
+  0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085,
+  0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085,
+  0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085,
+  0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085,
+  0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085,
+  0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085,
+  0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085,
+  0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085,
+  0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085,
+  /* Block 0xBB */
+  0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085,
+  0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085,
+  0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085,
+  0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085,
+  0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x04BF,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x0089, 0x0089, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0xBC */
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x04BF, 0x04BF, 0x2249, 0x2249, 0x2249, 0x2249, 0x2249, 0x0089, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0xBD */
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x2249, 0x2249, 0x2249, 0x2249, 0x2249, 0x2249, 0x2249, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x04BF, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x04BF, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0089, 0x0089, 0x0089,
+  /* Block 0xBE */
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0xBF */
+  0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086,
+  0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086,
+  0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086,
+  0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086,
+  0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086,
+  0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x24BF, 0x0086, 0x4286, 0x4286, 0x4286,
+  0x4286, 0x4286, 0x4286, 0x4286, 0x4286, 0x4286, 0x4286, 0x4286, 0x4286, 0x4286, 0x4286, 0x4286,
+  0x4286, 0x4286, 0x4286, 0x4286, 0x4286, 0x4286, 0x4286, 0x4286, 0x4286, 0x4286, 0x4286, 0x4286,
+  0x4286, 0x4286, 0x4286, 0x4286, 0x4286, 0x4286, 0x4286, 0x4286, 0x4286, 0x4286, 0x4286, 0x4286,
+  0x4286, 0x4286, 0x4286, 0x4286, 0x4286, 0x4286, 0x4286, 0x44BF,
+  /* Block 0xC0 */
+  0x44BF, 0x44BF, 0x44BF, 0x44BF, 0x44BF, 0x44BF, 0x44BF, 0x44BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x2246, 0x2246, 0x2246, 0x2246, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086,
+  0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x00CB, 0x00CC, 0x04BF, 0x04BF, 0x24BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x44BF, 0x44BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0xC1 */
+  0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB,
+  0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB,
+  0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB,
+  0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB,
+  0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB,
+  0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB,
+  0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB,
+  0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB,
+  0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB,
+  0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB,
+  0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB,
+  /* Block 0xC2 */
+  0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB,
+  0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB,
+  0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB,
+  0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB,
+  0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB,
+  0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB,
+  0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB,
+  0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB,
+  0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB,
+  0x00CB, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0xC3 */
+  0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB,
+  0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB,
+  0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB,
+  0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB,
+  0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB,
+  0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB,
+  0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB,
+  0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB,
+  0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB,
+  0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x00CB, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0xC4 */
+  0x00C5, 0x00C5, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC,
+  0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC,
+  0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC,
+  0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC,
+  0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC,
+  0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC,
+  0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC,
+  0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC,
+  0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC,
+  0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC,
+  0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC,
+  /* Block 0xC5 */
+  0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC,
+  0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC,
+  0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC,
+  0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC,
+  0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC,
+  0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC,
+  0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC,
+  0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC,
+  0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC,
+  0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC,
+  0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC,
+  /* Block 0xC6 */
+  0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC,
+  0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC,
+  0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC,
+  0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC,
+  /* Block 0xC7 */
+  0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC,
+  0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC,
+  0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC,
+  0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC,
+  0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC,
+  0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC,
+  0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC,
+  0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC,
+  0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC,
+  0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC,
+  0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0xC8 */
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0xC9 */
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x04BF, 0x04BF, 0x0089, 0x2249, 0x2249, 0x0089, 0x1949, 0x1949, 0x1949, 0x1949,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0xCA */
+  0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF,
+  0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF,
+  0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF,
+  0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x04BF, 0x04BF,
+  0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF,
+  0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0xCB */
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0xCC */
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x04BF, 0x04BF, 0x0083, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x2280, 0x4280, 0x2240, 0x2240, 0x2240, 0x0080, 0x0080,
+  0x0080, 0x4280, 0x2280, 0x2280, 0x2280, 0x2280, 0x2280, 0x1940, 0x1940, 0x1940, 0x1940, 0x1940,
+  0x1940, 0x1940, 0x1940, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240,
+  /* Block 0xCD */
+  0x2240, 0x2240, 0x2240, 0x0080, 0x0080, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x2240, 0x2240, 0x2240, 0x2240, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x008A, 0x008A,
+  0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0xCE */
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081,
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081,
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081,
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081,
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081,
+  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x2241, 0x2241, 0x2241, 0x0081, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0xCF */
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0xD0 */
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  /* Block 0xD1 */
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x04BF, 0x0080, 0x0080, 0x04BF, 0x04BF, 0x0080, 0x04BF,
+  0x04BF, 0x0080, 0x0080, 0x04BF, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x04BF, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x04BF, 0x0080,
+  0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x04BF, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  /* Block 0xD2 */
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x04BF,
+  0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x04BF, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x04BF, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x04BF, 0x0080, 0x04BF,
+  0x04BF, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x04BF, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  /* Block 0xD3 */
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0081, 0x0081, 0x04BF, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  /* Block 0xD4 */
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0082, 0x0082, 0x04BF, 0x04BF, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080,
+  /* Block 0xD5 */
+  0x224A, 0x224A, 0x224A, 0x224A, 0x224A, 0x224A, 0x224A, 0x224A, 0x224A, 0x224A, 0x224A, 0x224A,
+  0x224A, 0x224A, 0x224A, 0x224A, 0x224A, 0x224A, 0x224A, 0x224A, 0x224A, 0x224A, 0x224A, 0x224A,
+  0x224A, 0x224A, 0x224A, 0x224A, 0x224A, 0x224A, 0x224A, 0x224A, 0x224A, 0x224A, 0x224A, 0x224A,
+  0x224A, 0x224A, 0x224A, 0x224A, 0x224A, 0x224A, 0x224A, 0x224A, 0x224A, 0x224A, 0x224A, 0x224A,
+  0x224A, 0x224A, 0x224A, 0x224A, 0x224A, 0x224A, 0x224A, 0x008A, 0x008A, 0x008A, 0x008A, 0x224A,
+  0x224A, 0x224A, 0x224A, 0x224A, 0x224A, 0x224A, 0x224A, 0x224A, 0x224A, 0x224A, 0x224A, 0x224A,
+  0x224A, 0x224A, 0x224A, 0x224A, 0x224A, 0x224A, 0x224A, 0x224A, 0x224A, 0x224A, 0x224A, 0x224A,
+  0x224A, 0x224A, 0x224A, 0x224A, 0x224A, 0x224A, 0x224A, 0x224A, 0x224A, 0x224A, 0x224A, 0x224A,
+  0x224A, 0x224A, 0x224A, 0x224A, 0x224A, 0x224A, 0x224A, 0x224A, 0x224A, 0x224A, 0x224A, 0x224A,
+  0x224A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x224A, 0x008A, 0x008A,
+  0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+  /* Block 0xD6 */
+  0x008A, 0x008A, 0x008A, 0x008A, 0x224A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x224A, 0x224A, 0x224A, 0x224A, 0x224A, 0x04BF, 0x224A, 0x224A, 0x224A,
+  0x224A, 0x224A, 0x224A, 0x224A, 0x224A, 0x224A, 0x224A, 0x224A, 0x224A, 0x224A, 0x224A, 0x224A,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0xD7 */
+  0x224B, 0x224B, 0x224B, 0x224B, 0x224B, 0x224B, 0x224B, 0x04BF, 0x224B, 0x224B, 0x224B, 0x224B,
+  0x224B, 0x224B, 0x224B, 0x224B, 0x224B, 0x224B, 0x224B, 0x224B, 0x224B, 0x224B, 0x224B, 0x224B,
+  0x224B, 0x04BF, 0x04BF, 0x224B, 0x224B, 0x224B, 0x224B, 0x224B, 0x224B, 0x224B, 0x04BF, 0x224B,
+  0x224B, 0x04BF, 0x224B, 0x224B, 0x224B, 0x224B, 0x224B, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0xD8 */
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0xD9 */
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x24BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x24BF, 0x24BF, 0x24BF, 0x24BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0xDA */
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x04BF, 0x04BF, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x2249, 0x2249, 0x2249, 0x2249,
+  0x2249, 0x2249, 0x2249, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0xDB */
+  0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B,
+  0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B,
+  0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B,
+  0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B,
+  0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B,
+  0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x224B, 0x224B, 0x224B, 0x224B,
+  0x224B, 0x224B, 0x224B, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x008B, 0x008B, 0x008B, 0x008B,
+  0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x008B, 0x008B,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0xDC */
+  0x0086, 0x0086, 0x0086, 0x0086, 0x04BF, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086,
+  0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086,
+  0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x04BF, 0x0086, 0x0086, 0x04BF,
+  0x0086, 0x04BF, 0x04BF, 0x0086, 0x04BF, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086,
+  0x0086, 0x0086, 0x0086, 0x04BF, 0x0086, 0x0086, 0x0086, 0x0086, 0x04BF, 0x0086, 0x04BF, 0x0086,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0086, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0086,
+  0x04BF, 0x0086, 0x04BF, 0x0086, 0x04BF, 0x0086, 0x0086, 0x0086, 0x04BF, 0x0086, 0x0086, 0x04BF,
+  0x0086, 0x04BF, 0x04BF, 0x0086, 0x04BF, 0x0086, 0x04BF, 0x0086, 0x04BF, 0x0086, 0x04BF, 0x0086,
+  0x04BF, 0x0086, 0x0086, 0x04BF, 0x0086, 0x04BF, 0x04BF, 0x0086, 0x0086, 0x0086, 0x0086, 0x04BF,
+  0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x04BF, 0x0086, 0x0086, 0x0086, 0x0086,
+  0x04BF, 0x0086, 0x0086, 0x0086, 0x0086, 0x04BF, 0x0086, 0x04BF,
+  /* Block 0xDD */
+  0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x04BF, 0x0086,
+  0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086,
+  0x0086, 0x0086, 0x0086, 0x0086, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0086, 0x0086, 0x0086,
+  0x04BF, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x04BF, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086,
+  0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0086, 0x0086, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  /* Block 0xDE */
+  0x8083, 0x8083, 0x8083, 0x8083, 0x80C3, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083,
+  0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083,
+  0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083,
+  0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x84BF, 0x84BF, 0x84BF, 0x84BF,
+  0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083,
+  0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083,
+  0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083,
+  0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083,
+  0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083,
+  0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083,
+  0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083,
+  /* Block 0xDF */
+  0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083,
+  0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x8083, 0x84BF, 0x84BF, 0x84BF, 0x84BF,
+  0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x8085, 0x8085, 0x8085, 0x8085,
+  0x8085, 0x8085, 0x8085, 0x8085, 0x8085, 0x8085, 0x8085, 0x8085, 0x8085, 0x8085, 0x8085, 0x84BF,
+  0x84BF, 0x8085, 0x8085, 0x8085, 0x8085, 0x8085, 0x8085, 0x8085, 0x8085, 0x8085, 0x8085, 0x8085,
+  0x8085, 0x8085, 0x8085, 0x8089, 0x84BF, 0x8085, 0x8085, 0x8085, 0x8085, 0x8085, 0x8085, 0x8085,
+  0x8085, 0x8085, 0x8085, 0x8085, 0x8085, 0x8085, 0x8085, 0x80C5, 0x84BF, 0x8085, 0x8085, 0x8085,
+  0x8085, 0x8085, 0x8085, 0x8085, 0x8085, 0x8085, 0x8085, 0x8085, 0x8085, 0x8085, 0x8085, 0x8085,
+  0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089,
+  0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x84BF, 0x84BF,
+  0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF,
+  /* Block 0xE0 */
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0089,
+  0x0089, 0x84BF, 0x84BF, 0x84BF, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x84BF,
+  0x0085, 0x0084, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085,
+  0x0085, 0x0084, 0x0085, 0x0084, 0x0085, 0x0085, 0x0084, 0x0085, 0x0085, 0x0085, 0x0084, 0x0085,
+  0x0085, 0x0085, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085,
+  0x0085, 0x0085, 0x0085, 0x0084, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0084,
+  0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0086, 0x0086,
+  0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x8085, 0x8085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085,
+  0x0085, 0x0084, 0x0085, 0x0084, 0x0084, 0x0085, 0x8085, 0x8084,
+  /* Block 0xE1 */
+  0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0084, 0x0084,
+  0x0084, 0x0084, 0x80C5, 0x0085, 0x0084, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5,
+  0x80C5, 0x80C5, 0x80C5, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B,
+  0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x84BF, 0x84BF, 0x84BF,
+  0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF,
+  0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF,
+  0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF,
+  0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF,
+  0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x3085, 0x3085, 0x3085, 0x3085, 0x3085, 0x3085,
+  0x3085, 0x3085, 0x3085, 0x3085, 0x3085, 0x3085, 0x3085, 0x3085, 0x3085, 0x3085, 0x3085, 0x3085,
+  0x3085, 0x3085, 0x3085, 0x3085, 0x3085, 0x3085, 0x3085, 0x3085,
+  /* Block 0xE2 */
+  0x00C4, 0x80C5, 0x80C5, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF,
+  0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4,
+  0x00C4, 0x00C4, 0x80C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4,
+  0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x80C4,
+  0x00C4, 0x00C4, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x00CB,
+  0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4,
+  0x00C4, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x80C5, 0x80C5, 0x84BF, 0x84BF,
+  0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF,
+  0x80CC, 0x80CC, 0x80CC, 0x80CC, 0x80CC, 0x80CC, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF,
+  0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF,
+  0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF,
+  /* Block 0xE3 */
+  0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF,
+  0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF,
+  0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF,
+  0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF,
+  0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF,
+  0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF,
+  0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF,
+  0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF,
+  0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF,
+  0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF,
+  0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF,
+  /* Block 0xE4 */
+  0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5,
+  0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5,
+  0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x8089, 0x8089, 0x8089,
+  0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x80CA, 0x80CA, 0x80CA,
+  0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x8089, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5,
+  0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5,
+  0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5,
+  0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5,
+  0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5,
+  0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5,
+  0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x8089, 0x80CA, 0x80CA,
+  /* Block 0xE5 */
+  0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5,
+  0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x8089, 0x8089, 0x8089, 0x8089,
+  0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x80C5, 0x80C5, 0x80C5, 0x80C5,
+  0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5,
+  0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5,
+  0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C9, 0x80C5, 0x80C5,
+  0x80C5, 0x80C5, 0x80C5, 0x8089, 0x8089, 0x8089, 0x8089, 0x80CA, 0x80CA, 0x80CA, 0x80CA, 0x80CA,
+  0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089,
+  0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5,
+  0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x8089, 0x8089, 0x8089, 0x80C9, 0x8089, 0x8089, 0x8089,
+  0x80CA, 0x80CA, 0x80CA, 0x20CA, 0x20CA, 0x20CA, 0x20CA, 0x20CA,
+  /* Block 0xE6 */
+  0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5,
+  0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5,
+  0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5,
+  0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5,
+  0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5,
+  0x80C5, 0x80C5, 0x80C5, 0x8089, 0x80C5, 0x8089, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5,
+  0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5,
+  0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5,
+  0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5,
+  0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5,
+  0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5,
+  /* Block 0xE7 */
+  0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5,
+  0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5,
+  0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5,
+  0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5,
+  0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5,
+  0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5,
+  0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5,
+  0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5,
+  0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5,
+  0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5,
+  0x80C9, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x8089, 0x8089, 0x80CA,
+  /* Block 0xE8 */
+  0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5,
+  0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5,
+  0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5,
+  0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5,
+  0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5,
+  0x80C5, 0x80C5, 0x0089, 0x0089, 0x0086, 0x0086, 0x0086, 0x0086, 0x0089, 0x0089, 0x8089, 0x8089,
+  0x8089, 0x8089, 0x8089, 0x80CA, 0x80CA, 0x80CA, 0x80CA, 0x808A, 0x80C5, 0x80C5, 0x80C5, 0x80C5,
+  0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5,
+  0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x8089, 0x8089, 0x8089, 0x8089,
+  0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089,
+  0x8089, 0x8089, 0x80CB, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089,
+  /* Block 0xE9 */
+  0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089,
+  0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x80C9, 0x80C9, 0x8089,
+  0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089,
+  0x80CB, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089,
+  0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089,
+  0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089,
+  0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089,
+  0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089,
+  0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089,
+  0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089,
+  0x8089, 0x8089, 0x8089, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5,
+  /* Block 0xEA */
+  0x80C6, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5,
+  0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C6, 0x80C5, 0x80C5, 0x80C5, 0x80C6, 0x80C5, 0x80C6,
+  0x80C5, 0x80C6, 0x80C5, 0x80C6, 0x80C5, 0x80C5, 0x80C5, 0x80C6, 0x80C5, 0x80C5, 0x80C5, 0x80C5,
+  0x80C5, 0x80C5, 0x80C6, 0x80C6, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C6, 0x80C5, 0x80C6, 0x80C6,
+  0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C6, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5,
+  0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C9, 0x80C9, 0x80CA, 0x80CA, 0x80C5, 0x80C5, 0x80C5,
+  0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  /* Block 0xEB */
+  0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5,
+  0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5,
+  0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5,
+  0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5,
+  0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5,
+  0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x80C5, 0x8089, 0x8089,
+  0x8089, 0x8089, 0x8089, 0x8089, 0x80C9, 0x8089, 0x8089, 0x8089, 0x80CA, 0x80CB, 0x80CB, 0x808C,
+  0x808C, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF,
+  0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x8089, 0x80C9,
+  0x80C9, 0x84BF, 0x84BF, 0x84BF, 0x8089, 0x8089, 0x8089, 0x8089, 0x80CB, 0x80CB, 0x80CB, 0x80CC,
+  0x80CC, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF,
+  /* Block 0xEC */
+  0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085,
+  0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085,
+  0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085,
+  0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085,
+  0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085,
+  0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085,
+  0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085,
+  0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085,
+  0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085,
+  0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x84BF, 0x84BF, 0x84BF, 0x84BF,
+  0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF,
+  /* Block 0xED */
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF,
+  0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF,
+  0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF,
+  0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF,
+  /* Block 0xEE */
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  /* Block 0xEF */
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x84BF, 0x84BF, 0x84BF, 0x84BF,
+  0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089,
+  0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x84BF, 0x84BF,
+  0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF,
+  0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF,
+  0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF,
+  0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF,
+  0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF,
+  0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF,
+  0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF,
+  /* Block 0xF0 */
+  0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C, 0x008C,
+  0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x80CA, 0x80CA, 0x80CA, 0x80CA, 0x80CA, 0x80CA, 0x80CA, 0x80CA,
+  0x80CA, 0x80CB, 0x80CB, 0x80CB, 0x80CB, 0x80CB, 0x80CB, 0x80CC, 0x80CB, 0x80CB, 0x80CB, 0x80CB,
+  0x80CB, 0x80CB, 0x80CB, 0x80CB, 0x80CC, 0x80CC, 0x80CC, 0x80CC, 0x80CC, 0x80CC, 0x80CC, 0x80CC,
+  0x80CB, 0x80CC, 0x80CC, 0x80CB, 0x80CB, 0x80CB, 0x80CB, 0x80CB, 0x80CB, 0x80CB, 0x80CB, 0x00CB,
+  0x80CB, 0x80CB, 0x80CB, 0x84BF, 0x80CB, 0x80CB, 0x80CB, 0x80CB, 0x80CB, 0x80CB, 0x00CB, 0x80CB,
+  0x80CB, 0x80CB, 0x80CB, 0x80CB, 0x80CC, 0x84BF, 0x84BF, 0x84BF, 0x80CB, 0x80CB, 0x80CB, 0x80CB,
+  0x80CB, 0x80CB, 0x80CB, 0x80CB, 0x80CB, 0x80CB, 0x80CB, 0x80CB, 0x80CB, 0x80CB, 0x80CB, 0x80CC,
+  0x80CC, 0x80CC, 0x80CC, 0x80CC, 0x80CC, 0x80CC, 0x80CC, 0x80CC, 0x80CC, 0x80CC, 0x80CC, 0x80CC,
+  0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF,
+  0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF,
+  /* Block 0xF1 */
+  0x80CA, 0x80CA, 0x80CA, 0x80CA, 0x80CA, 0x80CB, 0x80CB, 0x80CB, 0x80CB, 0x80CB, 0x80CB, 0x80CB,
+  0x80CB, 0x80CB, 0x80CB, 0x80CB, 0x80CB, 0x80CB, 0x80CC, 0x80CC, 0x80CC, 0x80CC, 0x80CC, 0x80CC,
+  0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF,
+  0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF,
+  0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF,
+  0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x80CA, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF,
+  0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x80CC, 0x80CC, 0x80CC, 0x80CC,
+  0x80CC, 0x80CC, 0x80CC, 0x80CC, 0x80CC, 0x80CC, 0x80CC, 0x80CC, 0x80CC, 0x80CC, 0x80CC, 0x80CC,
+  0x80CC, 0x80CC, 0x80CC, 0x80CC, 0x80CC, 0x80CC, 0x80CC, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF,
+  0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF,
+  0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF,
+  /* Block 0xF2 */
+  0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF,
+  0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF,
+  0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF,
+  0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF,
+  0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF,
+  0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF,
+  0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF,
+  0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF,
+  0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF,
+  0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF,
+  0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x84BF, 0x0480, 0x0480,
+  /* Block 0xF3 */
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF,
+  0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF,
+  0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF,
+  0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF,
+  /* Block 0xF4 */
+  0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4,
+  0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4,
+  0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4,
+  0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4,
+  0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4,
+  0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4,
+  0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4,
+  0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4,
+  0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4,
+  0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4,
+  0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4,
+  /* Block 0xF5 */
+  0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4,
+  0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4,
+  0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4,
+  0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4,
+  0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x00C4, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF,
+  0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5,
+  0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5,
+  0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5,
+  0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5,
+  0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5,
+  0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5,
+  /* Block 0xF6 */
+  0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5,
+  0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5,
+  0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5,
+  0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5,
+  0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5,
+  0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5,
+  0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5,
+  0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5,
+  0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5,
+  0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5,
+  0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5,
+  /* Block 0xF7 */
+  0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5,
+  0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5,
+  0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x00C5, 0x04FF, 0x04FF, 0x00CA, 0x00CA, 0x00CA, 0x00CA,
+  0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA,
+  0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA,
+  0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA,
+  0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA,
+  0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA,
+  0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA,
+  0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA,
+  0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA,
+  /* Block 0xF8 */
+  0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA,
+  0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA,
+  0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA,
+  0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA,
+  0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA,
+  0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA,
+  0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA,
+  0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA,
+  0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA,
+  0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA,
+  0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA,
+  /* Block 0xF9 */
+  0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA,
+  0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA,
+  0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x00CA, 0x04FF, 0x04FF,
+  0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF,
+  0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC,
+  0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC,
+  0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC,
+  0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC,
+  0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC,
+  0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC,
+  0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC,
+  /* Block 0xFA */
+  0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC,
+  0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC,
+  0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC,
+  0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC,
+  0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC,
+  0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC,
+  0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC,
+  0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC,
+  0x00CC, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF,
+  0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF,
+  0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF,
+  /* Block 0xFB */
+  0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF,
+  0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF,
+  0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF,
+  0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF,
+  0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF,
+  0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF,
+  0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF,
+  0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF,
+  0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF,
+  0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF,
+  0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF,
+  /* Block 0xFC */
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF,
+  0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF,
+  0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF,
+  0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF,
+  0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF,
+  0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF,
+  0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF,
+  0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF,
+  0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF,
+  /* Block 0xFD */
+  0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF,
+  0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF,
+  0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF,
+  0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF,
+  0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF,
+  0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF,
+  0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF,
+  0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF,
+  0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF,
+  0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF,
+  0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x04FF, 0x0480, 0x0480,
+  /* Block 0xFE */
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+  0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x0480, 0x0480,
+  /* Block 0xFF */
+  0x1CBF, 0x1940, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF,
+  0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF,
+  0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x2140, 0x2140, 0x2140, 0x2140,
+  0x2140, 0x2140, 0x2140, 0x2140, 0x2140, 0x2140, 0x2140, 0x2140, 0x2140, 0x2140, 0x2140, 0x2140,
+  0x2140, 0x2140, 0x2140, 0x2140, 0x2140, 0x2140, 0x2140, 0x2140, 0x2140, 0x2140, 0x2140, 0x2140,
+  0x2140, 0x2140, 0x2140, 0x2140, 0x2140, 0x2140, 0x2140, 0x2140, 0x2140, 0x2140, 0x2140, 0x2140,
+  0x2140, 0x2140, 0x2140, 0x2140, 0x2140, 0x2140, 0x2140, 0x2140, 0x2140, 0x2140, 0x2140, 0x2140,
+  0x2140, 0x2140, 0x2140, 0x2140, 0x2140, 0x2140, 0x2140, 0x2140, 0x2140, 0x2140, 0x2140, 0x2140,
+  0x2140, 0x2140, 0x2140, 0x2140, 0x2140, 0x2140, 0x2140, 0x2140, 0x2140, 0x2140, 0x2140, 0x2140,
+  0x2140, 0x2140, 0x2140, 0x2140, 0x2140, 0x2140, 0x2140, 0x2140, 0x2140, 0x2140, 0x2140, 0x2140,
+  0x2140, 0x2140, 0x2140, 0x2140, 0x2140, 0x2140, 0x2140, 0x2140,
+  /* Block 0x100 */
+  0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF,
+  0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF,
+  0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF,
+  0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF,
+  0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF,
+  0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF,
+  0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF,
+  0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF,
+  0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF,
+  0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF,
+  0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF,
+  /* Block 0x101 */
+  0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240,
+  0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240,
+  0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240,
+  0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240,
+  0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240,
+  0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240,
+  0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240,
+  0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240,
+  0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240,
+  0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240,
+  0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240,
+  /* Block 0x102 */
+  0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240,
+  0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240,
+  0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240,
+  0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240,
+  0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240,
+  0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240,
+  0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240,
+  0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240,
+  0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240, 0x2240,
+  0x2240, 0x2240, 0x2240, 0x2240, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF,
+  0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF, 0x1CBF,
+  /* Block 0x103 */
+  0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180,
+  0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180,
+  0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180,
+  0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180,
+  0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180,
+  0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180,
+  0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180,
+  0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180,
+  0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180,
+  0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180,
+  0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0480, 0x0480,
 };
-const uint16_t _t3_window_chardata_data_0[96][32] = {
-{ 0x0000, 0x0000, 0x0001, 0x0001, 
-  0x0001, 0x0001, 0x0001, 0x0002, 
-  0x0000, 0x0000, 0x0001, 0x0001, 
-  0x0001, 0x0001, 0x0001, 0x0001, 
-  0x0001, 0x0001, 0x0001, 0x0001, 
-  0x0001, 0x0001, 0x0001, 0x0001, 
-  0x0001, 0x0001, 0x0001, 0x0001, 
-  0x0001, 0x0001, 0x0001, 0x0001},
-{ 0x0001, 0x0001, 0x0001, 0x0003, 
-  0x0004, 0x0001, 0x0001, 0x0001, 
-  0x0001, 0x0001, 0x0001, 0x0001, 
-  0x0001, 0x0001, 0x0001, 0x0001, 
-  0x0005, 0x0005, 0x0005, 0x0005, 
-  0x0005, 0x0006, 0x0005, 0x0007, 
-  0x0008, 0x0001, 0x0009, 0x0001, 
-  0x000A, 0x0001, 0x0001, 0x000B},
-{ 0x0001, 0x0001, 0x0001, 0x0001, 
-  0x0001, 0x0001, 0x0001, 0x0001, 
-  0x000C, 0x0001, 0x0001, 0x0001, 
-  0x000D, 0x0001, 0x0001, 0x000E, 
-  0x0001, 0x000F, 0x0010, 0x0011, 
-  0x0001, 0x0012, 0x0011, 0x0001, 
-  0x0013, 0x0014, 0x0015, 0x0016, 
-  0x0017, 0x0001, 0x0018, 0x0019},
-{ 0x001A, 0x001B, 0x001C, 0x001D, 
-  0x001E, 0x001F, 0x0001, 0x0020, 
-  0x0001, 0x0001, 0x0001, 0x0001, 
-  0x0001, 0x0021, 0x0022, 0x0001, 
-  0x0023, 0x0024, 0x0001, 0x0005, 
-  0x0025, 0x0026, 0x0027, 0x0028, 
-  0x0001, 0x0001, 0x0029, 0x002A, 
-  0x002B, 0x002B, 0x002C, 0x002D},
-{ 0x002E, 0x002F, 0x0030, 0x0031, 
-  0x0032, 0x0033, 0x0034, 0x0035, 
-  0x0035, 0x0035, 0x0036, 0x0037, 
-  0x0035, 0x0038, 0x0039, 0x003A, 
-  0x003B, 0x0001, 0x0001, 0x003C, 
-  0x003D, 0x003E, 0x003F, 0x0040, 
-  0x0041, 0x0042, 0x0043, 0x0044, 
-  0x0045, 0x0046, 0x0047, 0x0048},
-{ 0x0049, 0x0042, 0x0043, 0x004A, 
-  0x004B, 0x004C, 0x004D, 0x004E, 
-  0x004F, 0x0009, 0x0043, 0x0050, 
-  0x0051, 0x0052, 0x0047, 0x0053, 
-  0x0054, 0x0042, 0x0043, 0x0055, 
-  0x0056, 0x0057, 0x0058, 0x0059, 
-  0x005A, 0x005B, 0x005C, 0x005D, 
-  0x005E, 0x005F, 0x0060, 0x0018},
-{ 0x0061, 0x0062, 0x0043, 0x0063, 
-  0x0064, 0x0065, 0x0058, 0x0066, 
-  0x0067, 0x0062, 0x0043, 0x0068, 
-  0x0069, 0x006A, 0x006B, 0x006C, 
-  0x006D, 0x0062, 0x006E, 0x006F, 
-  0x0070, 0x0071, 0x0058, 0x0072, 
-  0x0073, 0x0074, 0x0001, 0x0075, 
-  0x0076, 0x0077, 0x0078, 0x0079},
-{ 0x0011, 0x0001, 0x0001, 0x007A, 
-  0x007B, 0x007C, 0x0035, 0x0035, 
-  0x007D, 0x007E, 0x007F, 0x0080, 
-  0x0081, 0x0082, 0x0035, 0x0035, 
-  0x0001, 0x0083, 0x0001, 0x0084, 
-  0x0085, 0x0001, 0x0086, 0x0087, 
-  0x0088, 0x0089, 0x0005, 0x008A, 
-  0x008B, 0x008C, 0x0035, 0x0035},
-{ 0x0001, 0x0001, 0x008D, 0x008E, 
-  0x0001, 0x008F, 0x0090, 0x0091, 
-  0x0092, 0x0093, 0x0001, 0x0001, 
-  0x0094, 0x0001, 0x0001, 0x0095, 
-  0x0096, 0x0096, 0x0096, 0x0096, 
-  0x0096, 0x0097, 0x0001, 0x0001, 
-  0x0001, 0x0001, 0x0098, 0x0001, 
-  0x0001, 0x0001, 0x0001, 0x0099},
-{ 0x009A, 0x0001, 0x0001, 0x0001, 
-  0x009B, 0x009C, 0x0001, 0x0001, 
-  0x009B, 0x0001, 0x009D, 0x009E, 
-  0x009F, 0x00A0, 0x009D, 0x0001, 
-  0x009D, 0x009F, 0x0001, 0x0001, 
-  0x009A, 0x00A1, 0x00A2, 0x00A3, 
-  0x0026, 0x00A4, 0x0001, 0x0001, 
-  0x0001, 0x0001, 0x0001, 0x00A5},
-{ 0x00A6, 0x0001, 0x0001, 0x0001, 
-  0x0001, 0x0001, 0x0001, 0x0001, 
-  0x0001, 0x0001, 0x0001, 0x0001, 
-  0x0001, 0x0001, 0x0001, 0x0001, 
-  0x0001, 0x0001, 0x0001, 0x0001, 
-  0x0001, 0x0001, 0x0001, 0x0001, 
-  0x0001, 0x0001, 0x0001, 0x0001, 
-  0x0001, 0x0001, 0x0001, 0x0001},
-{ 0x0001, 0x0001, 0x0001, 0x0001, 
-  0x0001, 0x0001, 0x0001, 0x00A7, 
-  0x0001, 0x00A3, 0x0001, 0x0001, 
-  0x0001, 0x0001, 0x0001, 0x00A8, 
-  0x00A9, 0x00AA, 0x0001, 0x00AB, 
-  0x0001, 0x00AC, 0x00A9, 0x00AD, 
-  0x0001, 0x0001, 0x0001, 0x00AE, 
-  0x00AF, 0x00B0, 0x00B1, 0x00B1},
-{ 0x00B2, 0x00B1, 0x0001, 0x0001, 
-  0x0001, 0x0001, 0x0001, 0x00B3, 
-  0x00B4, 0x0001, 0x00B5, 0x002E, 
-  0x002E, 0x002E, 0x002E, 0x00B6, 
-  0x0001, 0x00B7, 0x00B8, 0x00B9, 
-  0x00BA, 0x0001, 0x00BB, 0x0019, 
-  0x0026, 0x0026, 0x00BC, 0x0026, 
-  0x00A4, 0x00BD, 0x0001, 0x0001},
-{ 0x0026, 0x00BE, 0x002E, 0x002E, 
-  0x002E, 0x00BF, 0x00C0, 0x00C1, 
-  0x00C2, 0x00C2, 0x00C3, 0x00C4, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x00C5, 0x002B, 0x002B, 0x00C6, 
-  0x00C7, 0x002B, 0x002C, 0x00C8, 
-  0x00C9, 0x0028, 0x00CA, 0x00CB, 
-  0x0032, 0x0032, 0x00CC, 0x00CD},
-{ 0x0028, 0x0028, 0x00CE, 0x00CF, 
-  0x00D0, 0x0028, 0x0028, 0x0028, 
-  0x00D1, 0x0035, 0x0035, 0x0035, 
-  0x00D2, 0x00D3, 0x00D4, 0x00D5, 
-  0x0001, 0x0001, 0x0001, 0x0001, 
-  0x0001, 0x0001, 0x000B, 0x0026, 
-  0x0026, 0x0026, 0x0026, 0x0026, 
-  0x00D6, 0x00D7, 0x00D8, 0x00D9},
-{ 0x0001, 0x0001, 0x0001, 0x0001, 
-  0x0001, 0x0001, 0x0001, 0x0001, 
-  0x0001, 0x00DA, 0x0001, 0x0001, 
-  0x0001, 0x0001, 0x0001, 0x00DB, 
-  0x0001, 0x00DC, 0x0001, 0x0001, 
-  0x00DC, 0x00DD, 0x0001, 0x00BB, 
-  0x0001, 0x0001, 0x0001, 0x00DE, 
-  0x00DE, 0x00DF, 0x0001, 0x00E0},
-{ 0x001E, 0x0001, 0x00E1, 0x0001, 
-  0x0001, 0x00E2, 0x00E3, 0x00E4, 
-  0x00E5, 0x00E6, 0x0001, 0x00E7, 
-  0x0035, 0x0005, 0x00E8, 0x00E9, 
-  0x0001, 0x0001, 0x0001, 0x00EA, 
-  0x00EB, 0x00EC, 0x0001, 0x0001, 
-  0x00ED, 0x0001, 0x0001, 0x0001, 
-  0x0001, 0x0001, 0x0001, 0x0001},
-{ 0x0001, 0x0001, 0x0001, 0x0001, 
-  0x0001, 0x0001, 0x0001, 0x0001, 
-  0x0001, 0x0001, 0x0001, 0x0001, 
-  0x0001, 0x0001, 0x0001, 0x0001, 
-  0x0001, 0x00EE, 0x00EF, 0x0001, 
-  0x0001, 0x0001, 0x0001, 0x0001, 
-  0x0001, 0x0001, 0x0001, 0x0001, 
-  0x0001, 0x00F0, 0x00F1, 0x00F2},
-{ 0x0001, 0x0001, 0x00F3, 0x0035, 
-  0x0018, 0x0035, 0x0001, 0x0001, 
-  0x0001, 0x0001, 0x0001, 0x0001, 
-  0x0001, 0x0001, 0x0001, 0x0001, 
-  0x0001, 0x0001, 0x0001, 0x0001, 
-  0x0001, 0x0001, 0x0001, 0x0001, 
-  0x0001, 0x0001, 0x0001, 0x0001, 
-  0x0001, 0x0001, 0x0001, 0x00F4},
-{ 0x0001, 0x00F5, 0x0001, 0x0001, 
-  0x00F6, 0x00F7, 0x0001, 0x00F8, 
-  0x0001, 0x00F9, 0x00FA, 0x00FB, 
-  0x00FC, 0x00FD, 0x00FE, 0x00FF, 
-  0x0100, 0x0001, 0x0101, 0x0001, 
-  0x0102, 0x0103, 0x001C, 0x0001, 
-  0x0001, 0x0104, 0x0001, 0x0105, 
-  0x0106, 0x0001, 0x00DA, 0x0001},
-{ 0x0001, 0x0001, 0x0001, 0x0001, 
-  0x0001, 0x0001, 0x0001, 0x0001, 
-  0x0001, 0x0001, 0x0001, 0x0001, 
-  0x0001, 0x0001, 0x0001, 0x0001, 
-  0x0001, 0x0001, 0x0001, 0x0001, 
-  0x0001, 0x0001, 0x0001, 0x0001, 
-  0x0001, 0x0001, 0x0001, 0x0001, 
-  0x0001, 0x0001, 0x0001, 0x0001},
-{ 0x0001, 0x0001, 0x0001, 0x0001, 
-  0x0001, 0x0001, 0x0001, 0x0001, 
-  0x0001, 0x0001, 0x0001, 0x0001, 
-  0x0001, 0x0001, 0x0001, 0x0001, 
-  0x0107, 0x0108, 0x000F, 0x0028, 
-  0x0109, 0x010A, 0x010B, 0x010C, 
-  0x010B, 0x010D, 0x010B, 0x010E, 
-  0x010F, 0x0110, 0x0111, 0x0035},
-{ 0x0026, 0x0026, 0x0112, 0x0026, 
-  0x0026, 0x0112, 0x0113, 0x0114, 
-  0x0026, 0x0026, 0x0026, 0x0026, 
-  0x0026, 0x0026, 0x0115, 0x0116, 
-  0x0026, 0x0026, 0x0117, 0x0026, 
-  0x0026, 0x0026, 0x0118, 0x0119, 
-  0x0026, 0x011A, 0x011B, 0x011B, 
-  0x011B, 0x011B, 0x00D7, 0x00D7},
-{ 0x0026, 0x011C, 0x0028, 0x011D, 
-  0x011E, 0x0035, 0x0035, 0x0035, 
-  0x0096, 0x011F, 0x0096, 0x0096, 
-  0x0096, 0x0096, 0x0096, 0x0120, 
-  0x0096, 0x0096, 0x0096, 0x0096, 
-  0x0096, 0x0096, 0x0096, 0x0096, 
-  0x0096, 0x0096, 0x0096, 0x0096, 
-  0x0096, 0x0121, 0x0035, 0x0122},
-{ 0x0096, 0x0096, 0x0123, 0x0124, 
-  0x0125, 0x0096, 0x0096, 0x0096, 
-  0x0096, 0x0126, 0x0096, 0x0096, 
-  0x0096, 0x0096, 0x0096, 0x0096, 
-  0x0127, 0x0096, 0x0128, 0x0125, 
-  0x0096, 0x0096, 0x0096, 0x0096, 
-  0x0129, 0x0096, 0x0096, 0x012A, 
-  0x012B, 0x012C, 0x012D, 0x0096},
-{ 0x0096, 0x0129, 0x0096, 0x0096, 
-  0x012E, 0x0096, 0x0096, 0x012F, 
-  0x0096, 0x0096, 0x0096, 0x0096, 
-  0x0096, 0x0096, 0x0096, 0x0129, 
-  0x0096, 0x0096, 0x0096, 0x0096, 
-  0x0096, 0x0096, 0x0096, 0x0096, 
-  0x0096, 0x0096, 0x0096, 0x0096, 
-  0x0096, 0x0096, 0x0096, 0x0096},
-{ 0x0096, 0x0096, 0x0096, 0x0096, 
-  0x0096, 0x0096, 0x0096, 0x0096, 
-  0x0096, 0x0096, 0x0096, 0x0096, 
-  0x0096, 0x0096, 0x0096, 0x0096, 
-  0x0096, 0x0096, 0x0096, 0x0096, 
-  0x0096, 0x0096, 0x0096, 0x0096, 
-  0x0096, 0x0096, 0x0096, 0x0096, 
-  0x0096, 0x0096, 0x0096, 0x0096},
-{ 0x0096, 0x0096, 0x0096, 0x0096, 
-  0x0096, 0x0096, 0x0096, 0x0096, 
-  0x0096, 0x0096, 0x0096, 0x0096, 
-  0x0096, 0x0096, 0x0096, 0x0096, 
-  0x0096, 0x0096, 0x0096, 0x0096, 
-  0x0096, 0x0096, 0x0096, 0x0096, 
-  0x0096, 0x0096, 0x0096, 0x0130, 
-  0x0001, 0x0001, 0x0001, 0x0001},
-{ 0x0096, 0x0096, 0x0096, 0x0096, 
-  0x0096, 0x0096, 0x0096, 0x0096, 
-  0x0096, 0x0096, 0x0096, 0x0096, 
-  0x0096, 0x0096, 0x0096, 0x0096, 
-  0x0096, 0x0096, 0x0096, 0x0096, 
-  0x0096, 0x0096, 0x0096, 0x0096, 
-  0x0096, 0x0096, 0x0131, 0x0132, 
-  0x0133, 0x0134, 0x0135, 0x0136},
-{ 0x0096, 0x0096, 0x0096, 0x0096, 
-  0x0096, 0x0096, 0x0096, 0x0096, 
-  0x0137, 0x0096, 0x0096, 0x0096, 
-  0x0138, 0x002E, 0x002E, 0x002E, 
-  0x0028, 0x0028, 0x0028, 0x0028, 
-  0x0028, 0x0028, 0x0028, 0x0028, 
-  0x0028, 0x0028, 0x0028, 0x0028, 
-  0x0028, 0x0028, 0x0028, 0x0028},
-{ 0x0028, 0x0028, 0x0139, 0x0035, 
-  0x0028, 0x0028, 0x013A, 0x013B, 
-  0x0028, 0x013C, 0x002E, 0x002E, 
-  0x002E, 0x002E, 0x002E, 0x013D, 
-  0x0026, 0x013E, 0x013F, 0x0028, 
-  0x0028, 0x0028, 0x0028, 0x0028, 
-  0x0140, 0x0141, 0x0142, 0x0143, 
-  0x0035, 0x0035, 0x0035, 0x0144},
-{ 0x0145, 0x0026, 0x0146, 0x00C2, 
-  0x002B, 0x002B, 0x002B, 0x0147, 
-  0x0028, 0x0028, 0x0028, 0x0028, 
-  0x0148, 0x0149, 0x014A, 0x014B, 
-  0x0028, 0x0028, 0x014C, 0x0028, 
-  0x014D, 0x014E, 0x014F, 0x0150, 
-  0x0151, 0x002E, 0x002E, 0x0152, 
-  0x0153, 0x0154, 0x0155, 0x0156},
-{ 0x0028, 0x0028, 0x0157, 0x0158, 
-  0x0159, 0x015A, 0x002E, 0x015B, 
-  0x002E, 0x002E, 0x002E, 0x015C, 
-  0x015D, 0x015E, 0x015F, 0x0160, 
-  0x0161, 0x0162, 0x0163, 0x010B, 
-  0x010B, 0x010B, 0x0164, 0x0165, 
-  0x0165, 0x0165, 0x0165, 0x0165, 
-  0x002E, 0x002E, 0x0166, 0x00C2},
-{ 0x0096, 0x0096, 0x0096, 0x0096, 
-  0x0096, 0x0096, 0x0096, 0x0096, 
-  0x0096, 0x0096, 0x0096, 0x0096, 
-  0x0096, 0x0096, 0x0096, 0x0096, 
-  0x0096, 0x0096, 0x0096, 0x0096, 
-  0x0096, 0x0096, 0x0096, 0x0096, 
-  0x0096, 0x0096, 0x0120, 0x002E, 
-  0x0167, 0x002E, 0x002E, 0x0168},
-{ 0x0001, 0x0001, 0x0001, 0x0001, 
-  0x0001, 0x0001, 0x0001, 0x0001, 
-  0x0001, 0x0001, 0x0001, 0x0001, 
-  0x0001, 0x0001, 0x0001, 0x0001, 
-  0x0096, 0x0096, 0x0096, 0x0096, 
-  0x0096, 0x0096, 0x0096, 0x0096, 
-  0x0096, 0x0096, 0x0096, 0x0096, 
-  0x0096, 0x0096, 0x0096, 0x0096},
-{ 0x0096, 0x0096, 0x0169, 0x0096, 
-  0x0096, 0x0096, 0x016A, 0x012B, 
-  0x012B, 0x012B, 0x012B, 0x012B, 
-  0x012B, 0x016B, 0x0136, 0x0136, 
-  0x00F3, 0x016C, 0x0001, 0x016D, 
-  0x016E, 0x0001, 0x0001, 0x0001, 
-  0x0001, 0x0001, 0x0001, 0x016F, 
-  0x0170, 0x0171, 0x0001, 0x0001},
-{ 0x0001, 0x0001, 0x0001, 0x0001, 
-  0x0001, 0x0001, 0x0001, 0x0001, 
-  0x0001, 0x0001, 0x0001, 0x0001, 
-  0x0001, 0x0001, 0x0001, 0x0001, 
-  0x0001, 0x0001, 0x0001, 0x0001, 
-  0x0035, 0x0001, 0x0001, 0x0001, 
-  0x0001, 0x0172, 0x0001, 0x0001, 
-  0x00B3, 0x0001, 0x0001, 0x00BB},
-{ 0x0005, 0x0173, 0x0174, 0x0096, 
-  0x0096, 0x0175, 0x0176, 0x00DE, 
-  0x0001, 0x0001, 0x0001, 0x0001, 
-  0x0001, 0x0001, 0x0001, 0x0177, 
-  0x0125, 0x0096, 0x0096, 0x0096, 
-  0x0096, 0x0096, 0x0178, 0x0001, 
-  0x0001, 0x0001, 0x0001, 0x00E5, 
-  0x0179, 0x017A, 0x017B, 0x017C},
-{ 0x017D, 0x0001, 0x00A0, 0x017E, 
-  0x00BB, 0x00BB, 0x0035, 0x0035, 
-  0x0001, 0x0001, 0x0001, 0x0001, 
-  0x0001, 0x0001, 0x0001, 0x0018, 
-  0x017F, 0x0001, 0x0001, 0x0180, 
-  0x0026, 0x0026, 0x0026, 0x0026, 
-  0x0181, 0x0139, 0x0182, 0x0035, 
-  0x0035, 0x0028, 0x0028, 0x0183},
-{ 0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0028, 0x0184, 0x0028, 0x0028, 
-  0x0028, 0x0185, 0x0186, 0x0187, 
-  0x0001, 0x0188, 0x0189, 0x0001, 
-  0x0018, 0x010B, 0x010B, 0x018A, 
-  0x0001, 0x018B, 0x0026, 0x0026, 
-  0x018C, 0x018D, 0x0035, 0x0035},
-{ 0x0001, 0x0001, 0x0001, 0x0001, 
-  0x0001, 0x0001, 0x0001, 0x0001, 
-  0x0001, 0x00BB, 0x00B1, 0x018E, 
-  0x018E, 0x018F, 0x018E, 0x0190, 
-  0x010B, 0x010B, 0x0191, 0x010B, 
-  0x010B, 0x010B, 0x0192, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035},
-{ 0x010B, 0x010B, 0x010B, 0x010B, 
-  0x010B, 0x010B, 0x010B, 0x010B, 
-  0x010B, 0x010B, 0x010B, 0x010B, 
-  0x010B, 0x010B, 0x010B, 0x010B, 
-  0x010B, 0x010B, 0x010B, 0x0193, 
-  0x010B, 0x0194, 0x0191, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035},
-{ 0x0195, 0x0001, 0x0001, 0x0196, 
-  0x002E, 0x0197, 0x010B, 0x010B, 
-  0x010B, 0x0156, 0x0198, 0x0035, 
-  0x0035, 0x0035, 0x0165, 0x0199, 
-  0x002B, 0x019A, 0x0028, 0x019B, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x019C, 0x019C, 0x019C, 0x019D, 
-  0x0165, 0x019E, 0x0165, 0x0165},
-{ 0x019F, 0x01A0, 0x0026, 0x01A1, 
-  0x01A2, 0x01A3, 0x002E, 0x002E, 
-  0x010B, 0x010B, 0x0035, 0x0035, 
-  0x010B, 0x010B, 0x01A4, 0x0193, 
-  0x002E, 0x002E, 0x002E, 0x01A5, 
-  0x002E, 0x01A6, 0x002E, 0x01A7, 
-  0x010B, 0x01A8, 0x01A9, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035},
-{ 0x002E, 0x002E, 0x002E, 0x002E, 
-  0x01AA, 0x0035, 0x0035, 0x0035, 
-  0x0165, 0x0165, 0x0165, 0x01AB, 
-  0x0165, 0x0165, 0x0165, 0x01AC, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035},
-{ 0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x002E, 0x0031, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035},
-{ 0x01AD, 0x0032, 0x0032, 0x01AE, 
-  0x01AF, 0x01B0, 0x0032, 0x01B1, 
-  0x01B2, 0x002E, 0x002E, 0x01B3, 
-  0x01B4, 0x019C, 0x01B5, 0x01B6, 
-  0x01B7, 0x019C, 0x01B8, 0x01B9, 
-  0x01BA, 0x010B, 0x010B, 0x01BB, 
-  0x01BC, 0x019C, 0x019C, 0x01BD, 
-  0x01BE, 0x01BF, 0x01C0, 0x01C1},
-{ 0x010B, 0x01C2, 0x01C3, 0x01C4, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x01C5, 0x01C6, 0x01C7, 0x010B, 
-  0x010B, 0x01C3, 0x01C8, 0x01C9, 
-  0x01CA, 0x01CB, 0x010F, 0x01CC, 
-  0x01CD, 0x01CE, 0x01CF, 0x01D0, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035},
-{ 0x018E, 0x018E, 0x018E, 0x01D1, 
-  0x01D2, 0x01D3, 0x0035, 0x0035, 
-  0x010B, 0x010B, 0x010B, 0x01D4, 
-  0x01D5, 0x01C9, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x010B, 0x010B, 0x010B, 0x01D6, 
-  0x01D7, 0x01D8, 0x0035, 0x0035},
-{ 0x010B, 0x010B, 0x010B, 0x01D9, 
-  0x01DA, 0x01C9, 0x01DB, 0x0035, 
-  0x019C, 0x019C, 0x01DC, 0x01DD, 
-  0x01B6, 0x0035, 0x0035, 0x0035, 
-  0x0165, 0x01DE, 0x01DF, 0x0165, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035},
-{ 0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x010B, 0x010B, 
-  0x010B, 0x010B, 0x010B, 0x01E0, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035},
-{ 0x01E1, 0x01E2, 0x01E2, 0x01E3, 
-  0x01E4, 0x01E5, 0x01E2, 0x01E2, 
-  0x01E6, 0x01E7, 0x01E8, 0x0035, 
-  0x010B, 0x010B, 0x010B, 0x01E9, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035},
-{ 0x01EA, 0x018E, 0x018E, 0x01EB, 
-  0x01EC, 0x018E, 0x01DB, 0x018E, 
-  0x018E, 0x01ED, 0x01EE, 0x01EF, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x01F0, 0x01E2, 0x01E2, 0x01F1, 
-  0x01F2, 0x01F3, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035},
-{ 0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035},
-{ 0x002B, 0x002B, 0x002B, 0x002B, 
-  0x002B, 0x002B, 0x002B, 0x002B, 
-  0x002B, 0x002B, 0x002B, 0x002B, 
-  0x002B, 0x002B, 0x002B, 0x002B, 
-  0x002B, 0x002B, 0x002B, 0x002B, 
-  0x002B, 0x002B, 0x002B, 0x002B, 
-  0x002B, 0x002B, 0x002B, 0x002B, 
-  0x002B, 0x002B, 0x002B, 0x002B},
-{ 0x002B, 0x002B, 0x002B, 0x002B, 
-  0x002B, 0x002B, 0x002B, 0x002B, 
-  0x002B, 0x002B, 0x002B, 0x002B, 
-  0x002B, 0x002B, 0x002B, 0x002B, 
-  0x002B, 0x002B, 0x002B, 0x002B, 
-  0x002B, 0x002B, 0x01F4, 0x010B, 
-  0x010B, 0x01F5, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035},
-{ 0x002B, 0x002B, 0x002B, 0x002B, 
-  0x002B, 0x002B, 0x01F6, 0x01F7, 
-  0x0165, 0x0165, 0x0165, 0x0165, 
-  0x0165, 0x0165, 0x0165, 0x0165, 
-  0x0165, 0x0165, 0x0165, 0x0165, 
-  0x01F8, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035},
-{ 0x002E, 0x002E, 0x002E, 0x002E, 
-  0x002E, 0x002E, 0x002E, 0x002E, 
-  0x002E, 0x002E, 0x002E, 0x002E, 
-  0x002E, 0x002E, 0x002E, 0x002E, 
-  0x002E, 0x002E, 0x002E, 0x002E, 
-  0x002E, 0x002E, 0x002E, 0x002E, 
-  0x002E, 0x002E, 0x002E, 0x002E, 
-  0x002E, 0x002E, 0x002E, 0x002E},
-{ 0x002E, 0x002E, 0x0031, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035},
-{ 0x0165, 0x0165, 0x0165, 0x0165, 
-  0x0165, 0x0165, 0x0165, 0x0165, 
-  0x0165, 0x0165, 0x0165, 0x0165, 
-  0x0165, 0x0165, 0x0165, 0x0165, 
-  0x0165, 0x0165, 0x0165, 0x0165, 
-  0x0165, 0x0165, 0x0165, 0x0165, 
-  0x0165, 0x0165, 0x0165, 0x0165, 
-  0x0165, 0x0165, 0x0165, 0x0165},
-{ 0x0165, 0x0165, 0x0165, 0x0165, 
-  0x01F9, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035},
-{ 0x0032, 0x0032, 0x0032, 0x0032, 
-  0x0032, 0x0032, 0x0032, 0x0032, 
-  0x0032, 0x0032, 0x0032, 0x0032, 
-  0x0032, 0x0032, 0x0032, 0x0032, 
-  0x0032, 0x0032, 0x0032, 0x0032, 
-  0x0032, 0x0032, 0x0032, 0x0032, 
-  0x0032, 0x0032, 0x0032, 0x0032, 
-  0x0032, 0x0032, 0x0032, 0x0032},
-{ 0x0032, 0x0032, 0x0032, 0x01FA, 
-  0x010B, 0x0156, 0x01FB, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x010B, 0x01FC, 0x01FD, 
-  0x010B, 0x010B, 0x010B, 0x01FE, 
-  0x0194, 0x01FF, 0x01C2, 0x0200, 
-  0x010B, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035},
-{ 0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x019C, 0x019C, 0x019C, 0x019C, 
-  0x0201, 0x019C, 0x019C, 0x0202, 
-  0x0203, 0x01B7, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0204, 0x0035},
-{ 0x0205, 0x0205, 0x0205, 0x0205, 
-  0x0205, 0x0205, 0x0205, 0x0205, 
-  0x0205, 0x0205, 0x0205, 0x0205, 
-  0x0205, 0x0205, 0x0205, 0x0205, 
-  0x0205, 0x0205, 0x0205, 0x0205, 
-  0x0205, 0x0205, 0x0205, 0x0205, 
-  0x0205, 0x0205, 0x0205, 0x0205, 
-  0x0205, 0x0205, 0x0205, 0x0205},
-{ 0x0205, 0x0205, 0x0205, 0x0205, 
-  0x0205, 0x0205, 0x0205, 0x0205, 
-  0x0205, 0x0205, 0x0205, 0x0205, 
-  0x0205, 0x0205, 0x0205, 0x0205, 
-  0x0205, 0x0205, 0x0205, 0x0205, 
-  0x0205, 0x0205, 0x0205, 0x0205, 
-  0x0205, 0x0205, 0x0205, 0x0205, 
-  0x0205, 0x0205, 0x0206, 0x0035},
-{ 0x0205, 0x0205, 0x0205, 0x0205, 
-  0x0205, 0x0205, 0x0205, 0x0205, 
-  0x0205, 0x0205, 0x0205, 0x0205, 
-  0x0205, 0x0205, 0x0205, 0x0207, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035},
-{ 0x0208, 0x0209, 0x0209, 0x0209, 
-  0x0209, 0x0209, 0x0209, 0x0209, 
-  0x0209, 0x0209, 0x0209, 0x0209, 
-  0x0209, 0x0209, 0x0209, 0x0209, 
-  0x0209, 0x020A, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0209, 
-  0x0209, 0x0209, 0x0209, 0x0209, 
-  0x0209, 0x0209, 0x0209, 0x0209},
-{ 0x0209, 0x0209, 0x0209, 0x0209, 
-  0x0209, 0x0209, 0x0209, 0x0209, 
-  0x0209, 0x0209, 0x0209, 0x0209, 
-  0x0209, 0x0209, 0x0209, 0x020B, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035},
-{ 0x010B, 0x010B, 0x010B, 0x010B, 
-  0x010B, 0x010B, 0x020C, 0x020D, 
-  0x01E9, 0x020E, 0x020F, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035},
-{ 0x0001, 0x0001, 0x0001, 0x0001, 
-  0x0001, 0x0001, 0x0001, 0x0001, 
-  0x0001, 0x0001, 0x0001, 0x0001, 
-  0x0001, 0x0001, 0x0001, 0x0210, 
-  0x0001, 0x0001, 0x0211, 0x0001, 
-  0x0001, 0x0001, 0x0212, 0x0213, 
-  0x0214, 0x0001, 0x0215, 0x0001, 
-  0x0001, 0x0216, 0x0217, 0x0035},
-{ 0x0026, 0x0026, 0x0026, 0x0026, 
-  0x0218, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0001, 0x0001, 0x0001, 0x0001, 
-  0x0001, 0x00F3, 0x002B, 0x0219, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035},
-{ 0x0001, 0x0001, 0x0001, 0x0001, 
-  0x0001, 0x00DE, 0x0001, 0x0001, 
-  0x0001, 0x00A9, 0x021A, 0x021B, 
-  0x021C, 0x0001, 0x0001, 0x0001, 
-  0x021D, 0x021E, 0x0001, 0x021F, 
-  0x0220, 0x0062, 0x0001, 0x0001, 
-  0x0001, 0x0001, 0x0001, 0x0001, 
-  0x0001, 0x0001, 0x0001, 0x0001},
-{ 0x0001, 0x0001, 0x0001, 0x0001, 
-  0x0001, 0x0001, 0x0001, 0x0001, 
-  0x0001, 0x0001, 0x0221, 0x0001, 
-  0x0001, 0x0001, 0x0001, 0x0001, 
-  0x0001, 0x0001, 0x0001, 0x0001, 
-  0x0001, 0x0001, 0x0001, 0x0001, 
-  0x0001, 0x0001, 0x0001, 0x0001, 
-  0x0222, 0x0001, 0x0001, 0x0001},
-{ 0x0223, 0x0223, 0x0223, 0x0224, 
-  0x0223, 0x0223, 0x0225, 0x0226, 
-  0x0227, 0x0228, 0x0229, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035},
-{ 0x022A, 0x022B, 0x022C, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035},
-{ 0x010B, 0x010B, 0x010B, 0x010B, 
-  0x010B, 0x010B, 0x010B, 0x010B, 
-  0x010B, 0x010B, 0x010B, 0x010B, 
-  0x022D, 0x022E, 0x0035, 0x0035, 
-  0x018E, 0x018E, 0x018E, 0x018E, 
-  0x022F, 0x0230, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035},
-{ 0x0231, 0x019C, 0x0232, 0x0233, 
-  0x0234, 0x0235, 0x0236, 0x0237, 
-  0x0238, 0x0239, 0x023A, 0x0239, 
-  0x0035, 0x0035, 0x0035, 0x023B, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035},
-{ 0x023C, 0x0028, 0x0139, 0x0028, 
-  0x0028, 0x0028, 0x0028, 0x0028, 
-  0x0028, 0x023D, 0x023E, 0x023F, 
-  0x0240, 0x0241, 0x010B, 0x0194, 
-  0x0242, 0x002E, 0x0031, 0x0243, 
-  0x0244, 0x0245, 0x0246, 0x0247, 
-  0x0248, 0x0249, 0x01DB, 0x0035, 
-  0x0035, 0x0035, 0x024A, 0x0032},
-{ 0x024B, 0x014F, 0x014F, 0x024C, 
-  0x024D, 0x024E, 0x024F, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0250, 0x0250, 0x0251, 0x0252, 
-  0x0250, 0x0250, 0x0250, 0x0253, 
-  0x0250, 0x0254, 0x0250, 0x0250, 
-  0x0255, 0x0256, 0x0250, 0x0257},
-{ 0x0250, 0x0250, 0x0250, 0x0258, 
-  0x0259, 0x0250, 0x0250, 0x0250, 
-  0x0250, 0x0250, 0x0250, 0x0250, 
-  0x0250, 0x0250, 0x0250, 0x025A, 
-  0x0250, 0x0250, 0x0250, 0x025B, 
-  0x025C, 0x0250, 0x025D, 0x025E, 
-  0x010B, 0x025F, 0x0260, 0x010B, 
-  0x010B, 0x010B, 0x010B, 0x0261},
-{ 0x0262, 0x0263, 0x0264, 0x0265, 
-  0x0266, 0x010B, 0x010B, 0x010B, 
-  0x0250, 0x0250, 0x0250, 0x0250, 
-  0x0267, 0x0268, 0x0269, 0x026A, 
-  0x0032, 0x0032, 0x0032, 0x0032, 
-  0x0032, 0x0032, 0x0032, 0x026B, 
-  0x010B, 0x010B, 0x010B, 0x010B, 
-  0x010B, 0x01C1, 0x0035, 0x0035},
-{ 0x0187, 0x010B, 0x010B, 0x010B, 
-  0x0191, 0x01C9, 0x010B, 0x010B, 
-  0x0191, 0x010B, 0x01FC, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x026C, 0x026D, 0x026E, 0x026F, 
-  0x0270, 0x0271, 0x020B, 0x0035, 
-  0x0272, 0x0273, 0x0035, 0x0035, 
-  0x0274, 0x0209, 0x0275, 0x0035},
-{ 0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0276},
-{ 0x0096, 0x0096, 0x0096, 0x0096, 
-  0x0096, 0x0096, 0x0096, 0x0096, 
-  0x0096, 0x0096, 0x0096, 0x0096, 
-  0x0096, 0x0277, 0x0136, 0x0136, 
-  0x014F, 0x014F, 0x014F, 0x014F, 
-  0x014F, 0x014F, 0x014F, 0x014F, 
-  0x014F, 0x014F, 0x014F, 0x014F, 
-  0x014F, 0x014F, 0x014F, 0x014F},
-{ 0x014F, 0x014F, 0x014F, 0x014F, 
-  0x014F, 0x014F, 0x014F, 0x014F, 
-  0x014F, 0x014F, 0x014F, 0x014F, 
-  0x014F, 0x014F, 0x014F, 0x014F, 
-  0x014F, 0x014F, 0x014F, 0x014F, 
-  0x014F, 0x014F, 0x014F, 0x014F, 
-  0x014F, 0x014F, 0x014F, 0x014F, 
-  0x014F, 0x014F, 0x014F, 0x014F},
-{ 0x014F, 0x014F, 0x014F, 0x014F, 
-  0x014F, 0x014F, 0x014F, 0x014F, 
-  0x014F, 0x014F, 0x014F, 0x014F, 
-  0x014F, 0x014F, 0x014F, 0x014F, 
-  0x014F, 0x014F, 0x014F, 0x0278, 
-  0x0250, 0x0250, 0x0250, 0x0250, 
-  0x0250, 0x0250, 0x0250, 0x0250, 
-  0x0250, 0x0250, 0x0250, 0x0250},
-{ 0x0250, 0x0279, 0x027A, 0x027A, 
-  0x027A, 0x027A, 0x027A, 0x027A, 
-  0x027A, 0x027A, 0x027A, 0x027A, 
-  0x027A, 0x027A, 0x027A, 0x027A, 
-  0x027A, 0x027A, 0x027A, 0x027A, 
-  0x027A, 0x027A, 0x027A, 0x027A, 
-  0x027A, 0x027A, 0x027A, 0x027A, 
-  0x027A, 0x027A, 0x027A, 0x027A},
-{ 0x027A, 0x027A, 0x027A, 0x027A, 
-  0x027A, 0x027A, 0x027A, 0x027A, 
-  0x027A, 0x027A, 0x027A, 0x027A, 
-  0x027A, 0x027A, 0x027A, 0x027A, 
-  0x027A, 0x027A, 0x027A, 0x027A, 
-  0x027A, 0x027A, 0x027A, 0x027A, 
-  0x027A, 0x027A, 0x027A, 0x027A, 
-  0x027A, 0x027A, 0x027A, 0x027A},
-{ 0x027A, 0x027A, 0x027A, 0x027A, 
-  0x027A, 0x027A, 0x027A, 0x027A, 
-  0x027A, 0x027A, 0x027B, 0x0209, 
-  0x0209, 0x0209, 0x0209, 0x0209, 
-  0x0209, 0x0209, 0x0209, 0x0209, 
-  0x0209, 0x0209, 0x0209, 0x0209, 
-  0x0209, 0x0209, 0x0209, 0x0209, 
-  0x0209, 0x0209, 0x0209, 0x0209},
-{ 0x0209, 0x0209, 0x0209, 0x0209, 
-  0x0209, 0x0209, 0x0209, 0x0209, 
-  0x0209, 0x0209, 0x0209, 0x0209, 
-  0x0209, 0x0209, 0x0209, 0x0209, 
-  0x0209, 0x0209, 0x0209, 0x0209, 
-  0x0209, 0x0209, 0x0209, 0x0209, 
-  0x0209, 0x0209, 0x0209, 0x0209, 
-  0x0209, 0x0209, 0x0209, 0x0209},
-{ 0x0209, 0x0209, 0x0209, 0x0209, 
-  0x0209, 0x0209, 0x0209, 0x0209, 
-  0x0209, 0x0209, 0x0209, 0x0209, 
-  0x0209, 0x0209, 0x0209, 0x0209, 
-  0x0209, 0x0209, 0x0209, 0x0209, 
-  0x0209, 0x0209, 0x0209, 0x0209, 
-  0x0209, 0x0209, 0x0209, 0x0209, 
-  0x0209, 0x0209, 0x027C, 0x0136},
-{ 0x0136, 0x0136, 0x0136, 0x0136, 
-  0x0136, 0x0136, 0x0136, 0x0136, 
-  0x0136, 0x0136, 0x0136, 0x0136, 
-  0x0136, 0x0136, 0x0136, 0x0136, 
-  0x0136, 0x0136, 0x0136, 0x0136, 
-  0x0136, 0x0136, 0x0136, 0x0136, 
-  0x0136, 0x0136, 0x0136, 0x0136, 
-  0x0136, 0x0136, 0x0136, 0x0136},
-{ 0x0096, 0x027D, 0x0136, 0x0136, 
-  0x0136, 0x0136, 0x0136, 0x0136, 
-  0x0136, 0x0136, 0x0136, 0x0136, 
-  0x0136, 0x0136, 0x0136, 0x0136, 
-  0x0136, 0x0136, 0x0136, 0x0136, 
-  0x0136, 0x0136, 0x0136, 0x0136, 
-  0x0136, 0x0136, 0x0136, 0x0136, 
-  0x0136, 0x0136, 0x0136, 0x0136},
-{ 0x0136, 0x0136, 0x0136, 0x0136, 
-  0x0136, 0x0136, 0x0136, 0x0136, 
-  0x0136, 0x0136, 0x0136, 0x0136, 
-  0x0136, 0x0136, 0x0136, 0x0136, 
-  0x0136, 0x0136, 0x0136, 0x0136, 
-  0x0136, 0x0136, 0x0136, 0x0136, 
-  0x0136, 0x0136, 0x0136, 0x0136, 
-  0x0136, 0x0136, 0x0136, 0x027E},
-{ 0x027F, 0x0035, 0x0005, 0x0005, 
-  0x0005, 0x0005, 0x0005, 0x0005, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0035, 0x0035, 0x0035, 0x0035, 
-  0x0005, 0x0005, 0x0005, 0x0005, 
-  0x0005, 0x0005, 0x0005, 0x0005, 
-  0x0005, 0x0005, 0x0005, 0x0005, 
-  0x0005, 0x0005, 0x0005, 0x0035}
-};
-const uint8_t _t3_window_chardata_data_idx[] = {
-  0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 
-  0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 
-  0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 
-  0x18, 0x19, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 
-  0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1B, 0x1A, 
-  0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 
-  0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 
-  0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 
-  0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 
-  0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1C, 
-  0x1A, 0x1A, 0x1D, 0x1E, 0x1F, 0x20, 0x1A, 0x1A, 
-  0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 
-  0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 
-  0x1A, 0x1A, 0x1A, 0x21, 0x14, 0x14, 0x14, 0x14, 
-  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 
-  0x14, 0x14, 0x14, 0x14, 0x22, 0x23, 0x24, 0x25, 
-  0x26, 0x27, 0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 
-  0x2E, 0x2F, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 
-  0x36, 0x37, 0x38, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x39, 0x39, 0x3A, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x3B, 0x3C, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x3D, 0x3E, 0x35, 0x3F, 
-  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 
-  0x40, 0x40, 0x40, 0x41, 0x40, 0x42, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x43, 0x44, 0x35, 0x35, 0x35, 0x35, 0x45, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x46, 0x47, 0x48, 0x49, 0x3B, 0x4A, 0x35, 0x35, 
-  0x4B, 0x35, 0x35, 0x35, 0x4C, 0x35, 0x35, 0x4D, 
-  0x4E, 0x4F, 0x50, 0x51, 0x52, 0x35, 0x35, 0x53, 
-  0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 
-  0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 
-  0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 
-  0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 
-  0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 
-  0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 
-  0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 
-  0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 
-  0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 
-  0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 
-  0x1A, 0x1A, 0x1A, 0x54, 0x55, 0x55, 0x55, 0x55, 
-  0x55, 0x55, 0x55, 0x56, 0x57, 0x58, 0x58, 0x58, 
-  0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x59, 
-  0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 
-  0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5B, 0x5C, 0x5C, 
-  0x5C, 0x5C, 0x5C, 0x5C, 0x1A, 0x5D, 0x5C, 0x5E, 
-  0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 
-  0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 
-  0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 
-  0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 
-  0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 
-  0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 
-  0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 
-  0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 
-  0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 
-  0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 
-  0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 
-  0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 
-  0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 
-  0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 
-  0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 
-  0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5E, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x53, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x53, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x53, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x53, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x53, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x53, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x53, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x53, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x53, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x53, 
-  0x5F, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 
-  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x53, 
-  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 
-  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 
-  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 
-  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 
-  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 
-  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 
-  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 
-  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 
-  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 
-  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 
-  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 
-  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 
-  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 
-  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 
-  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 
-  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 
-  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 
-  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 
-  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 
-  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 
-  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 
-  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 
-  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 
-  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 
-  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 
-  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 
-  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 
-  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 
-  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 
-  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 
-  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 
-  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14};
@@ -1,11 +1,42 @@
-/* This file was generated by statrie. DO NOT EDIT. */
+/* This file has been automtically generated by generate_chardata.py. DO NOT EDIT. */
+/* Unicode data: DerivedAge, EastAsianWidth and UnicodeData 10.0.0, GraphemeBreakProperty and
+   emoji-data 14.0.0. */
 #ifndef CHARDATA_H
 #define CHARDATA_H
 #include <stdint.h>
 #include "t3window/window_api.h"
-T3_WINDOW_LOCAL extern const uint8_t _t3_window_chardata_data_2[228][2];
-T3_WINDOW_LOCAL extern const uint8_t _t3_window_chardata_data_1[640][8];
-T3_WINDOW_LOCAL extern const uint16_t _t3_window_chardata_data_0[96][32];
-T3_WINDOW_LOCAL extern const uint8_t _t3_window_chardata_data_idx[];
-#define get_chardata(x) (_t3_window_chardata_data_2[_t3_window_chardata_data_1[_t3_window_chardata_data_0[_t3_window_chardata_data_idx[(x) >> 9]][((x) >> 4) & ((1 << 5) - 1)]][((x) >> 1) & ((1 << 3) - 1)]][((x) >> 0) & ((1 << 1) - 1)])
+
+/* Each entry holds the Unicode version index in bits 0-5, the width + 1 in bits 6-7, the
+   T3_CHARDATA_* category flags in bits 8-10, the Grapheme_Cluster_Break property (T3_GCB_*)
+   in bits 11-14 and the Extended_Pictographic property in bit 15. */
+#define T3_CHARDATA_CONTROL 0x100
+#define T3_CHARDATA_MARK 0x200
+#define T3_CHARDATA_UNASSIGNED 0x400
+#define T3_CHARDATA_VERSION(data) ((data) & 0x3f)
+#define T3_CHARDATA_WIDTH(data) ((int)(((data) >> 6) & 3) - 1)
+#define T3_CHARDATA_EXTENDED_PICTOGRAPHIC 0x8000
+#define T3_CHARDATA_GRAPHEME_BREAK(data) (((data) >> 11) & 0xf)
+enum {
+  T3_GCB_OTHER,
+  T3_GCB_CR,
+  T3_GCB_LF,
+  T3_GCB_CONTROL,
+  T3_GCB_EXTEND,
+  T3_GCB_ZWJ,
+  T3_GCB_REGIONAL_INDICATOR,
+  T3_GCB_PREPEND,
+  T3_GCB_SPACINGMARK,
+  T3_GCB_L,
+  T3_GCB_V,
+  T3_GCB_T,
+  T3_GCB_LV,
+  T3_GCB_LVT
+};
+
+T3_WINDOW_LOCAL extern const uint16_t _t3_window_chardata_index[0x2200];
+T3_WINDOW_LOCAL extern const uint16_t _t3_window_chardata_blocks[0x8200];
+#define get_chardata(x) \
+  (_t3_window_chardata_blocks[((uint32_t)_t3_window_chardata_index[(x) >> 7] << 7) | ((x) & 0x7F)])
+/* Only valid for x < 0x800. */
+#define get_chardata_direct(x) (_t3_window_chardata_blocks[(x)])
 #endif
@@ -36,7 +36,20 @@
 
 #define INITIAL_ALLOC 80
 
-#define _T3_BLOCK_SIZE_TO_WIDTH(x) ((int)((x & 1) + 1))
+/* The line data consists of blocks, each starting with a header followed by the attribute
+   index. The header of a character block holds the number of bytes following the header and
+   whether the character is double width. Run blocks represent a number of spaces with the same
+   attributes and contain only the attribute index. Their header holds the number of spaces and
+   the size of the attribute index. */
+#define _T3_BLOCK_RUN 2
+#define _T3_BLOCK_IS_RUN(x) (((x)&_T3_BLOCK_RUN) != 0)
+#define _T3_BLOCK_SIZE_TO_WIDTH(x) ((int)(((x)&_T3_BLOCK_RUN) ? (x) >> 5 : ((x)&1) + 1))
+#define _T3_BLOCK_SIZE_TO_BYTES(x) ((size_t)(((x)&_T3_BLOCK_RUN) ? ((x) >> 2) & 7 : (x) >> 2))
+#define _T3_BLOCK_HEADER(bytes, width) (((uint32_t)(bytes) << 2) | ((width) == 2 ? 1 : 0))
+#define _T3_RUN_HEADER(attr_bytes, count) \
+  (((uint32_t)(count) << 5) | ((uint32_t)(attr_bytes) << 2) | _T3_BLOCK_RUN)
+/* The maximum number of spaces in a single run block. This keeps the header at four bytes. */
+#define _T3_RUN_MAX 0xffff
 
 typedef struct {
   char *data;    /* Data bytes. */
@@ -46,6 +59,86 @@ typedef struct {
   int allocated; /* Allocated number of bytes. */
 } line_data_t;
 
+/** @internal
+    @brief A block of memory from which the buffers of lines are allocated when the lines are
+        first drawn on. */
+typedef struct line_slab_t {
+  struct line_slab_t *next; /**< The previously allocated slab, or @c NULL. */
+  char *data;               /**< The memory for the line buffers. */
+  size_t size;              /**< The allocated number of bytes in @c data. */
+  size_t fill;              /**< The number of bytes used in @c data. */
+} line_slab_t;
+
+/** @internal
+    @brief An entry in the table of grapheme clusters that do not fit in a grid cell. */
+typedef struct {
+  char *data;    /**< The UTF-8 encoded cluster. */
+  size_t length; /**< The size of @c data. */
+  uint32_t hash; /**< The hash value of @c data. */
+  int refs;      /**< The number of cells referring to this entry, or 0 for unused entries. */
+  int next;      /**< The next entry in the hash chain or the free list, or -1. */
+} grid_intern_entry_t;
+
+/** @internal
+    @brief Cell storage for windows created with ::t3_win_new_grid.
+
+    The cells are stored row by row, with the attribute indices, the text and the flags in
+    separate arrays. Like for line storage, all cells between the first and the last used cell of
+    a row are in use. Cell text of up to four bytes is stored inline, which includes all single
+    code points. Longer grapheme clusters are stored in a per-window table, and the cell only
+    holds the index in that table.
+*/
+typedef struct {
+  uint32_t *attrs;      /**< The attribute index of each cell. */
+  uint32_t *text;       /**< The text of each cell, or the index in @c intern. */
+  unsigned char *flags; /**< The width and flags of each cell. Zero for unused cells. */
+  int *start;           /**< The first used cell of each row. */
+  int *end;             /**< The cell after the last used cell of each row. Equal to @c start for
+                             empty rows. */
+  int width;            /**< The number of cells in a row. */
+
+  grid_intern_entry_t *intern; /**< The table of clusters that do not fit in a cell. */
+  int intern_fill;             /**< The number of elements used in @c intern. */
+  int intern_allocated;        /**< The number of elements allocated in @c intern. */
+  int intern_free;             /**< The first unused entry in @c intern, or -1. */
+  int *intern_buckets;         /**< The heads of the hash chains in @c intern, or -1. */
+  int intern_bucket_count;     /**< The number of hash chains. Zero or a power of two. */
+
+  line_data_t line; /**< Buffer used for encoding a row as blocks, for compositing. */
+} cell_grid_t;
+
+/** @internal
+    @brief A block of memory holding the encoded data of consecutive lines of a log window. */
+typedef struct log_chunk_t {
+  struct log_chunk_t *next; /**< The next (newer) chunk, or @c NULL. */
+  char *data;               /**< The encoded line data. */
+  size_t size;              /**< The allocated number of bytes in @c data. */
+  size_t fill;              /**< The number of bytes used in @c data. */
+  int lines;                /**< The number of lines in the history with data in this chunk. */
+} log_chunk_t;
+
+/** @internal
+    @brief History storage for windows created with ::t3_win_new_log.
+
+    The history is a ring of line_data_t structs, of which the data points into a list of large
+    chunks. The lines are packed in the chunks in order, such that dropping the oldest line only
+    requires releasing the oldest chunk once none of its lines remain.
+*/
+typedef struct {
+  line_data_t *lines; /**< The ring of lines in the history. */
+  int allocated;      /**< The number of elements allocated in @c lines. */
+  int max_lines;      /**< The maximum number of lines in the history. */
+  int first;          /**< The index of the oldest line in @c lines. */
+  int count;          /**< The number of lines in the history. */
+  int offset;         /**< The number of lines the view is scrolled back from the end. */
+
+  log_chunk_t *head;  /**< The oldest chunk. */
+  log_chunk_t *tail;  /**< The newest chunk, to which lines are appended. */
+  log_chunk_t *spare; /**< A released chunk, kept to avoid allocating a new chunk. */
+
+  line_data_t line; /**< Buffer used for drawing a new line. */
+} log_buffer_t;
+
 struct t3_window_t {
   int x, y; /* X and Y coordinates of the t3_window_t. These may be relative to parent, depending on
                relation. */
@@ -61,6 +154,11 @@ struct t3_window_t {
                              Mostly useful for background specification. */
   t3_bool shown;           /* Indicates whether this t3_window_t is visible. */
   line_data_t *lines;      /* The contents of the t3_window_t. */
+  line_slab_t *slab;       /* The memory from which the buffers of lines are allocated. */
+  cell_grid_t *grid;       /* The contents of the t3_window_t, if created by t3_win_new_grid. */
+  log_buffer_t *log;       /* The contents of the t3_window_t, if created by t3_win_new_log. */
+  t3_window_t *canvas;     /* The t3_window_t shown, if created by t3_win_new_viewport. */
+  int canvas_y, canvas_x;  /* The position in canvas shown at the top-left of the t3_window_t. */
   t3_window_t *parent;     /* t3_window_t used for clipping. */
   t3_window_t *anchor;     /* t3_window_t for relative placment. */
   t3_window_t *restrictw;  /* t3_window_t for restricting the placement of the window. [restrict is
@@ -75,6 +173,45 @@ struct t3_window_t {
 };
 
 T3_WINDOW_LOCAL t3_bool _t3_win_refresh_term_line(int line);
+T3_WINDOW_LOCAL void _t3_rotate_lines(line_data_t *lines, int count, int n);
+T3_WINDOW_LOCAL char *_t3_win_slab_alloc(t3_window_t *win, int size);
+T3_WINDOW_LOCAL t3_bool _t3_win_in_slab(const t3_window_t *win, const char *data);
+T3_WINDOW_LOCAL void _t3_win_pool_memory_usage(t3_memory_usage_t *usage);
+T3_WINDOW_LOCAL void _t3_win_pool_release(void);
+
+T3_WINDOW_LOCAL cell_grid_t *_t3_grid_new(int height, int width);
+T3_WINDOW_LOCAL void _t3_grid_free(cell_grid_t *grid);
+T3_WINDOW_LOCAL t3_bool _t3_grid_resize(t3_window_t *win, int height, int width);
+T3_WINDOW_LOCAL t3_bool _t3_grid_write_blocks(t3_window_t *win, const char *blocks, size_t n);
+T3_WINDOW_LOCAL t3_bool _t3_grid_add_zerowidth(t3_window_t *win, const char *str, size_t n);
+T3_WINDOW_LOCAL t3_bool _t3_grid_put_cell(t3_window_t *win, int y, int x, const char *str,
+                                          size_t n, int width, int attr_idx);
+T3_WINDOW_LOCAL void _t3_grid_clear(t3_window_t *win, int y, int x);
+T3_WINDOW_LOCAL void _t3_grid_scroll(t3_window_t *win, int n);
+T3_WINDOW_LOCAL const line_data_t *_t3_grid_get_line(t3_window_t *win, int y);
+T3_WINDOW_LOCAL void _t3_grid_memory_usage(const cell_grid_t *grid, int height,
+                                           t3_memory_usage_t *usage);
+T3_WINDOW_LOCAL void _t3_grid_compact(cell_grid_t *grid);
+
+T3_WINDOW_LOCAL log_buffer_t *_t3_log_new(int max_lines);
+T3_WINDOW_LOCAL void _t3_log_free(log_buffer_t *log);
+T3_WINDOW_LOCAL const line_data_t *_t3_log_get_line(t3_window_t *win, int y);
+T3_WINDOW_LOCAL void _t3_log_memory_usage(const log_buffer_t *log, t3_memory_usage_t *usage);
+T3_WINDOW_LOCAL void _t3_log_compact(log_buffer_t *log);
+T3_WINDOW_LOCAL void _t3_win_scroll_hint(t3_window_t *win, int n);
+
+T3_WINDOW_LOCAL void *_t3_malloc(size_t size);
+T3_WINDOW_LOCAL void *_t3_calloc(size_t count, size_t size);
+T3_WINDOW_LOCAL void *_t3_realloc(void *ptr, size_t size);
+T3_WINDOW_LOCAL void _t3_free(void *ptr);
+T3_WINDOW_LOCAL void *_t3_arena_alloc(size_t size);
+T3_WINDOW_LOCAL void _t3_arena_release(void *ptr);
+T3_WINDOW_LOCAL void _t3_arena_reset(void);
+T3_WINDOW_LOCAL void _t3_arena_free(void);
+T3_WINDOW_LOCAL void _t3_arena_memory_usage(t3_memory_usage_t *usage);
+T3_WINDOW_LOCAL void _t3_attr_map_memory_usage(t3_memory_usage_t *usage);
+T3_WINDOW_LOCAL void _t3_attr_map_compact(void);
+
 T3_WINDOW_LOCAL int _t3_term_get_default_acs(int idx);
 T3_WINDOW_LOCAL void _t3_remove_window(t3_window_t *win);
 
@@ -105,12 +242,15 @@ T3_WINDOW_LOCAL extern fd_set _t3_inset;
 T3_WINDOW_LOCAL extern char *_t3_cup, *_t3_sc, *_t3_rc, *_t3_clear, *_t3_home, *_t3_vpa, *_t3_hpa,
     *_t3_cud, *_t3_cud1, *_t3_cuf, *_t3_cuf1, *_t3_civis, *_t3_cnorm, *_t3_sgr, *_t3_setaf,
     *_t3_setab, *_t3_op, *_t3_smacs, *_t3_rmacs, *_t3_sgr0, *_t3_smul, *_t3_rmul, *_t3_rev,
-    *_t3_bold, *_t3_blink, *_t3_dim, *_t3_setf, *_t3_setb, *_t3_el, *_t3_scp;
+    *_t3_bold, *_t3_blink, *_t3_dim, *_t3_setf, *_t3_setb, *_t3_el, *_t3_scp, *_t3_csr, *_t3_ind,
+    *_t3_indn, *_t3_ri, *_t3_rin;
 T3_WINDOW_LOCAL extern int _t3_lines, _t3_columns;
 T3_WINDOW_LOCAL extern const char *_t3_default_alternate_chars[256];
 T3_WINDOW_LOCAL extern t3_attr_t _t3_attrs, _t3_ansi_attrs, _t3_reset_required_mask;
 T3_WINDOW_LOCAL extern t3_attr_t _t3_ncv;
 T3_WINDOW_LOCAL extern t3_bool _t3_bce;
+T3_WINDOW_LOCAL extern t3_bool _t3_sgr_resets_colors;
+T3_WINDOW_LOCAL extern t3_bool _t3_truecolor;
 T3_WINDOW_LOCAL extern int _t3_colors, _t3_pairs;
 T3_WINDOW_LOCAL extern char _t3_alternate_chars[256];
 T3_WINDOW_LOCAL extern line_data_t _t3_old_data;
@@ -119,22 +259,41 @@ T3_WINDOW_LOCAL extern int _t3_cursor_y, _t3_cursor_x;
 T3_WINDOW_LOCAL extern t3_acs_override_t _t3_acs_override;
 
 T3_WINDOW_LOCAL void _t3_do_cup(int line, int col);
+T3_WINDOW_LOCAL void _t3_term_scroll_hint(int top, int bottom, int n);
 T3_WINDOW_LOCAL void _t3_set_alternate_chars_defaults(void);
 T3_WINDOW_LOCAL void _t3_set_attrs(t3_attr_t new_attrs);
+T3_WINDOW_LOCAL void _t3_set_attrs_rgb(t3_attr_t new_attrs, uint32_t fg_rgb, uint32_t bg_rgb);
 
 T3_WINDOW_LOCAL extern t3_window_t *_t3_head, *_t3_tail;
 T3_WINDOW_LOCAL t3_bool _t3_win_is_shown(t3_window_t *win);
 T3_WINDOW_LOCAL t3_attr_t _t3_term_sanitize_attrs(t3_attr_t attrs);
+T3_WINDOW_LOCAL t3_attr_t _t3_term_resolve_rgb(t3_attr_t attrs, uint32_t fg_rgb, uint32_t bg_rgb);
 
 T3_WINDOW_LOCAL int _t3_map_attr(t3_attr_t attr);
+T3_WINDOW_LOCAL int _t3_map_attr_rgb(t3_attr_t attr, uint32_t fg_rgb, uint32_t bg_rgb);
 T3_WINDOW_LOCAL t3_attr_t _t3_get_attr(int idx);
+T3_WINDOW_LOCAL t3_attr_t _t3_get_attr_rgb(int idx, uint32_t *fg_rgb, uint32_t *bg_rgb);
 T3_WINDOW_LOCAL void _t3_init_attr_map(void);
 T3_WINDOW_LOCAL void _t3_free_attr_map(void);
+T3_WINDOW_LOCAL extern unsigned int _t3_attr_generation;
+
+/** @internal
+    @brief A decoded code point following a grapheme cluster, see ::_t3_utf8_get_cluster. */
+typedef struct {
+  size_t bytes;  /**< The size of the code point, or 0 if not decoded. */
+  unsigned data; /**< The chardata entry of the code point. */
+} cluster_lookahead_t;
 
 #define _t3_get_value(s, size) \
   (((s)[0] & 0x80) ? _t3_get_value_int(s, size) : (uint32_t)(*(size) = 1, (s)[0]))
 T3_WINDOW_LOCAL uint32_t _t3_get_value_int(const char *s, size_t *size);
 T3_WINDOW_LOCAL size_t _t3_put_value(uint32_t c, char *dst);
+T3_WINDOW_LOCAL size_t _t3_printable_ascii_run(const char *str, size_t n);
+T3_WINDOW_LOCAL int _t3_utf8_wcwidth_data(uint32_t c, unsigned data, int *state);
+T3_WINDOW_LOCAL size_t _t3_utf8_get_cluster(const char *str, size_t n, int *width, t3_bool *split,
+                                            cluster_lookahead_t *lookahead, t3_bool use_cache);
+T3_WINDOW_LOCAL t3_bool _t3_utf8_extends_ascii(const char *str, size_t n,
+                                               cluster_lookahead_t *lookahead);
 T3_WINDOW_LOCAL extern int _t3_modifier_hack;
 
 typedef enum {
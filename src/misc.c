@@ -13,6 +13,7 @@
 */
 #include <errno.h>
 #include <stdint.h>
+#include <stdlib.h>
 #include <string.h>
 #ifdef USE_GETTEXT
 #include <libintl.h>
@@ -21,8 +22,32 @@
 #define _(x) (x)
 #endif
 
+#include "internal.h"
 #include "terminal.h"
 
+/** @internal
+    @brief The alignment of allocations from the frame arena. */
+#define ARENA_ALIGN 16
+/** @internal
+    @brief The size of the header of a block of the frame arena, rounded up to ::ARENA_ALIGN. */
+#define ARENA_HEADER ((sizeof(arena_block_t) + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1))
+/** @internal
+    @brief The minimum size of a block of the frame arena. */
+#define ARENA_BLOCK_SIZE 4096
+
+/** @internal
+    @brief A block of memory of the frame arena. The data follows the header. */
+typedef struct arena_block_t {
+  struct arena_block_t *next; /**< The previously filled block, or @c NULL. */
+  size_t size;                /**< The number of bytes available in the block. */
+  size_t fill;                /**< The number of bytes in use. */
+} arena_block_t;
+
+static const t3_allocator_t default_allocator = {malloc, realloc, free};
+static t3_allocator_t allocator = {malloc, realloc, free};
+/** The block of the frame arena allocations are made from. Older blocks are linked from it. */
+static arena_block_t *arena;
+
 /** Get the value of ::T3_WINDOW_VERSION corresponding to the actually used library.
     @ingroup t3window_other
     @return The value of ::T3_WINDOW_VERSION.
@@ -55,3 +80,156 @@ const char *t3_window_strerror(int error) {
       return _("character-set conversion not available");
   }
 }
+
+/** Set the functions used for all memory allocations done by the library.
+    @ingroup t3window_other
+    @param new_allocator The functions to use, or @c NULL to use the C library functions.
+
+    This allows for example the use of a custom allocator, or of a fixed pool of memory on
+    embedded targets. The functions are copied from @p new_allocator. As memory must be
+    released by the allocator that allocated it, this function must be called before any other
+    function of the library, or after all windows have been deleted, the windows kept for reuse
+    have been released with ::t3_win_set_pool_size and ::t3_term_deinit has been called.
+*/
+void t3_set_allocator(const t3_allocator_t *new_allocator) {
+  allocator = new_allocator == NULL ? default_allocator : *new_allocator;
+}
+
+/** @internal
+    @brief Allocate memory using the allocator set with ::t3_set_allocator. */
+void *_t3_malloc(size_t size) { return allocator.malloc_func(size); }
+
+/** @internal
+    @brief Allocate zeroed memory for an array using the allocator set with ::t3_set_allocator. */
+void *_t3_calloc(size_t count, size_t size) {
+  void *result;
+
+  if (size != 0 && count > SIZE_MAX / size) {
+    errno = ENOMEM;
+    return NULL;
+  }
+  if ((result = allocator.malloc_func(count * size)) != NULL) {
+    memset(result, 0, count * size);
+  }
+  return result;
+}
+
+/** @internal
+    @brief Resize memory using the allocator set with ::t3_set_allocator. */
+void *_t3_realloc(void *ptr, size_t size) { return allocator.realloc_func(ptr, size); }
+
+/** @internal
+    @brief Release memory using the allocator set with ::t3_set_allocator. */
+void _t3_free(void *ptr) {
+  if (ptr != NULL) {
+    allocator.free_func(ptr);
+  }
+}
+
+/** @internal
+    @brief Allocate temporary memory from the frame arena.
+    @param size The number of bytes to allocate.
+    @return The allocated memory, or @c NULL if no memory could be allocated.
+
+    The memory remains valid until the end of the next call to ::t3_term_update, and must not be
+    released by the caller. As the arena is kept between updates, updates do not need to allocate
+    memory once the arena has grown to the size required for a single update.
+*/
+void *_t3_arena_alloc(size_t size) {
+  void *result;
+
+  size = (size + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1);
+  if (arena == NULL || arena->size - arena->fill < size) {
+    arena_block_t *block;
+    size_t block_size = arena == NULL ? ARENA_BLOCK_SIZE : 2 * arena->size;
+
+    if (block_size < size) {
+      block_size = size;
+    }
+    if ((block = _t3_malloc(ARENA_HEADER + block_size)) == NULL) {
+      return NULL;
+    }
+    block->next = arena;
+    block->size = block_size;
+    block->fill = 0;
+    arena = block;
+  }
+  result = (char *)arena + ARENA_HEADER + arena->fill;
+  arena->fill += size;
+  return result;
+}
+
+/** @internal
+    @brief Release an allocation from the frame arena, together with all later allocations.
+    @param ptr The memory to release, as returned by ::_t3_arena_alloc.
+
+    This allows memory that is only needed temporarily to be reused before the end of the frame.
+    In particular, output written outside of ::t3_term_update (e.g. by ::t3_term_putp) must not
+    make the arena grow, as the arena is only reset at the end of an update.
+*/
+void _t3_arena_release(void *ptr) {
+  char *data;
+
+  if (arena == NULL) {
+    return;
+  }
+  data = (char *)arena + ARENA_HEADER;
+  if ((char *)ptr >= data && (char *)ptr < data + arena->fill) {
+    arena->fill = (size_t)((char *)ptr - data);
+  }
+}
+
+/** @internal
+    @brief Release all memory allocated from the frame arena, for reuse by later allocations.
+
+    If more than one block was used, the blocks are replaced by a single block large enough to
+    hold all allocations, such that subsequent frames of similar size use only a single block.
+*/
+void _t3_arena_reset(void) {
+  arena_block_t *block;
+  size_t total = 0;
+
+  if (arena == NULL) {
+    return;
+  }
+  if (arena->next == NULL) {
+    arena->fill = 0;
+    return;
+  }
+
+  while (arena != NULL) {
+    block = arena;
+    arena = block->next;
+    total += block->size;
+    _t3_free(block);
+  }
+  /* If this fails, the arena simply starts empty. */
+  if ((arena = _t3_malloc(ARENA_HEADER + total)) != NULL) {
+    arena->next = NULL;
+    arena->size = total;
+    arena->fill = 0;
+  }
+}
+
+/** @internal
+    @brief Free all memory used by the frame arena. */
+void _t3_arena_free(void) {
+  arena_block_t *block;
+
+  while (arena != NULL) {
+    block = arena;
+    arena = block->next;
+    _t3_free(block);
+  }
+}
+
+/** @internal
+    @brief Add the memory used by the frame arena to a t3_memory_usage_t. */
+void _t3_arena_memory_usage(t3_memory_usage_t *usage) {
+  const arena_block_t *block;
+
+  for (block = arena; block != NULL; block = block->next) {
+    usage->allocated += ARENA_HEADER + block->size;
+    usage->used += ARENA_HEADER + block->fill;
+  }
+}
@@ -56,14 +56,6 @@ TODO list:
 /** @addtogroup t3window_term */
 /** @{ */
 
-/** @internal
-    @brief Add a separator for creating ANSI strings in ::_t3_set_attrs. */
-#define ADD_ANSI_SEP()        \
-  do {                        \
-    strcat(mode_string, sep); \
-    sep = ";";                \
-  } while (0)
-
 /** @internal
     @brief Swap two line_data_t structures. Used in ::t3_term_update. */
 #define SWAP_LINES(a, b) \
@@ -103,10 +95,17 @@ char *_t3_cup,  /**< @internal Terminal control string: position cursor. */
     *_t3_setf,  /**< @internal Terminal control string: set foreground color. */
     *_t3_setb,  /**< @internal Terminal control string: set background color. */
     *_t3_el,    /**< @internal Terminal control string: clear to end of line. */
-    *_t3_scp;   /**< @internal Terminal control string: set color pair. */
+    *_t3_scp,   /**< @internal Terminal control string: set color pair. */
+    *_t3_csr,   /**< @internal Terminal control string: set scrolling region. */
+    *_t3_ind,   /**< @internal Terminal control string: scroll forward one line. */
+    *_t3_indn,  /**< @internal Terminal control string: scroll forward. */
+    *_t3_ri,    /**< @internal Terminal control string: scroll backward one line. */
+    *_t3_rin;   /**< @internal Terminal control string: scroll backward. */
 t3_attr_t
     _t3_ncv;     /**< @internal Terminal info: Non-color video attributes (encoded in t3_attr_t). */
 t3_bool _t3_bce; /**< @internal Terminal info: screen erased with background color. */
+t3_bool _t3_sgr_resets_colors; /**< @internal Terminal info: sgr resets the colors. */
+t3_bool _t3_truecolor; /**< @internal Terminal info: terminal supports direct RGB colors. */
 int _t3_colors,  /**< @internal Terminal info: number of colors supported. */
     _t3_pairs;   /**< @internal Terminal info: number of color pairs supported. */
 
@@ -134,6 +133,9 @@ t3_attr_t _t3_attrs = 0, /**< @internal Last used set of attributes. */
     /** @internal Attributes for which the only way to turn of the attribute is to reset all
        attributes. */
     _t3_reset_required_mask = T3_ATTR_BOLD | T3_ATTR_REVERSE | T3_ATTR_BLINK | T3_ATTR_DIM;
+/** The RGB values of the last used colors. Only meaningful if the corresponding color in
+    ::_t3_attrs is ::T3_ATTR_FG_RGB or ::T3_ATTR_BG_RGB, and zero otherwise. */
+static uint32_t attrs_fg_rgb, attrs_bg_rgb;
 /** Callback for T3_ATTR_USER. */
 static t3_attr_user_callback_t user_callback = NULL;
 
@@ -378,6 +380,25 @@ t3_bool t3_term_resize(void) {
   return t3_win_resize(_t3_terminal_window, _t3_lines, _t3_columns);
 }
 
+/** Set all basic attributes at once using the @c sgr terminal control string.
+    @param new_attrs The attributes to set.
+
+    The color attributes in ::_t3_attrs are set to reflect the fact that @c sgr may
+    have reset the colors.
+*/
+static void put_sgr(t3_attr_t new_attrs) {
+  _t3_putp(_t3_tparm(_t3_sgr, 9, 0, new_attrs & T3_ATTR_UNDERLINE, new_attrs & T3_ATTR_REVERSE,
+                     new_attrs & T3_ATTR_BLINK, new_attrs & T3_ATTR_DIM, new_attrs & T3_ATTR_BOLD,
+                     0, 0, new_attrs & T3_ATTR_ACS));
+  _t3_attrs = new_attrs & ~(T3_ATTR_FG_MASK | T3_ATTR_BG_MASK);
+  /* sgr tends to reset the colors as well. Unless we know that it does, we force
+     the colors in _t3_attrs to the DEFAULT, which can never be actually set. This
+     ensures that we set the colors regardless of what sgr does. */
+  if (!_t3_sgr_resets_colors) {
+    _t3_attrs |= T3_ATTR_FG_DEFAULT | T3_ATTR_BG_DEFAULT;
+  }
+}
+
 /** Set the non-ANSI terminal drawing attributes.
     @param new_attrs The new attributes that should be used for subsequent character display.
 
@@ -394,15 +415,7 @@ static void set_attrs_non_ansi(t3_attr_t new_attrs) {
     t3_attr_t changed;
     if (attrs_basic_non_ansi & ~new_attrs & _t3_reset_required_mask) {
       if (_t3_sgr != NULL) {
-        _t3_putp(_t3_tparm(_t3_sgr, 9, 0, new_attrs & T3_ATTR_UNDERLINE,
-                           new_attrs & T3_ATTR_REVERSE, new_attrs & T3_ATTR_BLINK,
-                           new_attrs & T3_ATTR_DIM, new_attrs & T3_ATTR_BOLD, 0, 0,
-                           new_attrs & T3_ATTR_ACS));
-        /* sgr tends to reset the colors as well. To ensure that we set
-           the colors regardless of what sgr does, we force the colors in
-           _t3_attrs to the DEFAULT, which can never be actually set. */
-        _t3_attrs = (new_attrs & ~(T3_ATTR_FG_MASK | T3_ATTR_BG_MASK)) | T3_ATTR_FG_DEFAULT |
-                    T3_ATTR_BG_DEFAULT;
+        put_sgr(new_attrs);
         attrs_basic_non_ansi = _t3_attrs & ~_t3_ansi_attrs;
       } else {
         /* Note that this will not be NULL if it is required because of
@@ -494,111 +507,431 @@ static void set_attrs_non_ansi(t3_attr_t new_attrs) {
 }
 
 /** @internal
-    @brief Set terminal drawing attributes.
-    @param new_attrs The new attributes that should be used for subsequent character display.
+    @brief ANSI SGR parameters for the basic attributes, in the order in which they are emitted.
 
-    The state of ::_t3_attrs is updated to reflect the new state.
+    If any of the attributes in @c mask is switched off, @c unset is emitted, followed by the
+    parameters for those of @c set1 and @c set2 which are set in the new attributes. Otherwise the
+    parameters for those of @c set1 and @c set2 which are switched on are emitted.
 */
-void _t3_set_attrs(t3_attr_t new_attrs) {
-  char mode_string[30]; /* Max is (if I counted correctly) 24. Use 30 for if I miscounted. */
-  t3_attr_t changed_attrs;
-  const char *sep = "[";
+static const struct {
+  t3_attr_t mask;
+  t3_attr_t set1;
+  char param1[3];
+  t3_attr_t set2;
+  char param2[3];
+  char unset[3];
+} ansi_params[] = {
+    {T3_ATTR_UNDERLINE, T3_ATTR_UNDERLINE, "4", 0, "", "24"},
+    {T3_ATTR_BOLD | T3_ATTR_DIM, T3_ATTR_BOLD, "1", T3_ATTR_DIM, "2", "22"},
+    {T3_ATTR_REVERSE, T3_ATTR_REVERSE, "7", 0, "", "27"},
+    {T3_ATTR_BLINK, T3_ATTR_BLINK, "5", 0, "", "25"},
+    {T3_ATTR_ACS, T3_ATTR_ACS, "11", 0, "", "10"},
+};
 
-  /* Flush any characters accumulated in the output buffer before switching attributes. */
-  _t3_output_buffer_print();
+/** @internal
+    @brief The number of entries in ::transition_cache. Must be a power of two. */
+#define TRANSITION_CACHE_SIZE 64
+/** @internal
+    @brief The maximum number of bytes of a cached attribute transition. */
+#define TRANSITION_MAX_BYTES 64
 
-  /* Just in case the caller forgot */
-  new_attrs &= ~T3_ATTR_FALLBACK_ACS;
+/** @internal
+    @brief Cache entry for the bytes sent to the terminal to switch between two sets of attributes.
+*/
+typedef struct {
+  t3_attr_t from;   /**< The value of ::_t3_attrs before the transition. */
+  t3_attr_t to;     /**< The requested attributes. */
+  t3_attr_t result; /**< The value of ::_t3_attrs after the transition. */
+  uint32_t from_fg_rgb, from_bg_rgb; /**< The RGB values before the transition. */
+  uint32_t to_fg_rgb, to_bg_rgb;     /**< The requested RGB values. */
+  t3_bool valid;    /**< Boolean indicating whether this entry contains a transition. */
+  int length;       /**< The number of bytes in @c data. */
+  char data[TRANSITION_MAX_BYTES]; /**< The bytes to send to the terminal. */
+} transition_t;
 
-  if (new_attrs == 0) {
-    if (_t3_attrs == 0) {
-      return;
-    }
-    if (_t3_sgr0 != NULL || _t3_sgr != NULL) {
-      /* Use sgr instead of sgr0 as this is probably more tested (see rxvt-unicode terminfo bug) */
-      if (_t3_sgr != NULL) {
-        _t3_putp(_t3_tparm(_t3_sgr, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0));
-      } else {
-        _t3_putp(_t3_sgr0);
-      }
-      _t3_attrs = 0;
-      return;
+/** @internal
+    @brief Direct mapped cache of recent attribute transitions. */
+static transition_t transition_cache[TRANSITION_CACHE_SIZE];
+/** @internal
+    @brief The value of ::_t3_attr_generation for which ::transition_cache is valid. */
+static unsigned int transition_cache_generation;
+
+/** @internal
+    @brief Write the decimal representation of an unsigned integer.
+    @param dst The location to write to. Must have space for at least 10 bytes.
+    @param value The value to write.
+    @return The number of bytes written.
+*/
+static size_t put_decimal(char *dst, unsigned int value) {
+  char digits[10];
+  size_t count = 0, i;
+
+  do {
+    digits[count++] = '0' + value % 10;
+    value /= 10;
+  } while (value > 0);
+
+  for (i = 0; i < count; i++) {
+    dst[i] = digits[count - i - 1];
+  }
+  return count;
+}
+
+/** @internal
+    @brief Write the ANSI SGR parameter for setting a color.
+    @param dst The location to write to. Must have space for at least 16 bytes.
+    @param base The base digit for the color: @c '3' for foreground, @c '4' for background.
+    @param color_nr The color number, with 256 meaning the default color, 257 meaning a direct
+        RGB color and -1 meaning unspecified.
+    @param rgb The RGB value to use if @p color_nr is 257.
+    @return The number of bytes written.
+*/
+static size_t put_ansi_color(char *dst, char base, int color_nr, uint32_t rgb) {
+  if (color_nr == 257) {
+    size_t bytes;
+
+    dst[0] = base;
+    memcpy(dst + 1, "8;2;", 4);
+    bytes = 5 + put_decimal(dst + 5, (rgb >> 16) & 0xff);
+    dst[bytes++] = ';';
+    bytes += put_decimal(dst + bytes, (rgb >> 8) & 0xff);
+    dst[bytes++] = ';';
+    return bytes + put_decimal(dst + bytes, rgb & 0xff);
+  } else if (color_nr < 8 || color_nr == 256) {
+    dst[0] = base;
+    dst[1] = '0' + (color_nr >= 0 && color_nr < 8 ? color_nr : 9);
+    return 2;
+  } else if (color_nr < 16) {
+    if (base == '3') {
+      dst[0] = '9';
+      dst[1] = '0' + color_nr - 8;
+      return 2;
     }
+    dst[0] = '1';
+    dst[1] = '0';
+    dst[2] = '0' + color_nr - 8;
+    return 3;
+  }
+  dst[0] = base;
+  memcpy(dst + 1, "8;5;", 4);
+  return 5 + put_decimal(dst + 5, color_nr);
+}
+
+/** @internal
+    @brief Add an ANSI SGR parameter to a mode string.
+    @param mode_string The mode string to add to.
+    @param mode_string_bytes The number of bytes in @p mode_string, which is updated.
+    @param param The nul-terminated parameter to add.
+*/
+static void add_ansi_param(char *mode_string, size_t *mode_string_bytes, const char *param) {
+  mode_string[(*mode_string_bytes)++] = ';';
+  for (; *param != 0; param++) {
+    mode_string[(*mode_string_bytes)++] = *param;
+  }
+}
+
+/** @internal
+    @brief Add the ANSI SGR parameters for colors to a mode string.
+    @param mode_string The mode string to add to.
+    @param mode_string_bytes The number of bytes in @p mode_string, which is updated.
+    @param changed_attrs The attributes that need to be set.
+    @param new_attrs The attributes to set.
+    @param fg_rgb The RGB value of the foreground color if it is ::T3_ATTR_FG_RGB.
+    @param bg_rgb The RGB value of the background color if it is ::T3_ATTR_BG_RGB.
+*/
+static void add_ansi_colors(char *mode_string, size_t *mode_string_bytes, t3_attr_t changed_attrs,
+                            t3_attr_t new_attrs, uint32_t fg_rgb, uint32_t bg_rgb) {
+  if (changed_attrs & T3_ATTR_FG_MASK) {
+    mode_string[(*mode_string_bytes)++] = ';';
+    *mode_string_bytes +=
+        put_ansi_color(mode_string + *mode_string_bytes, '3',
+                       (int)((new_attrs & T3_ATTR_FG_MASK) >> T3_ATTR_COLOR_SHIFT) - 1, fg_rgb);
+  }
+
+  if (changed_attrs & T3_ATTR_BG_MASK) {
+    mode_string[(*mode_string_bytes)++] = ';';
+    *mode_string_bytes += put_ansi_color(
+        mode_string + *mode_string_bytes, '4',
+        (int)((new_attrs & T3_ATTR_BG_MASK) >> (T3_ATTR_COLOR_SHIFT + 9)) - 1, bg_rgb);
+  }
+}
+
+/** @internal
+    @brief Determine which colors need to be set because their RGB value changed.
+    @param new_attrs The attributes to set.
+    @param fg_rgb The RGB value of the foreground color if it is ::T3_ATTR_FG_RGB.
+    @param bg_rgb The RGB value of the background color if it is ::T3_ATTR_BG_RGB.
+    @return The color masks for the colors that are RGB colors both in ::_t3_attrs and
+        @p new_attrs, but with a different RGB value.
+*/
+static t3_attr_t changed_rgb(t3_attr_t new_attrs, uint32_t fg_rgb, uint32_t bg_rgb) {
+  t3_attr_t changed = 0;
+
+  if ((new_attrs & T3_ATTR_FG_MASK) == T3_ATTR_FG_RGB &&
+      (_t3_attrs & T3_ATTR_FG_MASK) == T3_ATTR_FG_RGB && fg_rgb != attrs_fg_rgb) {
+    changed |= T3_ATTR_FG_MASK;
+  }
+  if ((new_attrs & T3_ATTR_BG_MASK) == T3_ATTR_BG_RGB &&
+      (_t3_attrs & T3_ATTR_BG_MASK) == T3_ATTR_BG_RGB && bg_rgb != attrs_bg_rgb) {
+    changed |= T3_ATTR_BG_MASK;
   }
+  return changed;
+}
+
+/** @internal
+    @brief Send the control sequences for changing only the attributes that differ.
+    @param new_attrs The new attributes that should be used for subsequent character display.
+    @param fg_rgb The RGB value of the foreground color if it is ::T3_ATTR_FG_RGB.
+    @param bg_rgb The RGB value of the background color if it is ::T3_ATTR_BG_RGB.
+
+    Only the attributes that differ are changed, although the non-ANSI attributes may require a
+    reset of all attributes. The state of ::_t3_attrs is updated to reflect the new state.
+*/
+static void set_attrs_incremental(t3_attr_t new_attrs, uint32_t fg_rgb, uint32_t bg_rgb) {
+  char mode_string[TRANSITION_MAX_BYTES];
+  size_t mode_string_bytes;
+  t3_attr_t changed_attrs;
+  size_t i;
 
   changed_attrs = (new_attrs ^ _t3_attrs) & ~_t3_ansi_attrs;
   if (changed_attrs != 0) {
     set_attrs_non_ansi(new_attrs);
   }
 
-  changed_attrs = (new_attrs ^ _t3_attrs) & _t3_ansi_attrs;
+  changed_attrs =
+      ((new_attrs ^ _t3_attrs) | changed_rgb(new_attrs, fg_rgb, bg_rgb)) & _t3_ansi_attrs;
   if (changed_attrs == 0) {
     _t3_attrs = new_attrs;
     return;
   }
 
+  /* The mode string is built with a leading ';' instead of '[', which is fixed at the end. */
   mode_string[0] = '\033';
-  mode_string[1] = 0;
+  mode_string_bytes = 1;
+
+  for (i = 0; i < sizeof(ansi_params) / sizeof(ansi_params[0]); i++) {
+    t3_attr_t switched_on;
+    if ((changed_attrs & ansi_params[i].mask) == 0) {
+      continue;
+    }
+    /* Bold and dim are switched off by the same parameter, so switching off one of them
+       requires switching on the other again. */
+    if (changed_attrs & ~new_attrs & ansi_params[i].mask) {
+      add_ansi_param(mode_string, &mode_string_bytes, ansi_params[i].unset);
+      switched_on = new_attrs & ansi_params[i].mask;
+    } else {
+      switched_on = changed_attrs & ansi_params[i].mask;
+    }
+    if (switched_on & ansi_params[i].set1) {
+      add_ansi_param(mode_string, &mode_string_bytes, ansi_params[i].param1);
+    }
+    if (switched_on & ansi_params[i].set2) {
+      add_ansi_param(mode_string, &mode_string_bytes, ansi_params[i].param2);
+    }
+  }
+
+  add_ansi_colors(mode_string, &mode_string_bytes, changed_attrs, new_attrs, fg_rgb, bg_rgb);
+  mode_string[1] = '[';
+  mode_string[mode_string_bytes++] = 'm';
+  _t3_putp_raw(mode_string, mode_string_bytes);
+  _t3_attrs = new_attrs;
+}
+
+/** @internal
+    @brief Send the control sequences for resetting all attributes and then setting a new set.
+    @param new_attrs The new attributes that should be used for subsequent character display.
+    @param fg_rgb The RGB value of the foreground color if it is ::T3_ATTR_FG_RGB.
+    @param bg_rgb The RGB value of the background color if it is ::T3_ATTR_BG_RGB.
+    @return A boolean indicating whether the terminal provides a way to reset the attributes.
+
+    If all (current and new) attributes are set through ANSI sequences, the reset and the new
+    attributes are combined in a single ANSI sequence. Otherwise, @c sgr or @c sgr0 is used
+    before setting the remaining attributes. The state of ::_t3_attrs is updated to reflect the
+    new state.
+*/
+static t3_bool set_attrs_reset(t3_attr_t new_attrs, uint32_t fg_rgb, uint32_t bg_rgb) {
+  t3_attr_t relevant_attrs = BASIC_ATTRS | T3_ATTR_FG_MASK | T3_ATTR_BG_MASK;
+
+  if (((_t3_attrs | new_attrs) & relevant_attrs & ~_t3_ansi_attrs) == 0 &&
+      (_t3_ansi_attrs & T3_ATTR_FG_MASK)) {
+    char mode_string[TRANSITION_MAX_BYTES];
+    size_t mode_string_bytes = 3;
+    t3_attr_t set_attrs = new_attrs;
+    size_t i;
+
+    memcpy(mode_string, "\033[0", 3);
+    for (i = 0; i < sizeof(ansi_params) / sizeof(ansi_params[0]); i++) {
+      if (new_attrs & ansi_params[i].set1) {
+        add_ansi_param(mode_string, &mode_string_bytes, ansi_params[i].param1);
+      }
+      if (new_attrs & ansi_params[i].set2) {
+        add_ansi_param(mode_string, &mode_string_bytes, ansi_params[i].param2);
+      }
+      if ((new_attrs & ansi_params[i].mask) == 0 && ansi_params[i].mask == T3_ATTR_ACS &&
+          (_t3_attrs & T3_ATTR_ACS)) {
+        /* The alternate character set is not necessarily reset by the ANSI reset. */
+        add_ansi_param(mode_string, &mode_string_bytes, ansi_params[i].unset);
+      }
+    }
+    /* The ANSI reset already selects the default colors. */
+    if ((set_attrs & T3_ATTR_FG_MASK) == T3_ATTR_FG_DEFAULT) {
+      set_attrs &= ~T3_ATTR_FG_MASK;
+    }
+    if ((set_attrs & T3_ATTR_BG_MASK) == T3_ATTR_BG_DEFAULT) {
+      set_attrs &= ~T3_ATTR_BG_MASK;
+    }
+    add_ansi_colors(mode_string, &mode_string_bytes, set_attrs, new_attrs, fg_rgb, bg_rgb);
+    mode_string[mode_string_bytes++] = 'm';
+    _t3_putp_raw(mode_string, mode_string_bytes);
+    _t3_attrs = new_attrs;
+    return t3_true;
+  }
 
-  if (changed_attrs & T3_ATTR_UNDERLINE) {
-    ADD_ANSI_SEP();
-    strcat(mode_string, new_attrs & T3_ATTR_UNDERLINE ? "4" : "24");
+  if (_t3_sgr != NULL) {
+    put_sgr(new_attrs);
+  } else if (_t3_sgr0 != NULL) {
+    _t3_putp(_t3_sgr0);
+    _t3_attrs = 0;
+  } else {
+    return t3_false;
   }
+  set_attrs_incremental(new_attrs, fg_rgb, bg_rgb);
+  return t3_true;
+}
+
+/** @internal
+    @brief Record the attribute state after a transition.
+    @param attrs The new value for ::_t3_attrs.
+    @param fg_rgb The RGB value of the foreground color if it is ::T3_ATTR_FG_RGB.
+    @param bg_rgb The RGB value of the background color if it is ::T3_ATTR_BG_RGB.
+*/
+static void set_attrs_state(t3_attr_t attrs, uint32_t fg_rgb, uint32_t bg_rgb) {
+  _t3_attrs = attrs;
+  attrs_fg_rgb = (attrs & T3_ATTR_FG_MASK) == T3_ATTR_FG_RGB ? fg_rgb : 0;
+  attrs_bg_rgb = (attrs & T3_ATTR_BG_MASK) == T3_ATTR_BG_RGB ? bg_rgb : 0;
+}
+
+/** @internal
+    @brief Set terminal drawing attributes, possibly including direct RGB colors.
+    @param new_attrs The new attributes that should be used for subsequent character display.
+    @param fg_rgb The RGB value of the foreground color if it is ::T3_ATTR_FG_RGB.
+    @param bg_rgb The RGB value of the background color if it is ::T3_ATTR_BG_RGB.
+
+    The state of ::_t3_attrs is updated to reflect the new state. Both an incremental change
+    and a reset followed by setting the new attributes are considered, and the one requiring
+    the fewest bytes is used. As the bytes sent to the terminal only depend on the previous and
+    new attributes, recent transitions are cached.
+*/
+void _t3_set_attrs_rgb(t3_attr_t new_attrs, uint32_t fg_rgb, uint32_t bg_rgb) {
+  transition_t *transition;
+  uint32_t hash;
+  char reset_data[TRANSITION_MAX_BYTES];
+  size_t length, reset_length;
+  t3_attr_t saved_attrs, result;
+
+  /* Flush any characters accumulated in the output buffer before switching attributes. */
+  _t3_output_buffer_print();
 
-  if (changed_attrs & (T3_ATTR_BOLD | T3_ATTR_DIM)) {
-    ADD_ANSI_SEP();
-    strcat(mode_string, new_attrs & T3_ATTR_BOLD ? "1" : (new_attrs & T3_ATTR_DIM ? "2" : "22"));
+  /* Just in case the caller forgot */
+  new_attrs &= ~T3_ATTR_FALLBACK_ACS;
+
+  /* Direct RGB colors are only available when the terminal supports them. Otherwise they
+     should have been resolved to the nearest color when they were mapped. */
+  if ((new_attrs & T3_ATTR_FG_MASK) != T3_ATTR_FG_RGB) {
+    fg_rgb = 0;
+  } else if (!_t3_truecolor) {
+    new_attrs &= ~T3_ATTR_FG_MASK;
+    fg_rgb = 0;
+  }
+  if ((new_attrs & T3_ATTR_BG_MASK) != T3_ATTR_BG_RGB) {
+    bg_rgb = 0;
+  } else if (!_t3_truecolor) {
+    new_attrs &= ~T3_ATTR_BG_MASK;
+    bg_rgb = 0;
   }
 
-  if (changed_attrs & T3_ATTR_REVERSE) {
-    ADD_ANSI_SEP();
-    strcat(mode_string, new_attrs & T3_ATTR_REVERSE ? "7" : "27");
+  if (new_attrs == _t3_attrs && fg_rgb == attrs_fg_rgb && bg_rgb == attrs_bg_rgb) {
+    return;
   }
 
-  if (changed_attrs & T3_ATTR_BLINK) {
-    ADD_ANSI_SEP();
-    strcat(mode_string, new_attrs & T3_ATTR_BLINK ? "5" : "25");
+  /* The cached transitions depend on the terminal capabilities. These only change when the
+     attribute generation changes. */
+  if (transition_cache_generation != _t3_attr_generation) {
+    memset(transition_cache, 0, sizeof(transition_cache));
+    transition_cache_generation = _t3_attr_generation;
   }
 
-  if (changed_attrs & T3_ATTR_ACS) {
-    ADD_ANSI_SEP();
-    strcat(mode_string, new_attrs & T3_ATTR_ACS ? "11" : "10");
+  hash = (uint32_t)_t3_attrs * UINT32_C(0x9e3779b1) ^ (uint32_t)new_attrs * UINT32_C(0x85ebca6b) ^
+         (attrs_fg_rgb ^ fg_rgb) * UINT32_C(0xc2b2ae35) ^ (attrs_bg_rgb ^ bg_rgb);
+  transition = transition_cache + ((hash ^ (hash >> 16)) & (TRANSITION_CACHE_SIZE - 1));
+  if (transition->valid && transition->from == _t3_attrs && transition->to == new_attrs &&
+      transition->from_fg_rgb == attrs_fg_rgb && transition->from_bg_rgb == attrs_bg_rgb &&
+      transition->to_fg_rgb == fg_rgb && transition->to_bg_rgb == bg_rgb) {
+    _t3_putp_raw(transition->data, transition->length);
+    set_attrs_state(transition->result, fg_rgb, bg_rgb);
+    return;
   }
 
-  if (changed_attrs & T3_ATTR_FG_MASK) {
-    char color[9];
-    int color_nr = ((new_attrs & T3_ATTR_FG_MASK) >> T3_ATTR_COLOR_SHIFT) - 1;
-    if (color_nr < 8 || color_nr == 256) {
-      color[0] = '3';
-      color[1] = '0' + (color_nr >= 0 && color_nr < 8 ? color_nr : 9);
-      color[2] = 0;
-    } else if (color_nr < 16) {
-      sprintf(color, "9%d", color_nr - 8);
-    } else {
-      sprintf(color, "38;5;%d", color_nr);
+  /* Plan the transition: determine the bytes required for changing only the differing
+     attributes, and for resetting all attributes followed by setting the new attributes.
+     Then use the shortest. */
+  saved_attrs = _t3_attrs;
+  transition->valid = t3_false;
+  transition->from = _t3_attrs;
+  transition->to = new_attrs;
+  transition->from_fg_rgb = attrs_fg_rgb;
+  transition->from_bg_rgb = attrs_bg_rgb;
+  transition->to_fg_rgb = fg_rgb;
+  transition->to_bg_rgb = bg_rgb;
+  _t3_putp_start_capture(transition->data, sizeof(transition->data));
+  set_attrs_incremental(new_attrs, fg_rgb, bg_rgb);
+  length = _t3_putp_stop_capture();
+  result = _t3_attrs;
+
+  _t3_attrs = saved_attrs;
+  _t3_putp_start_capture(reset_data, sizeof(reset_data));
+  if (set_attrs_reset(new_attrs, fg_rgb, bg_rgb)) {
+    reset_length = _t3_putp_stop_capture();
+    if (reset_length < length) {
+      memcpy(transition->data, reset_data, reset_length);
+      length = reset_length;
+      result = _t3_attrs;
     }
-    ADD_ANSI_SEP();
-    strcat(mode_string, color);
+  } else {
+    _t3_putp_stop_capture();
   }
 
-  if (changed_attrs & T3_ATTR_BG_MASK) {
-    char color[9];
-    int color_nr = ((new_attrs & T3_ATTR_BG_MASK) >> (T3_ATTR_COLOR_SHIFT + 9)) - 1;
-    if (color_nr < 8 || color_nr == 256) {
-      color[0] = '4';
-      color[1] = '0' + (color_nr >= 0 && color_nr < 8 ? color_nr : 9);
-      color[2] = 0;
-    } else if (color_nr < 16) {
-      sprintf(color, "10%d", color_nr - 8);
-    } else {
-      sprintf(color, "48;5;%d", color_nr);
-    }
-    ADD_ANSI_SEP();
-    strcat(mode_string, color);
+  if (length == (size_t)-1) {
+    /* Too long for the cache. Simply send the incremental change directly. */
+    _t3_attrs = saved_attrs;
+    set_attrs_incremental(new_attrs, fg_rgb, bg_rgb);
+    set_attrs_state(_t3_attrs, fg_rgb, bg_rgb);
+    return;
   }
-  strcat(mode_string, "m");
-  _t3_putp(mode_string);
-  _t3_attrs = new_attrs;
+
+  _t3_putp_raw(transition->data, length);
+  set_attrs_state(result, fg_rgb, bg_rgb);
+  transition->length = length;
+  transition->result = result;
+  transition->valid = t3_true;
+}
+
+/** @internal
+    @brief Set terminal drawing attributes.
+    @param new_attrs The new attributes that should be used for subsequent character display.
+
+    See ::_t3_set_attrs_rgb for details.
+*/
+void _t3_set_attrs(t3_attr_t new_attrs) { _t3_set_attrs_rgb(new_attrs, 0, 0); }
+
+/** @internal
+    @brief Check whether a set of attributes differs from the current terminal attributes.
+    @param new_attrs The attributes to check.
+    @param fg_rgb The RGB value of the foreground color if it is ::T3_ATTR_FG_RGB, zero otherwise.
+    @param bg_rgb The RGB value of the background color if it is ::T3_ATTR_BG_RGB, zero otherwise.
+*/
+static t3_bool attrs_changed(t3_attr_t new_attrs, uint32_t fg_rgb, uint32_t bg_rgb) {
+  return new_attrs != _t3_attrs || fg_rgb != attrs_fg_rgb || bg_rgb != attrs_bg_rgb;
 }
 
 /** Set terminal drawing attributes.
@@ -634,6 +967,170 @@ void t3_term_update_cursor(void) {
   fflush(_t3_putp_file);
 }
 
+/** @internal
+    @brief A position in the line data, used for comparing lines in ::t3_term_update.
+
+    Run blocks are visited one space at a time, as if each space were a separate block. Thus
+    a change in the middle of a run only requires drawing the changed cells, and a run compares
+    equal to the same number of separate space blocks.
+*/
+typedef struct {
+  const char *data;   /**< The line data. */
+  int length;         /**< The size of the line data. */
+  int idx;            /**< The index of the current block in @c data. */
+  int run_left;       /**< For run blocks, the number of spaces after the current space. */
+  const char *attr;   /**< The encoded attribute index of the current block. */
+  size_t attr_bytes;  /**< The size of the encoded attribute index. */
+  const char *text;   /**< The text of the current block. */
+  size_t text_bytes;  /**< The size of @c text. */
+  int width;          /**< The width of the current block, or of a single space of a run. */
+  size_t block_bytes; /**< The size of the current block, including the header. */
+} line_pos_t;
+
+/** @internal
+    @brief Decode the block at the current index of a ::line_pos_t. */
+static void line_pos_decode(line_pos_t *pos) {
+  uint32_t block_size;
+  size_t block_size_bytes;
+
+  if (pos->idx >= pos->length) {
+    return;
+  }
+  block_size = _t3_get_value(pos->data + pos->idx, &block_size_bytes);
+  pos->attr = pos->data + pos->idx + block_size_bytes;
+  if (_T3_BLOCK_IS_RUN(block_size)) {
+    pos->attr_bytes = _T3_BLOCK_SIZE_TO_BYTES(block_size);
+    pos->text = " ";
+    pos->text_bytes = 1;
+    pos->width = 1;
+    pos->run_left = _T3_BLOCK_SIZE_TO_WIDTH(block_size) - 1;
+  } else {
+    (void)_t3_get_value(pos->attr, &pos->attr_bytes);
+    pos->text = pos->attr + pos->attr_bytes;
+    pos->text_bytes = _T3_BLOCK_SIZE_TO_BYTES(block_size) - pos->attr_bytes;
+    pos->width = _T3_BLOCK_SIZE_TO_WIDTH(block_size);
+    pos->run_left = 0;
+  }
+  pos->block_bytes = block_size_bytes + _T3_BLOCK_SIZE_TO_BYTES(block_size);
+}
+
+/** @internal
+    @brief Initialize a ::line_pos_t to the start of a line. */
+static void line_pos_init(line_pos_t *pos, const line_data_t *line) {
+  pos->data = line->data;
+  pos->length = line->length;
+  pos->idx = 0;
+  line_pos_decode(pos);
+}
+
+/** @internal
+    @brief Move a ::line_pos_t to the next block, or the next space of a run. */
+static void line_pos_next(line_pos_t *pos) {
+  if (pos->run_left > 0) {
+    pos->run_left--;
+    return;
+  }
+  pos->idx += pos->block_bytes;
+  line_pos_decode(pos);
+}
+
+/** @internal
+    @brief Move a ::line_pos_t past all blocks that end at or before a column.
+    @param pos The position to move.
+    @param pos_width The location of the column of @p pos, which is updated.
+    @param width The column to move to.
+*/
+static void line_pos_skip_to(line_pos_t *pos, int *pos_width, int width) {
+  int cells;
+
+  while (pos->idx < pos->length && *pos_width + pos->width <= width) {
+    /* Skip as many spaces of a run as possible at once. */
+    cells = width - *pos_width - pos->width;
+    if (cells > pos->run_left) {
+      cells = pos->run_left;
+    }
+    pos->run_left -= cells;
+    *pos_width += cells + pos->width;
+    line_pos_next(pos);
+  }
+}
+
+/** @internal
+    @brief Check whether the blocks at two ::line_pos_t's are equal. */
+static t3_bool line_pos_equal(const line_pos_t *a, const line_pos_t *b) {
+  return a->width == b->width && a->attr_bytes == b->attr_bytes &&
+         a->text_bytes == b->text_bytes && memcmp(a->attr, b->attr, a->attr_bytes) == 0 &&
+         memcmp(a->text, b->text, a->text_bytes) == 0;
+}
+
+/** @internal
+    @brief Pending scroll of a range of terminal lines, recorded by ::t3_win_scroll. */
+static struct {
+  int top;    /**< The first line of the range. */
+  int bottom; /**< The last line of the range. */
+  int count;  /**< The number of lines to scroll up, or down if negative. Zero if none. */
+} scroll_hint;
+
+/** @internal
+    @brief Record that a range of terminal lines should be scrolled on the next update.
+    @param top The first line of the range.
+    @param bottom The last line of the range.
+    @param n The number of lines to scroll up, or down if negative.
+
+    Scrolls of the same range are combined. A scroll of a different range replaces the pending
+    one. The hint is only an optimization: the terminal contents are compared afterwards as
+    usual, so anything the scroll did not fix up is drawn normally.
+*/
+void _t3_term_scroll_hint(int top, int bottom, int n) {
+  if (scroll_hint.count != 0 && scroll_hint.top == top && scroll_hint.bottom == bottom) {
+    scroll_hint.count += n;
+    return;
+  }
+  scroll_hint.top = top;
+  scroll_hint.bottom = bottom;
+  scroll_hint.count = n;
+}
+
+/** Scroll part of the terminal according to the pending scroll hint.
+
+    The scrolling region of the terminal is set to the range, and the lines are scrolled using
+    @c ind/@c indn or @c ri/@c rin. The cached terminal contents are scrolled the same way, such
+    that the lines that moved need not be drawn again.
+*/
+static void apply_scroll_hint(void) {
+  int top = scroll_hint.top, bottom = scroll_hint.bottom, n = scroll_hint.count;
+  int count = n < 0 ? -n : n, i;
+  char *single, *multiple;
+
+  scroll_hint.count = 0;
+  if (bottom >= _t3_lines) {
+    bottom = _t3_lines - 1;
+  }
+  if (n == 0 || _t3_csr == NULL || count > bottom - top) {
+    return;
+  }
+  single = n > 0 ? _t3_ind : _t3_ri;
+  multiple = n > 0 ? _t3_indn : _t3_rin;
+  if (single == NULL && multiple == NULL) {
+    return;
+  }
+
+  /* The lines that are scrolled in get the current background color on some terminals. */
+  _t3_set_attrs(0);
+  _t3_putp(_t3_tparm(_t3_csr, 2, top, bottom));
+  _t3_do_cup(n > 0 ? bottom : top, 0);
+  if (multiple != NULL && (count > 1 || single == NULL)) {
+    _t3_putp(_t3_tparm(multiple, 1, count));
+  } else {
+    for (i = 0; i < count; i++) {
+      _t3_putp(single);
+    }
+  }
+  _t3_putp(_t3_tparm(_t3_csr, 2, 0, _t3_lines - 1));
+
+  _t3_rotate_lines(_t3_terminal_window->lines + top, bottom - top + 1, n);
+}
+
 /** Update the terminal, drawing all changes since last refresh.
 
     After changing window contents, this function should be called to make those
@@ -666,16 +1163,32 @@ void t3_term_update(void) {
     }
   }
 
+  if (scroll_hint.count != 0) {
+    apply_scroll_hint();
+  }
+
   for (i = 0; i < _t3_lines; i++) {
-    int old_idx = 0, new_idx = 0, width, old_width, last_width = -1;
-    uint32_t old_block_size, new_block_size;
-    size_t old_block_size_bytes, new_block_size_bytes;
+    int width, old_width, last_width = -1, cells;
+    line_pos_t old_pos, new_pos;
 
     SWAP_LINES(_t3_old_data, _t3_terminal_window->lines[i]);
     _t3_win_refresh_term_line(i);
 
+    /* Most lines are unchanged between updates. Comparing the whole line at once is much
+       cheaper than the block by block comparison below. */
+    if (_t3_terminal_window->lines[i].start == _t3_old_data.start &&
+        _t3_terminal_window->lines[i].width == _t3_old_data.width &&
+        _t3_terminal_window->lines[i].length == _t3_old_data.length &&
+        (_t3_old_data.length == 0 ||
+         memcmp(_t3_terminal_window->lines[i].data, _t3_old_data.data, _t3_old_data.length) ==
+             0)) {
+      continue;
+    }
+
     width = _t3_terminal_window->lines[i].start;
     old_width = _t3_old_data.start;
+    line_pos_init(&old_pos, &_t3_old_data);
+    line_pos_init(&new_pos, &_t3_terminal_window->lines[i]);
 
     if (width > old_width && _t3_old_data.width > 0) {
       int spaces;
@@ -684,63 +1197,55 @@ void t3_term_update(void) {
 
       if (_t3_old_data.start + _t3_old_data.width < width) {
         spaces = _t3_old_data.width;
-        old_idx = _t3_old_data.length;
+        old_pos.idx = _t3_old_data.length;
         old_width = _t3_old_data.start + _t3_old_data.width;
         last_width = old_width;
       } else {
         spaces = _t3_terminal_window->lines[i].start - _t3_old_data.start;
-        while (old_idx < _t3_old_data.length) {
-          old_block_size = _t3_get_value(_t3_old_data.data + old_idx, &old_block_size_bytes);
-          if (old_width + _T3_BLOCK_SIZE_TO_WIDTH(old_block_size) > width) {
-            break;
-          }
-          old_width += _T3_BLOCK_SIZE_TO_WIDTH(old_block_size);
-          old_idx += (old_block_size >> 1) + old_block_size_bytes;
-        }
+        line_pos_skip_to(&old_pos, &old_width, width);
         last_width = width;
       }
 
-      for (spaces = _t3_terminal_window->lines[i].start - _t3_old_data.start; spaces > 0;
-           spaces--) {
+      for (; spaces > 0; spaces--) {
         t3_term_putc(' ');
       }
+      /* The cursor may be moved directly below, so the spaces must be written first. */
+      _t3_output_buffer_print();
     }
 
-    while (new_idx != _t3_terminal_window->lines[i].length) {
-      int saved_old_idx, saved_new_idx, saved_width, same_count = 0;
+    while (new_pos.idx < new_pos.length) {
+      int saved_width, same_count = 0;
+      line_pos_t saved_old_pos, saved_new_pos;
 
       /* Only check if old and new are the same if we are checking the same position. */
       if (old_width == width) {
-        saved_old_idx = old_idx;
-        saved_new_idx = new_idx;
+        saved_old_pos = old_pos;
+        saved_new_pos = new_pos;
         saved_width = width;
 
-        while (new_idx < _t3_terminal_window->lines[i].length && old_idx < _t3_old_data.length) {
-          old_block_size = _t3_get_value(_t3_old_data.data + old_idx, &old_block_size_bytes);
-          new_block_size =
-              _t3_get_value(_t3_terminal_window->lines[i].data + new_idx, &new_block_size_bytes);
-
+        while (new_pos.idx < new_pos.length && old_pos.idx < old_pos.length) {
           /* Check if the next blocks are equal. If not, break. */
-          if (old_block_size != new_block_size ||
-              memcmp(_t3_old_data.data + old_idx + old_block_size_bytes,
-                     _t3_terminal_window->lines[i].data + new_idx + new_block_size_bytes,
-                     old_block_size >> 1) != 0) {
+          if (!line_pos_equal(&old_pos, &new_pos)) {
             break;
           }
-          same_count++;
-          width += _T3_BLOCK_SIZE_TO_WIDTH(old_block_size);
+          /* Skip the common part of equal runs of spaces at once. */
+          cells = old_pos.run_left < new_pos.run_left ? old_pos.run_left : new_pos.run_left;
+          old_pos.run_left -= cells;
+          new_pos.run_left -= cells;
+          same_count += cells + 1;
+          width += cells + new_pos.width;
           old_width = width;
-          old_idx += (old_block_size >> 1) + old_block_size_bytes;
-          new_idx += (new_block_size >> 1) + new_block_size_bytes;
+          line_pos_next(&old_pos);
+          line_pos_next(&new_pos);
         }
 
-        if (new_idx >= _t3_terminal_window->lines[i].length) {
+        if (new_pos.idx >= new_pos.length) {
           break;
         }
 
-        if (same_count < 3 && old_idx < _t3_old_data.length) {
-          old_idx = saved_old_idx;
-          new_idx = saved_new_idx;
+        if (same_count < 3 && old_pos.idx < old_pos.length) {
+          old_pos = saved_old_pos;
+          new_pos = saved_new_pos;
           old_width = width = saved_width;
           same_count++;
         } else {
@@ -759,62 +1264,44 @@ void t3_term_update(void) {
 
       do {
         t3_attr_t new_attrs;
+        uint32_t new_fg_rgb, new_bg_rgb;
         size_t new_attrs_bytes;
 
-        new_block_size =
-            _t3_get_value(_t3_terminal_window->lines[i].data + new_idx, &new_block_size_bytes);
-        new_idx += new_block_size_bytes;
-        new_attrs = _t3_get_attr(
-            _t3_get_value(_t3_terminal_window->lines[i].data + new_idx, &new_attrs_bytes));
+        new_attrs = _t3_get_attr_rgb(_t3_get_value(new_pos.attr, &new_attrs_bytes), &new_fg_rgb,
+                                     &new_bg_rgb);
 
         if ((new_attrs & T3_ATTR_USER) && user_callback != NULL) {
-          user_callback(_t3_terminal_window->lines[i].data + new_idx + new_attrs_bytes,
-                        (new_block_size >> 1) - new_attrs_bytes,
-                        _T3_BLOCK_SIZE_TO_WIDTH(new_block_size), new_attrs);
+          user_callback(new_pos.text, new_pos.text_bytes, new_pos.width, new_attrs);
         } else {
           if (new_attrs & T3_ATTR_ACS) {
             if ((_t3_acs_override == _T3_ACS_AUTO && _t3_term_encoding == _T3_TERM_UTF8) ||
-                !t3_term_acs_available(
-                    _t3_terminal_window->lines[i].data[new_idx + new_attrs_bytes])) {
+                !t3_term_acs_available(new_pos.text[0])) {
               new_attrs &= ~T3_ATTR_ACS;
-              if (new_attrs != _t3_attrs) {
-                _t3_set_attrs(new_attrs);
+              if (attrs_changed(new_attrs, new_fg_rgb, new_bg_rgb)) {
+                _t3_set_attrs_rgb(new_attrs, new_fg_rgb, new_bg_rgb);
               }
-              t3_term_puts(
-                  get_default_acs(_t3_terminal_window->lines[i].data[new_idx + new_attrs_bytes]));
+              t3_term_puts(get_default_acs(new_pos.text[0]));
             } else {
-              if (new_attrs != _t3_attrs) {
-                _t3_set_attrs(new_attrs);
+              if (attrs_changed(new_attrs, new_fg_rgb, new_bg_rgb)) {
+                _t3_set_attrs_rgb(new_attrs, new_fg_rgb, new_bg_rgb);
               }
               /* ACS characters should be passed directly to the terminal, without
                  character-set conversion. */
               _t3_output_buffer_print();
-              fwrite(_t3_alternate_chars +
-                         _t3_terminal_window->lines[i].data[new_idx + new_attrs_bytes],
-                     1, 1, _t3_putp_file);
+              fwrite(_t3_alternate_chars + new_pos.text[0], 1, 1, _t3_putp_file);
             }
           } else {
-            if (new_attrs != _t3_attrs) {
-              _t3_set_attrs(new_attrs);
+            if (attrs_changed(new_attrs, new_fg_rgb, new_bg_rgb)) {
+              _t3_set_attrs_rgb(new_attrs, new_fg_rgb, new_bg_rgb);
             }
-            t3_term_putn(_t3_terminal_window->lines[i].data + new_idx + new_attrs_bytes,
-                         (new_block_size >> 1) - new_attrs_bytes);
+            t3_term_putn(new_pos.text, new_pos.text_bytes);
           }
         }
-        new_idx += new_block_size >> 1;
-        width += _T3_BLOCK_SIZE_TO_WIDTH(new_block_size);
+        width += new_pos.width;
         same_count--;
-
-        while (old_idx < _t3_old_data.length) {
-          old_block_size = _t3_get_value(_t3_old_data.data + old_idx, &old_block_size_bytes);
-          if (old_width + _T3_BLOCK_SIZE_TO_WIDTH(old_block_size) > width) {
-            break;
-          }
-          old_width += _T3_BLOCK_SIZE_TO_WIDTH(old_block_size);
-          old_idx += (old_block_size >> 1) + old_block_size_bytes;
-        }
-      } while ((old_width != width || same_count > 0) &&
-               new_idx < _t3_terminal_window->lines[i].length);
+        line_pos_next(&new_pos);
+        line_pos_skip_to(&old_pos, &old_width, width);
+      } while ((old_width != width || same_count > 0) && new_pos.idx < new_pos.length);
       last_width = width;
       _t3_output_buffer_print();
     }
@@ -827,8 +1314,11 @@ void t3_term_update(void) {
         _t3_do_cup(i, 0);
       }
 
+      /* With bce, the cleared part of the line gets the current background color.
+         Only drop the attributes that affect the cleared cells, instead of resetting
+         everything, which would require setting the foreground color again later. */
       if (_t3_bce && (_t3_attrs & ~T3_ATTR_FG_MASK) != 0) {
-        _t3_set_attrs(0);
+        _t3_set_attrs_rgb(_t3_attrs & T3_ATTR_FG_MASK, attrs_fg_rgb, 0);
       }
 
       if (_t3_el != NULL) {
@@ -874,6 +1364,7 @@ void t3_term_update(void) {
   }
 
   fflush(_t3_putp_file);
+  _t3_arena_reset();
 }
 
 /** Redraw the entire terminal from scratch. */
@@ -884,6 +1375,7 @@ void t3_term_redraw(void) {
   if (new_show_cursor && _t3_show_cursor) {
     _t3_cursor_x = new_cursor_x + 1;
   }
+  scroll_hint.count = 0;
   _t3_set_attrs(0);
   _t3_putp(_t3_clear);
   t3_win_set_paint(_t3_terminal_window, 0, 0);
@@ -902,6 +1394,135 @@ void t3_term_putp(const char *str) {
   _t3_putp(str);
 }
 
+/** @internal
+    @brief Add the memory used by a list of windows and all their children to a
+        t3_memory_usage_t. */
+static void add_window_list_memory_usage(const t3_window_t *win, t3_memory_usage_t *usage) {
+  t3_memory_usage_t win_usage;
+
+  for (; win != NULL; win = win->next) {
+    t3_win_get_memory_usage(win, &win_usage);
+    usage->allocated += win_usage.allocated;
+    usage->used += win_usage.used;
+    add_window_list_memory_usage(win->head, usage);
+  }
+}
+
+/** Get the amount of memory used by the library.
+    @param usage The location to store the memory usage.
+
+    This includes all windows, the buffers used for updating the terminal and the attribute
+    map. Like for ::t3_win_get_memory_usage, the allocated size is the high-water mark since the
+    memory was last compacted with ::t3_term_compact.
+*/
+void t3_term_get_memory_usage(t3_memory_usage_t *usage) {
+  usage->allocated = 0;
+  usage->used = 0;
+  add_window_list_memory_usage(_t3_head, usage);
+  if (_t3_terminal_window != NULL) {
+    t3_memory_usage_t win_usage;
+    t3_win_get_memory_usage(_t3_terminal_window, &win_usage);
+    usage->allocated += win_usage.allocated + _t3_old_data.allocated;
+    usage->used += win_usage.used;
+  }
+  _t3_win_pool_memory_usage(usage);
+  _t3_output_memory_usage(usage);
+  _t3_arena_memory_usage(usage);
+  _t3_attr_map_memory_usage(usage);
+}
+
+/** @internal
+    @brief Apply ::t3_win_compact to a list of windows and all their children. */
+static void compact_window_list(t3_window_t *win) {
+  for (; win != NULL; win = win->next) {
+    t3_win_compact(win);
+    compact_window_list(win->head);
+  }
+}
+
+/** Release unused memory of all windows and the buffers used for updating the terminal.
+
+    All windows are compacted with ::t3_win_compact, deleted windows kept for reuse (see
+    ::t3_win_set_pool_size) are freed, and the buffers used for updating the terminal are
+    shrunk to their initial size. The attribute map is shrunk to the number of
+    attribute sets in use, but entries are not removed. Call ::t3_term_compact_attrs first to
+    also remove attribute sets that are no longer in use.
+
+    The released buffers are allocated again by the next update that needs them, so this is
+    best called when the application is idle. It must not be called from the callback set with
+    ::t3_term_set_user_callback.
+*/
+void t3_term_compact(void) {
+  char *resized;
+
+  compact_window_list(_t3_head);
+  _t3_win_pool_release();
+  if (_t3_terminal_window != NULL) {
+    t3_win_compact(_t3_terminal_window);
+  }
+  /* The contents of _t3_old_data are only used during the terminal update. */
+  if (_t3_old_data.allocated > INITIAL_ALLOC &&
+      (resized = _t3_realloc(_t3_old_data.data, INITIAL_ALLOC)) != NULL) {
+    _t3_old_data.data = resized;
+    _t3_old_data.allocated = INITIAL_ALLOC;
+    _t3_old_data.length = 0;
+    _t3_old_data.width = 0;
+    _t3_old_data.start = 0;
+  }
+  _t3_output_compact();
+  _t3_arena_free();
+  _t3_attr_map_compact();
+}
+
+/** @internal
+    @brief Calculate the cell width of (a prefix of) a string.
+    @param str The string to calculate the width of.
+    @param n The length of @p str.
+    @param max_width The maximum width of the prefix to measure.
+    @param bytes The location to store the length of the measured prefix.
+    @return The width of the measured prefix in character cells.
+
+    The prefix of @p str that is measured is the longest prefix of whole grapheme clusters that
+    does not exceed @p max_width cells. Runs of printable ASCII characters are counted in bulk,
+    and only other characters are decoded and looked up individually.
+*/
+static size_t strwidth_kernel(const char *str, size_t n, size_t max_width, size_t *bytes) {
+  size_t i = 0, total = 0, run, bytes_read;
+  int width;
+  t3_bool split;
+  cluster_lookahead_t lookahead;
+
+  lookahead.bytes = 0;
+  while (i < n) {
+    run = _t3_printable_ascii_run(str + i, n - i);
+    /* The last character of the run may start a cluster with the following characters. */
+    if (run > 0 && i + run < n && (unsigned char)str[i + run] >= 0x80 &&
+        _t3_utf8_extends_ascii(str + i + run, n - i - run, &lookahead)) {
+      run--;
+      lookahead.bytes = 0;
+    }
+    if (run > 0) {
+      if (run > max_width - total) {
+        if ((run = max_width - total) == 0) {
+          break;
+        }
+      }
+      i += run;
+      total += run;
+      continue;
+    }
+
+    bytes_read = _t3_utf8_get_cluster(str + i, n - i, &width, &split, &lookahead, t3_false);
+    if ((size_t)width > max_width - total) {
+      break;
+    }
+    total += width;
+    i += bytes_read;
+  }
+  *bytes = i;
+  return total;
+}
+
 /** Calculate the cell width of a string.
     @deprecated Use #t3_term_strncwidth instead.
 */
@@ -916,21 +1537,9 @@ int t3_term_strnwidth(const char *str, size_t n) { return t3_term_strncwidth(str
     on the terminal screen. This function is provided to calculate that value.
 */
 size_t t3_term_strncwidth(const char *str, size_t n) {
-  size_t bytes_read;
-  int width, width_state = 0, retval = 0;
-  uint32_t c;
-
-  for (; n > 0; n -= bytes_read, str += bytes_read) {
-    bytes_read = n;
-    c = t3_utf8_get(str, &bytes_read);
+  size_t bytes;
 
-    width = t3_utf8_wcwidth_ext(c, &width_state);
-    if (width < 0) {
-      continue;
-    }
-    retval += width;
-  }
-  return retval;
+  return strwidth_kernel(str, n, (size_t)-1, &bytes);
 }
 
 /** Calculate the cell width of a string.
@@ -947,6 +1556,205 @@ int t3_term_strwidth(const char *str) { return t3_term_strncwidth(str, strlen(st
 */
 size_t t3_term_strcwidth(const char *str) { return t3_term_strncwidth(str, strlen(str)); }
 
+/** Find the byte offset at which a string reaches a column.
+    @param str The string to search.
+    @param n The length of @p str.
+    @param column The column to search for.
+    @param width The location to store the width of the prefix up to the returned offset
+        (may be @c NULL).
+    @return The length of the longest prefix of @p str that fits in @p column cells.
+
+    Zero-width characters following the last character that fits are included in the prefix,
+    such that combining characters are not separated from the character they combine with.
+    If a double-width character straddles @p column, it is not included and the width of the
+    prefix is one less than @p column. This function is useful for clipping strings. For
+    repeated queries on long strings, see ::t3_term_column_index_new.
+*/
+size_t t3_term_strncolumn_offset(const char *str, size_t n, size_t column, size_t *width) {
+  size_t bytes, result_width;
+
+  result_width = strwidth_kernel(str, n, column, &bytes);
+  if (width != NULL) {
+    *width = result_width;
+  }
+  return bytes;
+}
+
+/** @internal
+    @brief Round a byte offset down to the start of the UTF-8 sequence containing it. */
+static size_t round_to_char_start(const char *str, size_t n, size_t offset) {
+  int i;
+
+  if (offset >= n) {
+    return n;
+  }
+  for (i = 0; i < 3 && offset > 0 && (str[offset] & 0xc0) == 0x80; i++) {
+    offset--;
+  }
+  return offset;
+}
+
+/** Calculate the column at which the character at a byte offset starts.
+    @param str The string to measure.
+    @param n The length of @p str.
+    @param offset The byte offset in @p str.
+    @return The width of the characters preceding @p offset in character cells.
+
+    If @p offset points into the middle of a UTF-8 sequence, the column of the start of that
+    sequence is returned. If @p offset is larger than @p n, the width of @p str is returned.
+    This function is useful for cursor placement. For repeated queries on long strings, see
+    ::t3_term_column_index_new.
+*/
+size_t t3_term_str_columns_until(const char *str, size_t n, size_t offset) {
+  size_t bytes;
+
+  return strwidth_kernel(str, round_to_char_start(str, n, offset), (size_t)-1, &bytes);
+}
+
+/** @internal
+    @brief The distance in columns between checkpoints in a ::t3_term_column_index_t. */
+#define COLUMN_INDEX_STEP 128
+
+/** @internal
+    @brief A position in a string at which measuring the width can be resumed. */
+typedef struct {
+  size_t offset; /**< The byte offset of the checkpoint. */
+  size_t column; /**< The column of the checkpoint. */
+} column_checkpoint_t;
+
+/** @internal
+    @brief Precomputed column positions for a long string. */
+struct t3_term_column_index_t {
+  const char *str;                 /**< The indexed string. */
+  size_t n;                        /**< The length of @c str. */
+  size_t count;                    /**< The number of entries in @c checkpoints. */
+  column_checkpoint_t *checkpoints; /**< Checkpoints, sorted by offset and by column. */
+};
+
+/** Create an index for quickly finding columns and byte offsets in a long string.
+    @param str The string to index. The string must remain valid and unchanged while the index
+        is in use.
+    @param n The length of @p str.
+    @return A new index, or @c NULL if no memory could be allocated.
+
+    The index stores the column at regular intervals in the string, such that
+    ::t3_term_column_index_offset and ::t3_term_column_index_columns only need to measure the
+    string from the nearest preceding interval. This makes their cost independent of the
+    position in the string, which avoids quadratic behavior when for example scrolling
+    horizontally through very long lines. The index should be freed using
+    ::t3_term_column_index_free.
+*/
+t3_term_column_index_t *t3_term_column_index_new(const char *str, size_t n) {
+  t3_term_column_index_t *index;
+  column_checkpoint_t checkpoint;
+  size_t allocated = 16, bytes;
+
+  if ((index = _t3_malloc(sizeof(t3_term_column_index_t))) == NULL) {
+    return NULL;
+  }
+  if ((index->checkpoints = _t3_malloc(allocated * sizeof(column_checkpoint_t))) == NULL) {
+    _t3_free(index);
+    return NULL;
+  }
+  index->str = str;
+  index->n = n;
+  index->count = 0;
+
+  checkpoint.offset = 0;
+  checkpoint.column = 0;
+  for (;;) {
+    if (index->count == allocated) {
+      column_checkpoint_t *new_checkpoints;
+      allocated *= 2;
+      if ((new_checkpoints = _t3_realloc(index->checkpoints,
+                                     allocated * sizeof(column_checkpoint_t))) == NULL) {
+        t3_term_column_index_free(index);
+        return NULL;
+      }
+      index->checkpoints = new_checkpoints;
+    }
+    index->checkpoints[index->count++] = checkpoint;
+    if (checkpoint.offset >= n) {
+      break;
+    }
+    /* Checkpoints are placed at grapheme cluster boundaries, which are not influenced by
+       preceding text. As clusters are at most two cells wide, each step makes progress. */
+    checkpoint.column += strwidth_kernel(str + checkpoint.offset, n - checkpoint.offset,
+                                         COLUMN_INDEX_STEP, &bytes);
+    checkpoint.offset += bytes;
+  }
+  return index;
+}
+
+/** Free an index created by ::t3_term_column_index_new. */
+void t3_term_column_index_free(t3_term_column_index_t *index) {
+  if (index == NULL) {
+    return;
+  }
+  _t3_free(index->checkpoints);
+  _t3_free(index);
+}
+
+/** Find the byte offset at which an indexed string reaches a column.
+    @param index The index of the string to search.
+    @param column The column to search for.
+    @param width The location to store the width of the prefix up to the returned offset
+        (may be @c NULL).
+    @return The length of the longest prefix of the string that fits in @p column cells.
+
+    See ::t3_term_strncolumn_offset for details.
+*/
+size_t t3_term_column_index_offset(const t3_term_column_index_t *index, size_t column,
+                                   size_t *width) {
+  size_t low = 0, high = index->count, mid, bytes, result_width;
+  const column_checkpoint_t *checkpoint;
+
+  /* Find the last checkpoint at or before the requested column. The first checkpoint is at
+     column 0, so there always is one. */
+  while (high - low > 1) {
+    mid = low + (high - low) / 2;
+    if (index->checkpoints[mid].column <= column) {
+      low = mid;
+    } else {
+      high = mid;
+    }
+  }
+  checkpoint = index->checkpoints + low;
+
+  result_width = strwidth_kernel(index->str + checkpoint->offset, index->n - checkpoint->offset,
+                                 column - checkpoint->column, &bytes);
+  if (width != NULL) {
+    *width = checkpoint->column + result_width;
+  }
+  return checkpoint->offset + bytes;
+}
+
+/** Calculate the column at which the character at a byte offset in an indexed string starts.
+    @param index The index of the string to measure.
+    @param offset The byte offset in the string.
+    @return The width of the characters preceding @p offset in character cells.
+
+    See ::t3_term_str_columns_until for details.
+*/
+size_t t3_term_column_index_columns(const t3_term_column_index_t *index, size_t offset) {
+  size_t low = 0, high = index->count, mid, bytes;
+  const column_checkpoint_t *checkpoint;
+
+  offset = round_to_char_start(index->str, index->n, offset);
+  while (high - low > 1) {
+    mid = low + (high - low) / 2;
+    if (index->checkpoints[mid].offset <= offset) {
+      low = mid;
+    } else {
+      high = mid;
+    }
+  }
+  checkpoint = index->checkpoints + low;
+
+  return checkpoint->column + strwidth_kernel(index->str + checkpoint->offset,
+                                              offset - checkpoint->offset, (size_t)-1, &bytes);
+}
+
 /** Check if a character is available in the alternate character set (internal use mostly).
     @param idx The character to check.
     @return ::t3_true if the character is available in the alternate character set.
@@ -1051,6 +1859,9 @@ void t3_term_get_caps_internal(t3_term_caps_t *caps, int version) {
   if (_t3_scp != NULL) {
     caps->cap_flags |= T3_TERM_CAP_CP;
   }
+  if (_t3_truecolor) {
+    caps->cap_flags |= T3_TERM_CAP_RGB;
+  }
 }
 
 /** @internal
@@ -1060,11 +1871,13 @@ t3_attr_t _t3_term_sanitize_attrs(t3_attr_t attrs) {
   /* Set color to unspecified if it is out of range. */
   if (_t3_scp == NULL) {
     if (((attrs & T3_ATTR_FG_MASK) >> T3_ATTR_COLOR_SHIFT) > (_t3_colors + 1) &&
-        (attrs & T3_ATTR_FG_MASK) != T3_ATTR_FG_DEFAULT) {
+        (attrs & T3_ATTR_FG_MASK) != T3_ATTR_FG_DEFAULT &&
+        ((attrs & T3_ATTR_FG_MASK) != T3_ATTR_FG_RGB || !_t3_truecolor)) {
       attrs &= ~T3_ATTR_FG_MASK;
     }
     if (((attrs & T3_ATTR_BG_MASK) >> (T3_ATTR_COLOR_SHIFT + 9)) > (_t3_colors + 1) &&
-        (attrs & T3_ATTR_BG_MASK) != T3_ATTR_BG_DEFAULT) {
+        (attrs & T3_ATTR_BG_MASK) != T3_ATTR_BG_DEFAULT &&
+        ((attrs & T3_ATTR_BG_MASK) != T3_ATTR_BG_RGB || !_t3_truecolor)) {
       attrs &= ~T3_ATTR_BG_MASK;
     }
   } else {
@@ -1076,6 +1889,144 @@ t3_attr_t _t3_term_sanitize_attrs(t3_attr_t attrs) {
   return attrs;
 }
 
+/** @internal
+    @brief The number of entries in ::quantize_cache. Must be a power of two. */
+#define QUANTIZE_CACHE_SIZE 256
+
+/** @internal
+    @brief Direct mapped cache of recently quantized RGB values. */
+static struct {
+  uint32_t rgb; /**< The RGB value, with bit 24 set to mark the entry as valid. */
+  int color;    /**< The color number the RGB value was mapped to. */
+} quantize_cache[QUANTIZE_CACHE_SIZE];
+/** @internal
+    @brief The value of ::_t3_attr_generation for which ::quantize_cache is valid. */
+static unsigned int quantize_cache_generation;
+
+/** @internal
+    @brief The RGB values of the 16 basic colors, as used by XTerm. */
+static const uint32_t basic_color_rgb[16] = {
+    0x000000, 0xcd0000, 0x00cd00, 0xcdcd00, 0x0000ee, 0xcd00cd, 0x00cdcd, 0xe5e5e5,
+    0x7f7f7f, 0xff0000, 0x00ff00, 0xffff00, 0x5c5cff, 0xff00ff, 0x00ffff, 0xffffff};
+
+/** @internal
+    @brief The intensity levels of the 6x6x6 color cube of 256 color terminals. */
+static const int cube_levels[6] = {0, 95, 135, 175, 215, 255};
+
+/** @internal
+    @brief Compute the perceptually weighted distance between two RGB values. */
+static long rgb_distance(uint32_t a, uint32_t b) {
+  long dr = (long)((a >> 16) & 0xff) - (long)((b >> 16) & 0xff);
+  long dg = (long)((a >> 8) & 0xff) - (long)((b >> 8) & 0xff);
+  long db = (long)(a & 0xff) - (long)(b & 0xff);
+  return 2 * dr * dr + 4 * dg * dg + 3 * db * db;
+}
+
+/** @internal
+    @brief Find the index of the nearest level in ::cube_levels. */
+static int nearest_cube_level(int value) {
+  if (value < 48) {
+    return 0;
+  } else if (value < 115) {
+    return 1;
+  }
+  return (value - 35) / 40;
+}
+
+/** @internal
+    @brief Find the color available on the terminal that is nearest to an RGB value.
+    @param rgb The RGB value to find the nearest color for.
+    @return The color number, or -1 if the terminal has no suitable colors.
+
+    For terminals with 256 colors, the 6x6x6 color cube and the gray ramp are used. The 16 basic
+    colors are not considered because they are frequently redefined by users. For terminals with
+    fewer colors, the XTerm default values for the basic colors are assumed.
+*/
+static int quantize_rgb(uint32_t rgb) {
+  int r = (rgb >> 16) & 0xff, g = (rgb >> 8) & 0xff, b = rgb & 0xff;
+  int i, best = -1;
+  long distance, best_distance = LONG_MAX;
+
+  if (_t3_colors >= 256) {
+    int ri = nearest_cube_level(r), gi = nearest_cube_level(g), bi = nearest_cube_level(b);
+    int gray_level = ((r + g + b) / 3 - 3) / 10;
+    uint32_t gray;
+
+    best = 16 + 36 * ri + 6 * gi + bi;
+    best_distance = rgb_distance(rgb, ((uint32_t)cube_levels[ri] << 16) |
+                                          ((uint32_t)cube_levels[gi] << 8) | cube_levels[bi]);
+
+    gray_level = gray_level < 0 ? 0 : gray_level > 23 ? 23 : gray_level;
+    gray = 8 + 10 * gray_level;
+    if (rgb_distance(rgb, (gray << 16) | (gray << 8) | gray) < best_distance) {
+      best = 232 + gray_level;
+    }
+    return best;
+  }
+
+  for (i = 0; i < 16 && i < _t3_colors; i++) {
+    distance = rgb_distance(rgb, basic_color_rgb[i]);
+    if (distance < best_distance) {
+      best = i;
+      best_distance = distance;
+    }
+  }
+  return best;
+}
+
+/** @internal
+    @brief Get the color available on the terminal that is nearest to an RGB value, using a cache.
+*/
+static int quantize_rgb_cached(uint32_t rgb) {
+  uint32_t hash;
+  int idx;
+
+  /* The available colors may change when the terminal is (re-)initialized. */
+  if (quantize_cache_generation != _t3_attr_generation) {
+    memset(quantize_cache, 0, sizeof(quantize_cache));
+    quantize_cache_generation = _t3_attr_generation;
+  }
+
+  rgb &= 0xffffff;
+  hash = rgb * UINT32_C(0x9e3779b1);
+  idx = (hash >> 24) & (QUANTIZE_CACHE_SIZE - 1);
+  if (quantize_cache[idx].rgb != (rgb | (UINT32_C(1) << 24))) {
+    quantize_cache[idx].rgb = rgb | (UINT32_C(1) << 24);
+    quantize_cache[idx].color = quantize_rgb(rgb);
+  }
+  return quantize_cache[idx].color;
+}
+
+/** @internal
+    @brief Replace direct RGB colors by the nearest available colors if the terminal can not
+        display them.
+    @param attrs The attributes to resolve.
+    @param fg_rgb The RGB value of the foreground color if it is ::T3_ATTR_FG_RGB.
+    @param bg_rgb The RGB value of the background color if it is ::T3_ATTR_BG_RGB.
+    @return @p attrs, with ::T3_ATTR_FG_RGB and ::T3_ATTR_BG_RGB replaced if required.
+*/
+t3_attr_t _t3_term_resolve_rgb(t3_attr_t attrs, uint32_t fg_rgb, uint32_t bg_rgb) {
+  int color;
+
+  if (_t3_truecolor) {
+    return attrs;
+  }
+
+  if ((attrs & T3_ATTR_FG_MASK) == T3_ATTR_FG_RGB) {
+    attrs &= ~T3_ATTR_FG_MASK;
+    if (_t3_scp == NULL && (color = quantize_rgb_cached(fg_rgb)) >= 0) {
+      attrs |= T3_ATTR_FG(color);
+    }
+  }
+  if ((attrs & T3_ATTR_BG_MASK) == T3_ATTR_BG_RGB) {
+    attrs &= ~T3_ATTR_BG_MASK;
+    if (_t3_scp == NULL && (color = quantize_rgb_cached(bg_rgb)) >= 0) {
+      attrs |= T3_ATTR_BG(color);
+    }
+  }
+  return attrs;
+}
+
 /** Retrieve the state of the modifiers using terminal specific hacks.
 
     This function can be used to retrieve the modifier state from the terminal,
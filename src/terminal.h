@@ -85,6 +85,31 @@ typedef struct {
 #define T3_TERM_CAP_BG (1 << 1)
 /** Terminal capability flag: terminal uses color pairs for setting color. */
 #define T3_TERM_CAP_CP (1 << 2)
+/** Terminal capability flag: terminal can display direct RGB colors. */
+#define T3_TERM_CAP_RGB (1 << 3)
+
+/** Attributes, including the RGB values for ::T3_ATTR_FG_RGB and ::T3_ATTR_BG_RGB.
+
+    The RGB values are encoded as 0xRRGGBB, which can be created using the ::T3_RGB macro. They
+    are only used if the corresponding color in @c attr is set to ::T3_ATTR_FG_RGB or
+    ::T3_ATTR_BG_RGB respectively.
+*/
+typedef struct {
+  t3_attr_t attr;       /**< The attributes. */
+  unsigned long fg_rgb; /**< The RGB value of the foreground color. */
+  unsigned long bg_rgb; /**< The RGB value of the background color. */
+} t3_attr_ext_t;
+
+/** Create an RGB value for use in ::t3_attr_ext_t. */
+#define T3_RGB(r, g, b) \
+  ((((unsigned long)(r) & 0xff) << 16) | (((unsigned long)(g) & 0xff) << 8) | \
+   ((unsigned long)(b) & 0xff))
+
+/** An opaque struct holding precomputed column positions for a long string.
+
+    See ::t3_term_column_index_new for details.
+*/
+typedef struct t3_term_column_index_t t3_term_column_index_t;
 
 /** User callback type.
     The user callback is passed a pointer to the characters that are is marked with
@@ -93,6 +118,24 @@ typedef struct {
 */
 typedef void (*t3_attr_user_callback_t)(const char *str, int length, int width, t3_attr_t attr);
 
+/** Memory allocation functions used by the library.
+
+    See ::t3_set_allocator for details. The functions must behave like the C library functions
+    @c malloc, @c realloc and @c free.
+*/
+typedef struct {
+  void *(*malloc_func)(size_t size);              /**< Allocate @c size bytes. */
+  void *(*realloc_func)(void *ptr, size_t size); /**< Resize the allocation @c ptr. */
+  void (*free_func)(void *ptr);                  /**< Release the allocation @c ptr. */
+} t3_allocator_t;
+
+/** Memory usage, as reported by ::t3_win_get_memory_usage and ::t3_term_get_memory_usage. */
+typedef struct {
+  size_t allocated; /**< The number of bytes allocated. */
+  size_t used;      /**< The number of allocated bytes holding data. The difference with
+                         @c allocated can be reclaimed by compacting. */
+} t3_memory_usage_t;
+
 /** @name Attributes */
 /*@{*/
 /** Use callback for drawing the characters.
@@ -138,6 +181,8 @@ typedef void (*t3_attr_user_callback_t)(const char *str, int length, int width,
 #define T3_ATTR_FG_UNSPEC ((t3_attr_t)0L)
 /** Foreground color default. */
 #define T3_ATTR_FG_DEFAULT (((t3_attr_t)257) << (T3_ATTR_COLOR_SHIFT))
+/** Foreground color direct RGB. Only meaningful with ::t3_attr_ext_t. */
+#define T3_ATTR_FG_RGB (((t3_attr_t)258) << (T3_ATTR_COLOR_SHIFT))
 /** Foreground color black. */
 #define T3_ATTR_FG_BLACK T3_ATTR_FG(0)
 /** Foreground color red. */
@@ -159,6 +204,8 @@ typedef void (*t3_attr_user_callback_t)(const char *str, int length, int width,
 #define T3_ATTR_BG_UNSPEC ((t3_attr_t)0L)
 /** Background color default. */
 #define T3_ATTR_BG_DEFAULT (((t3_attr_t)257) << (T3_ATTR_COLOR_SHIFT + 9))
+/** Background color direct RGB. Only meaningful with ::t3_attr_ext_t. */
+#define T3_ATTR_BG_RGB (((t3_attr_t)258) << (T3_ATTR_COLOR_SHIFT + 9))
 /** Background color black. */
 #define T3_ATTR_BG_BLACK T3_ATTR_BG(0)
 /** Background color red. */
@@ -237,6 +284,7 @@ enum {
 /*@}*/
 
 T3_WINDOW_API const char *t3_window_strerror(int error);
+T3_WINDOW_API void t3_set_allocator(const t3_allocator_t *allocator);
 
 /** @} */
 
@@ -265,9 +313,23 @@ T3_WINDOW_API int t3_term_strwidth(const char *str);
 
 T3_WINDOW_API size_t t3_term_strncwidth(const char *str, size_t n);
 T3_WINDOW_API size_t t3_term_strcwidth(const char *str);
+T3_WINDOW_API size_t t3_term_strncolumn_offset(const char *str, size_t n, size_t column,
+                                               size_t *width);
+T3_WINDOW_API size_t t3_term_str_columns_until(const char *str, size_t n, size_t offset);
+
+T3_WINDOW_API t3_term_column_index_t *t3_term_column_index_new(const char *str, size_t n);
+T3_WINDOW_API void t3_term_column_index_free(t3_term_column_index_t *index);
+T3_WINDOW_API size_t t3_term_column_index_offset(const t3_term_column_index_t *index,
+                                                 size_t column, size_t *width);
+T3_WINDOW_API size_t t3_term_column_index_columns(const t3_term_column_index_t *index,
+                                                  size_t offset);
 
 T3_WINDOW_API t3_attr_t t3_term_combine_attrs(t3_attr_t a, t3_attr_t b);
 T3_WINDOW_API t3_attr_t t3_term_get_ncv(void);
+/** This is implemented in window_paint.c */
+T3_WINDOW_API int t3_term_compact_attrs(void);
+T3_WINDOW_API void t3_term_get_memory_usage(t3_memory_usage_t *usage);
+T3_WINDOW_API void t3_term_compact(void);
 
 T3_WINDOW_API void t3_term_disable_ansi_optimization(void);
 
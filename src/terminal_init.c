@@ -73,20 +73,18 @@ t3_bool _t3_terminal_is_screen;
 static char *smcup, /**< Terminal control string: start cursor positioning mode. */
     *rmcup;         /**< Terminal control string: stop cursor positioning mode. */
 
-#ifndef HAS_STRDUP
+/** @internal
+    @brief Duplicate a string using the allocator set with ::t3_set_allocator. */
 static char *strdup_impl(const char *str) {
   char *result;
   size_t len = strlen(str) + 1;
 
-  if ((result = malloc(len)) == NULL) {
+  if ((result = _t3_malloc(len)) == NULL) {
     return NULL;
   }
   memcpy(result, str, len);
   return result;
 }
-#else
-#define strdup_impl strdup
-#endif
 
 /** Get a terminfo string.
     @param name The name of the requested terminfo string.
@@ -233,11 +231,11 @@ static void detect_ansi(void) {
         if (streq(rmso, "\033[27m")) {
           _t3_ansi_attrs |= T3_ATTR_REVERSE;
         }
-        free(rmso);
+        _t3_free(rmso);
       } else {
         _t3_ansi_attrs |= T3_ATTR_REVERSE;
       }
-      free(smso);
+      _t3_free(smso);
     }
   } else {
     non_existent |= T3_ATTR_REVERSE;
@@ -275,6 +273,65 @@ static void detect_ansi(void) {
   }
 }
 
+/** Determine the length of the ANSI reset sequence at the start of a string.
+    @return The length of the reset sequence, or 0 if @p str does not start with it.
+*/
+static size_t ansi_reset_length(const char *str) {
+  if (strncmp(str, "\033[m", 3) == 0) {
+    return 3;
+  } else if (strncmp(str, "\033[0m", 4) == 0) {
+    return 4;
+  }
+  return 0;
+}
+
+/** Detect whether setting attributes through @c sgr resets the colors as well.
+
+    Only the ANSI reset sequence is known to reset the colors, and only if the colors are ANSI
+    colors as well. Therefore, the result of @c sgr without any attributes must consist of
+    exactly the ANSI reset, optionally combined with @c rmacs. Anything else, like
+    parameterized sequences which can not be evaluated here, is assumed not to reset the colors.
+    The result for @c sgr without any attributes is checked rather than the @c sgr string
+    itself, such that the conditional parts of the string do not need to be interpreted.
+*/
+static void detect_sgr_resets_colors(void) {
+  const char *reset;
+  size_t length, rmacs_length;
+
+  _t3_sgr_resets_colors = t3_false;
+  if (_t3_sgr == NULL || (~_t3_ansi_attrs & (T3_ATTR_FG_MASK | T3_ATTR_BG_MASK)) != 0 ||
+      (reset = _t3_tparm(_t3_sgr, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0)) == NULL) {
+    return;
+  }
+
+  length = ansi_reset_length(reset);
+  if (length > 0 && reset[length] == 0) {
+    _t3_sgr_resets_colors = t3_true;
+  } else if (_t3_rmacs != NULL) {
+    rmacs_length = strlen(_t3_rmacs);
+    if (length > 0) {
+      _t3_sgr_resets_colors = streq(reset + length, _t3_rmacs);
+    } else if (strncmp(reset, _t3_rmacs, rmacs_length) == 0) {
+      length = ansi_reset_length(reset + rmacs_length);
+      _t3_sgr_resets_colors = length > 0 && reset[rmacs_length + length] == 0;
+    }
+  }
+}
+
+/** Detect whether the terminal supports direct RGB colors.
+
+    Terminfo has no standard capability for this. Recent versions of ncurses use the @c RGB
+    capability, while tmux introduced @c Tc. Many terminal emulators don't provide either, but
+    announce their support by setting the @c COLORTERM environment variable instead.
+*/
+static void detect_truecolor(void) {
+  const char *colorterm = getenv("COLORTERM");
+
+  _t3_truecolor =
+      _t3_tigetflag("RGB") > 0 || _t3_tigetflag("Tc") > 0 ||
+      (colorterm != NULL && (streq(colorterm, "truecolor") || streq(colorterm, "24bit")));
+}
+
 /** Send a string for measuring it's on screen width.
 
     This function moves the cursor to the top left position, writes the test
@@ -353,7 +410,7 @@ static int init_sequences(const char *term) {
 
   if ((smcup = get_ti_string("smcup")) == NULL || (rmcup = get_ti_string("rmcup")) == NULL) {
     if (smcup != NULL) {
-      free(smcup);
+      _t3_free(smcup);
       smcup = NULL;
     }
   }
@@ -435,6 +492,8 @@ static int init_sequences(const char *term) {
   _t3_op = get_ti_string("op");
 
   detect_ansi();
+  detect_sgr_resets_colors();
+  detect_truecolor();
 
   /* If sgr0 and sgr are not defined, don't go into modes in _t3_reset_required_mask. */
   if (_t3_sgr0 == NULL && _t3_sgr == NULL) {
@@ -444,10 +503,10 @@ static int init_sequences(const char *term) {
     _t3_blink = NULL;
     _t3_dim = NULL;
     if (_t3_rmul == NULL) {
-      CLEAR(_t3_smul, free);
+      CLEAR(_t3_smul, _t3_free);
     }
     if (_t3_rmacs == NULL) {
-      CLEAR(_t3_smacs, free);
+      CLEAR(_t3_smacs, _t3_free);
     }
   }
 
@@ -457,12 +516,19 @@ static int init_sequences(const char *term) {
   }
 
   if ((_t3_sc = get_ti_string("sc")) != NULL && (_t3_rc = get_ti_string("rc")) == NULL) {
-    CLEAR(_t3_sc, free);
+    CLEAR(_t3_sc, _t3_free);
   }
 
   _t3_civis = get_ti_string("civis");
   _t3_cnorm = get_ti_string("cnorm");
 
+  if ((_t3_csr = get_ti_string("csr")) != NULL) {
+    _t3_ind = get_ti_string("ind");
+    _t3_indn = get_ti_string("indn");
+    _t3_ri = get_ti_string("ri");
+    _t3_rin = get_ti_string("rin");
+  }
+
   if (_t3_smacs != NULL && (acsc = get_ti_string("acsc")) != NULL) {
     if (_t3_sgr != NULL || _t3_smacs != NULL) {
       size_t i;
@@ -470,7 +536,7 @@ static int init_sequences(const char *term) {
         _t3_alternate_chars[(unsigned int)acsc[i]] = acsc[i + 1];
       }
     }
-    free(acsc);
+    _t3_free(acsc);
   }
 
   ncv_int = _t3_tigetnum("ncv");
@@ -498,7 +564,7 @@ static int init_sequences(const char *term) {
   /* Enable alternate character set if required by terminal. */
   if ((enacs = get_ti_string("enacs")) != NULL) {
     _t3_putp(enacs);
-    free(enacs);
+    _t3_free(enacs);
   }
 
   return T3_ERR_SUCCESS;
@@ -621,6 +687,10 @@ static void integrate_environment(void) {
       override_colors(_t3_colors, value);
     } else if (check_opt(opts, "ansi=off")) {
       _t3_ansi_attrs = 0;
+    } else if (check_opt(opts, "truecolor=on")) {
+      _t3_truecolor = t3_true;
+    } else if (check_opt(opts, "truecolor=off")) {
+      _t3_truecolor = t3_false;
     }
     while (*opts != 0 && *opts != ' ') {
       opts++;
@@ -708,7 +778,14 @@ int t3_term_init(int fd, const char *term) {
     }
 
     integrate_environment();
+    /* Direct RGB colors can only be set using ANSI sequences. */
+    if ((_t3_ansi_attrs & (T3_ATTR_FG_MASK | T3_ATTR_BG_MASK)) == 0) {
+      _t3_truecolor = t3_false;
+    }
     seqs_initialised = t3_true;
+    /* The color capabilities determine how attributes are mapped, so any
+       previously resolved attribute handles must be revalidated. */
+    _t3_attr_generation++;
   }
 
 /* Get terminal size. First try ioctl, then environment, then terminfo. */
@@ -752,7 +829,10 @@ int t3_term_init(int fd, const char *term) {
     if ((_t3_terminal_window = t3_win_new(NULL, _t3_lines, _t3_columns, 0, 0, 0)) == NULL) {
       return T3_ERR_ERRNO;
     }
-    if ((_t3_old_data.data = malloc(sizeof(t3_attr_t) * INITIAL_ALLOC)) == NULL) {
+    /* A reused window may have line buffers in a slab, which the terminal window can not use
+       (see _t3_win_slab_alloc). As all lines are empty, compacting releases them. */
+    t3_win_compact(_t3_terminal_window);
+    if ((_t3_old_data.data = _t3_malloc(INITIAL_ALLOC)) == NULL) {
       return T3_ERR_ERRNO;
     }
     _t3_old_data.allocated = INITIAL_ALLOC;
@@ -867,37 +947,43 @@ void t3_term_deinit(void) {
   CLEAR(_t3_putp_file, fclose);
 
   seqs_initialised = t3_false;
-  CLEAR(smcup, free);
-  CLEAR(rmcup, free);
-  CLEAR(_t3_clear, free);
-  CLEAR(_t3_cup, free);
-  CLEAR(_t3_hpa, free);
-  CLEAR(_t3_vpa, free);
-  CLEAR(_t3_sgr, free);
-  CLEAR(_t3_sgr0, free);
-  CLEAR(_t3_smul, free);
-  CLEAR(_t3_rmul, free);
-  CLEAR(_t3_bold, free);
-  CLEAR(_t3_rev, free);
-  CLEAR(_t3_blink, free);
-  CLEAR(_t3_dim, free);
-  CLEAR(_t3_smacs, free);
-  CLEAR(_t3_rmacs, free);
-  CLEAR(_t3_setaf, free);
-  CLEAR(_t3_setf, free);
-  CLEAR(_t3_setab, free);
-  CLEAR(_t3_setb, free);
-  CLEAR(_t3_scp, free);
-  CLEAR(_t3_op, free);
-  CLEAR(_t3_el, free);
-  CLEAR(_t3_sc, free);
-  CLEAR(_t3_rc, free);
-  CLEAR(_t3_civis, free);
-  CLEAR(_t3_cnorm, free);
+  CLEAR(smcup, _t3_free);
+  CLEAR(rmcup, _t3_free);
+  CLEAR(_t3_clear, _t3_free);
+  CLEAR(_t3_cup, _t3_free);
+  CLEAR(_t3_hpa, _t3_free);
+  CLEAR(_t3_vpa, _t3_free);
+  CLEAR(_t3_sgr, _t3_free);
+  CLEAR(_t3_sgr0, _t3_free);
+  CLEAR(_t3_smul, _t3_free);
+  CLEAR(_t3_rmul, _t3_free);
+  CLEAR(_t3_bold, _t3_free);
+  CLEAR(_t3_rev, _t3_free);
+  CLEAR(_t3_blink, _t3_free);
+  CLEAR(_t3_dim, _t3_free);
+  CLEAR(_t3_smacs, _t3_free);
+  CLEAR(_t3_rmacs, _t3_free);
+  CLEAR(_t3_setaf, _t3_free);
+  CLEAR(_t3_setf, _t3_free);
+  CLEAR(_t3_setab, _t3_free);
+  CLEAR(_t3_setb, _t3_free);
+  CLEAR(_t3_scp, _t3_free);
+  CLEAR(_t3_op, _t3_free);
+  CLEAR(_t3_el, _t3_free);
+  CLEAR(_t3_sc, _t3_free);
+  CLEAR(_t3_rc, _t3_free);
+  CLEAR(_t3_civis, _t3_free);
+  CLEAR(_t3_cnorm, _t3_free);
+  CLEAR(_t3_csr, _t3_free);
+  CLEAR(_t3_ind, _t3_free);
+  CLEAR(_t3_indn, _t3_free);
+  CLEAR(_t3_ri, _t3_free);
+  CLEAR(_t3_rin, _t3_free);
 
   CLEAR(_t3_terminal_window, t3_win_del);
-  CLEAR(_t3_old_data.data, free);
+  CLEAR(_t3_old_data.data, _t3_free);
   _t3_free_output_buffer();
+  _t3_arena_free();
   _t3_free_attr_map();
   if (transcript_init_done) {
     transcript_finalize();
@@ -11,8 +11,11 @@
    You should have received a copy of the GNU General Public License
    along with this program.  If not, see <http://www.gnu.org/licenses/>.
 */
+#include <string.h>
+
 #include "utf8.h"
 #include "generated/chardata.h"
+#include "internal.h"
 
 /* Returns whether a codepoint is one of the conjoining Jamo L codepoints. */
 static t3_bool is_conjoining_jamo_l(uint32_t c) { return c >= 0x1100 && c <= 0x1112; }
@@ -179,7 +182,7 @@ size_t t3_utf8_put(uint32_t c, char *dst) {
     it. This is mostly similar to the result of wcwidth, with the exception
     of some characters where terminals actually use a different value.
 */
-int t3_utf8_wcwidth(uint32_t c) { return (int)(get_chardata(c) >> 6) - 1; }
+int t3_utf8_wcwidth(uint32_t c) { return T3_CHARDATA_WIDTH(get_chardata(c)); }
 
 typedef enum {
   JAMO_NONE,
@@ -195,9 +198,15 @@ typedef enum {
     @p state should be initialized with 0.
 */
 int t3_utf8_wcwidth_ext(uint32_t c, int *state) {
+  return _t3_utf8_wcwidth_data(c, get_chardata(c), state);
+}
+
+/** @internal
+    @brief Like t3_utf8_wcwidth_ext, but using the already retrieved chardata entry for @p c.
+*/
+int _t3_utf8_wcwidth_data(uint32_t c, unsigned data, int *state) {
   if (is_conjoining_jamo_l(c)) {
     *state = JAMO_L;
-    return t3_utf8_wcwidth(c);
   } else if (*state == JAMO_L && is_conjoining_jamo_v(c)) {
     *state = JAMO_LV;
     return 0;
@@ -206,9 +215,281 @@ int t3_utf8_wcwidth_ext(uint32_t c, int *state) {
     return 0;
   } else if (is_conjoining_jamo_lv(c)) {
     *state = JAMO_LV;
-    return t3_utf8_wcwidth(c);
   } else {
     *state = JAMO_NONE;
-    return t3_utf8_wcwidth(c);
   }
+  return T3_CHARDATA_WIDTH(data);
+}
+
+/** @internal
+    @brief Get the first codepoint from a UTF-8 string.
+
+    This gives the same result as ::t3_utf8_get, but decodes well-formed sequences inline. Only
+    malformed sequences are passed to ::t3_utf8_get.
+*/
+static uint32_t get_codepoint(const char *src, size_t *size) {
+  const unsigned char *s = (const unsigned char *)src;
+  uint32_t c;
+
+  if (s[0] < 0x80) {
+    *size = 1;
+    return s[0];
+  } else if (s[0] >= 0xC2 && s[0] < 0xE0 && *size >= 2 && (s[1] & 0xC0) == 0x80) {
+    *size = 2;
+    return ((uint32_t)(s[0] & 0x1F) << 6) | (s[1] & 0x3F);
+  } else if (s[0] >= 0xE0 && s[0] < 0xF0 && *size >= 3 && (s[1] & 0xC0) == 0x80 &&
+             (s[2] & 0xC0) == 0x80) {
+    *size = 3;
+    c = ((uint32_t)(s[0] & 0x0F) << 12) | ((uint32_t)(s[1] & 0x3F) << 6) | (s[2] & 0x3F);
+    return c < 0x800 ? 0xFFFD : c;
+  } else if (s[0] >= 0xF0 && s[0] < 0xF5 && *size >= 4 && (s[1] & 0xC0) == 0x80 &&
+             (s[2] & 0xC0) == 0x80 && (s[3] & 0xC0) == 0x80) {
+    *size = 4;
+    c = ((uint32_t)(s[0] & 0x07) << 18) | ((uint32_t)(s[1] & 0x3F) << 12) |
+        ((uint32_t)(s[2] & 0x3F) << 6) | (s[3] & 0x3F);
+    return c < 0x10000 || c > 0x10FFFF ? 0xFFFD : c;
+  }
+  return t3_utf8_get(src, size);
+}
+
+/** @internal
+    @brief The maximum size in bytes of a grapheme cluster stored in the cluster width cache. */
+#define CLUSTER_CACHE_MAX_BYTES 61
+/** @internal
+    @brief The number of entries in the cluster width cache. Must be a power of two. */
+#define CLUSTER_CACHE_SIZE 64
+
+/** @internal
+    @brief An entry in the cluster width cache. */
+typedef struct {
+  unsigned char length;                 /**< The size of the cluster, or 0 for an unused entry. */
+  signed char width;                    /**< The width of the cluster. */
+  unsigned char split;                  /**< Whether the cluster must be split in code points. */
+  char bytes[CLUSTER_CACHE_MAX_BYTES]; /**< The UTF-8 encoded cluster. */
+} cluster_cache_entry_t;
+
+/** @internal
+    @brief Cache of the widths of recently seen multi-code point grapheme clusters.
+
+    The cache is direct mapped, using a hash of the bytes of the cluster. Emoji sequences in
+    particular are often repeated, and this saves recomputing their width from the properties of
+    the individual code points. The cache is only used when drawing in windows, which is not
+    reentrant anyway. The functions measuring strings, like ::t3_term_strncwidth, do not use it,
+    such that they can be called from any thread.
+*/
+static cluster_cache_entry_t cluster_cache[CLUSTER_CACHE_SIZE];
+
+/** @internal
+    @brief Determine whether a grapheme cluster continues with the next code point.
+    @param prev The Grapheme_Cluster_Break property of the previous code point.
+    @param data The chardata entry of the next code point.
+    @param emoji_zwj Whether the previous code point is a ZWJ following an Extended_Pictographic
+        code point and any number of Extend code points.
+    @param ri_odd Whether the cluster ends in an odd number of Regional_Indicator code points.
+
+    This implements the extended grapheme cluster rules GB3 to GB13 from Unicode Standard Annex
+    #29.
+*/
+static t3_bool cluster_continues(int prev, unsigned data, t3_bool emoji_zwj, t3_bool ri_odd) {
+  int next = T3_CHARDATA_GRAPHEME_BREAK(data);
+
+  /* Most code points have no special Grapheme_Cluster_Break property, so check that first. */
+  if (next == T3_GCB_OTHER) {
+    return prev == T3_GCB_PREPEND || (emoji_zwj && (data & T3_CHARDATA_EXTENDED_PICTOGRAPHIC));
+  }
+  if (prev == T3_GCB_CR && next == T3_GCB_LF) {
+    return t3_true;
+  }
+  if (prev == T3_GCB_CONTROL || prev == T3_GCB_CR || prev == T3_GCB_LF ||
+      next == T3_GCB_CONTROL || next == T3_GCB_CR || next == T3_GCB_LF) {
+    return t3_false;
+  }
+  switch (prev) {
+    case T3_GCB_L:
+      if (next == T3_GCB_L || next == T3_GCB_V || next == T3_GCB_LV || next == T3_GCB_LVT) {
+        return t3_true;
+      }
+      break;
+    case T3_GCB_LV:
+    case T3_GCB_V:
+      if (next == T3_GCB_V || next == T3_GCB_T) {
+        return t3_true;
+      }
+      break;
+    case T3_GCB_LVT:
+    case T3_GCB_T:
+      if (next == T3_GCB_T) {
+        return t3_true;
+      }
+      break;
+    case T3_GCB_PREPEND:
+      return t3_true;
+    default:
+      break;
+  }
+  if (next == T3_GCB_EXTEND || next == T3_GCB_ZWJ || next == T3_GCB_SPACINGMARK) {
+    return t3_true;
+  }
+  if (emoji_zwj && (data & T3_CHARDATA_EXTENDED_PICTOGRAPHIC)) {
+    return t3_true;
+  }
+  return ri_odd && next == T3_GCB_REGIONAL_INDICATOR;
+}
+
+/** @internal
+    @brief Calculate the width of a grapheme cluster from its code points.
+    @param str The UTF-8 encoded cluster.
+    @param n The size of @p str.
+    @param split The location to store whether the cluster must be split in code points.
+    @return The width of the cluster.
+
+    A cluster must be split if it can not be drawn as a unit: if it contains non-printable code
+    points, if it does not start with a code point that takes up space, or if it is wider than
+    two cells. The width of a split cluster is the sum of the widths of the code points.
+    Otherwise, Extended_Pictographic code points joined by a ZWJ and emoji modifiers are drawn
+    as part of the preceding emoji, and take up no additional space.
+*/
+static int cluster_width(const char *str, size_t n, t3_bool *split) {
+  size_t i, bytes;
+  uint32_t c;
+  unsigned data;
+  int width, total = 0, joined = 0, state = 0, prev = T3_GCB_OTHER;
+
+  *split = t3_false;
+  for (i = 0; i < n; i += bytes) {
+    bytes = n - i;
+    c = get_codepoint(str + i, &bytes);
+    data = get_chardata(c);
+    width = _t3_utf8_wcwidth_data(c, data, &state);
+    if (width < 0 || (i == 0 && width == 0) ||
+        ((data & T3_CHARDATA_CONTROL) && T3_CHARDATA_GRAPHEME_BREAK(data) != T3_GCB_ZWJ)) {
+      *split = t3_true;
+    }
+    if (width > 0) {
+      total += width;
+      if (i == 0 || (!(prev == T3_GCB_ZWJ && (data & T3_CHARDATA_EXTENDED_PICTOGRAPHIC)) &&
+                     !(T3_CHARDATA_GRAPHEME_BREAK(data) == T3_GCB_EXTEND && width == 2))) {
+        joined += width;
+      }
+    }
+    prev = T3_CHARDATA_GRAPHEME_BREAK(data);
+  }
+  if (joined > 2) {
+    *split = t3_true;
+  }
+  return *split ? total : joined;
+}
+
+/** @internal
+    @brief Find the grapheme cluster at the start of a string.
+    @param str The UTF-8 encoded string.
+    @param n The size of @p str, which must be larger than 0.
+    @param width The location to store the width of the cluster.
+    @param split The location to store whether the cluster must be split in code points, because
+        it can not be drawn as a unit. See ::cluster_width for details.
+    @param lookahead The code point at the start of @p str, if already known. On return, this
+        contains the code point following the cluster, if it had to be decoded. The @c bytes
+        member must be set to 0 before the first call, and whenever the caller skips any part
+        of the string.
+    @param use_cache Boolean indicating whether to use ::cluster_cache for the widths of clusters
+        consisting of multiple code points. This must only be set by functions that are not
+        reentrant.
+    @return The size of the cluster in bytes.
+*/
+size_t _t3_utf8_get_cluster(const char *str, size_t n, int *width, t3_bool *split,
+                            cluster_lookahead_t *lookahead, t3_bool use_cache) {
+  cluster_cache_entry_t *entry;
+  size_t i, bytes, first_bytes;
+  uint32_t c;
+  uint64_t head, tail, hash;
+  unsigned data, first_data;
+  int prev;
+  t3_bool emoji, emoji_zwj, ri_odd;
+
+  if (lookahead->bytes != 0) {
+    first_bytes = lookahead->bytes;
+    first_data = data = lookahead->data;
+  } else {
+    first_bytes = n;
+    c = get_codepoint(str, &first_bytes);
+    first_data = data = get_chardata(c);
+  }
+  lookahead->bytes = 0;
+  prev = T3_CHARDATA_GRAPHEME_BREAK(data);
+  emoji = (data & T3_CHARDATA_EXTENDED_PICTOGRAPHIC) != 0;
+  emoji_zwj = t3_false;
+  ri_odd = prev == T3_GCB_REGIONAL_INDICATOR;
+
+  for (i = first_bytes; i < n; i += bytes) {
+    /* ASCII characters only continue a cluster after CR or a Prepend code point. */
+    if ((unsigned char)str[i] < 0x80 && prev != T3_GCB_CR && prev != T3_GCB_PREPEND) {
+      break;
+    }
+    bytes = n - i;
+    c = get_codepoint(str + i, &bytes);
+    data = get_chardata(c);
+    if (!cluster_continues(prev, data, emoji_zwj, ri_odd)) {
+      lookahead->bytes = bytes;
+      lookahead->data = data;
+      break;
+    }
+    prev = T3_CHARDATA_GRAPHEME_BREAK(data);
+    emoji_zwj = emoji && prev == T3_GCB_ZWJ;
+    if (data & T3_CHARDATA_EXTENDED_PICTOGRAPHIC) {
+      emoji = t3_true;
+    } else if (prev != T3_GCB_EXTEND) {
+      emoji = t3_false;
+    }
+    ri_odd = prev == T3_GCB_REGIONAL_INDICATOR && !ri_odd;
+  }
+
+  if (i == first_bytes) {
+    *width = T3_CHARDATA_WIDTH(first_data);
+    *split = *width <= 0 || (first_data & T3_CHARDATA_CONTROL);
+    if (*width < 0) {
+      *width = 0;
+    }
+    return i;
+  }
+
+  if (!use_cache || i > CLUSTER_CACHE_MAX_BYTES) {
+    *width = cluster_width(str, i, split);
+    return i;
+  }
+
+  /* Hash the first and last (up to) eight bytes, which is enough to distinguish most clusters
+     without having to go over all bytes. */
+  head = tail = 0;
+  if (i >= 8) {
+    memcpy(&head, str, 8);
+    memcpy(&tail, str + i - 8, 8);
+  } else {
+    memcpy(&head, str, i);
+  }
+  hash = (head * UINT64_C(0x9E3779B97F4A7C15)) ^ (tail * UINT64_C(0xC2B2AE3D27D4EB4F)) ^ i;
+  entry = cluster_cache + ((hash >> 32) & (CLUSTER_CACHE_SIZE - 1));
+  if (entry->length != i || memcmp(entry->bytes, str, i) != 0) {
+    t3_bool entry_split;
+    entry->width = cluster_width(str, i, &entry_split);
+    entry->split = entry_split;
+    entry->length = i;
+    memcpy(entry->bytes, str, i);
+  }
+  *width = entry->width;
+  *split = entry->split;
+  return i;
+}
+
+/** @internal
+    @brief Determine whether a code point extends a preceding printable ASCII character into a
+        grapheme cluster.
+    @param str The UTF-8 encoded string following the ASCII character.
+    @param n The size of @p str, which must be larger than 0.
+    @param lookahead The location to store the code point at the start of @p str, for passing to
+        ::_t3_utf8_get_cluster.
+*/
+t3_bool _t3_utf8_extends_ascii(const char *str, size_t n, cluster_lookahead_t *lookahead) {
+  lookahead->bytes = n;
+  lookahead->data = get_chardata(get_codepoint(str, &lookahead->bytes));
+  return cluster_continues(T3_GCB_OTHER, lookahead->data, t3_false, t3_false);
 }
@@ -28,6 +28,17 @@
 t3_window_t *_t3_head, /**< @internal Head of depth sorted t3_window_t list. */
     *_t3_tail;         /**< @internal Tail of depth sorted t3_window_t list. */
 
+/** @internal
+    @brief The maximum size of a slab for allocating line buffers. */
+#define LINE_SLAB_SIZE 65536
+
+static t3_window_t *pool; /**< @internal Deleted windows kept for reuse, linked through @c next. */
+static int pool_size,     /**< @internal The maximum number of windows in ::pool. */
+    pool_fill;            /**< @internal The number of windows in ::pool. */
+
+static t3_window_t *reuse_pooled_window(int height);
+static void free_window(t3_window_t *win);
+
 /** @addtogroup t3window_win */
 /** @{ */
 
@@ -103,6 +114,24 @@ static t3_bool has_loops(t3_window_t *win, t3_window_t *start) {
           (win->restrictw != NULL && has_loops(win->restrictw, start)));
 }
 
+/** @internal
+    @brief Initialize the position of a zeroed t3_window_t, and insert it into the list of known
+        windows. */
+static void init_window(t3_window_t *win, t3_window_t *parent, int height, int width, int y, int x,
+                        int depth) {
+  win->x = x;
+  win->y = y;
+  win->width = width;
+  win->height = height;
+  win->parent = parent;
+  win->anchor = NULL;
+  win->restrictw = NULL;
+  win->depth = depth;
+  win->cached_pos_line = -1;
+
+  insert_window(win);
+}
+
 /** Create a new t3_window_t.
     @param parent t3_window_t used for clipping and relative positioning.
     @param height The desired height in terminal lines.
@@ -118,28 +147,152 @@ static t3_bool has_loops(t3_window_t *win, t3_window_t *start) {
     holds relative to the @p parent window. The position will be relative to
     the top-left corner of the @p parent window, or to the top-left corner of
     the terminal if @p parent is @c NULL.
+
+    If windows are kept for reuse (see ::t3_win_set_pool_size), a deleted window is reused
+    instead of allocating a new one.
 */
 t3_window_t *t3_win_new(t3_window_t *parent, int height, int width, int y, int x, int depth) {
   t3_window_t *retval;
-  int i;
+
+  if (height > 0 && width > 0 && (retval = reuse_pooled_window(height)) != NULL) {
+    init_window(retval, parent, height, width, y, x, depth);
+    return retval;
+  }
 
   if ((retval = t3_win_new_unbacked(parent, height, width, y, x, depth)) == NULL) {
     return NULL;
   }
 
-  if ((retval->lines = calloc(1, sizeof(line_data_t) * height)) == NULL) {
+  /* The buffers of the lines are only allocated when the lines are first drawn on. */
+  if ((retval->lines = _t3_calloc(1, sizeof(line_data_t) * height)) == NULL) {
     t3_win_del(retval);
     return NULL;
   }
+  return retval;
+}
 
-  for (i = 0; i < height; i++) {
-    retval->lines[i].allocated = width > INITIAL_ALLOC ? INITIAL_ALLOC : width;
-    if ((retval->lines[i].data = malloc(retval->lines[i].allocated)) == NULL) {
-      t3_win_del(retval);
-      return NULL;
-    }
+/** Create a new t3_window_t with a cell grid as backing store.
+    @param parent t3_window_t used for clipping and relative positioning.
+    @param height The desired height in terminal lines.
+    @param width The desired width in terminal columns.
+    @param y The vertical location of the window in terminal lines.
+    @param x The horizontal location of the window in terminal columns.
+    @param depth The depth of the window in the stack of windows.
+    @return A pointer to a new t3_window_t struct or @c NULL if not enough
+        memory could be allocated.
+
+    Windows created by ::t3_win_new store each line as a sequence of variable
+    size characters, which is compact but requires scanning the line for
+    drawing at a given column. Windows created by this function store a fixed
+    size cell for each position instead, such that ::t3_win_put_cell takes
+    constant time. All other drawing functions work the same for both kinds
+    of windows. The cell grid uses more memory, so it is most useful for
+    windows that are updated one cell at a time, or at random positions.
+
+    See ::t3_win_new for a description of the parameters.
+*/
+t3_window_t *t3_win_new_grid(t3_window_t *parent, int height, int width, int y, int x,
+                             int depth) {
+  t3_window_t *retval;
+
+  if ((retval = t3_win_new_unbacked(parent, height, width, y, x, depth)) == NULL) {
+    return NULL;
+  }
+
+  if ((retval->grid = _t3_grid_new(height, width)) == NULL) {
+    t3_win_del(retval);
+    return NULL;
+  }
+  return retval;
+}
+
+/** Create a new t3_window_t to be used as a canvas for viewport windows.
+    @param height The desired height in terminal lines.
+    @param width The desired width in terminal columns.
+    @return A pointer to a new t3_window_t struct or @c NULL if not enough
+        memory could be allocated or an invalid parameter was passed.
+
+    A canvas is a hidden window that can be much larger than the terminal. Like for all
+    windows, the memory for each line is only allocated when the line is first drawn on, so
+    large canvases with few used lines are cheap. A part of the canvas can be shown using a
+    window created with ::t3_win_new_viewport. All drawing functions can be used on a canvas.
+*/
+t3_window_t *t3_win_new_canvas(int height, int width) {
+  return t3_win_new(NULL, height, width, 0, 0, 0);
+}
+
+/** Create a new t3_window_t that shows a part of another t3_window_t.
+    @param parent t3_window_t used for clipping and relative positioning.
+    @param height The desired height in terminal lines.
+    @param width The desired width in terminal columns.
+    @param y The vertical location of the window in terminal lines.
+    @param x The horizontal location of the window in terminal columns.
+    @param depth The depth of the window in the stack of windows.
+    @param canvas The t3_window_t to show. Usually created with ::t3_win_new_canvas.
+    @return A pointer to a new t3_window_t struct or @c NULL if not enough
+        memory could be allocated or an invalid parameter was passed.
+
+    The viewport shows the contents of @p canvas, starting at the position set with
+    ::t3_win_set_viewport_offset. The contents are not copied, but taken directly from
+    @p canvas when updating the terminal, so moving the view only requires changing the
+    offset. The default attributes of @p canvas are used for the parts of the canvas that have
+    not been drawn on. Parts of the viewport outside the canvas are not drawn.
+
+    A viewport can not be used for drawing. The @p canvas must not be deleted while it is shown
+    by a viewport. See ::t3_win_new for a description of the other parameters.
+*/
+t3_window_t *t3_win_new_viewport(t3_window_t *parent, int height, int width, int y, int x,
+                                 int depth, t3_window_t *canvas) {
+  t3_window_t *retval;
+
+  if (canvas == NULL || (canvas->lines == NULL && canvas->grid == NULL && canvas->log == NULL)) {
+    return NULL;
+  }
+
+  if ((retval = t3_win_new_unbacked(parent, height, width, y, x, depth)) == NULL) {
+    return NULL;
+  }
+  retval->canvas = canvas;
+  return retval;
+}
+
+/** Create a new t3_window_t that shows the end of a log of lines.
+    @param parent t3_window_t used for clipping and relative positioning.
+    @param height The desired height in terminal lines.
+    @param width The desired width in terminal columns.
+    @param y The vertical location of the window in terminal lines.
+    @param x The horizontal location of the window in terminal columns.
+    @param depth The depth of the window in the stack of windows.
+    @param max_lines The maximum number of lines kept in the log.
+    @return A pointer to a new t3_window_t struct or @c NULL if not enough
+        memory could be allocated or an invalid parameter was passed.
+
+    The contents of a log window can only be changed by adding lines at the end using
+    ::t3_win_log_append, which takes constant time. Once the log holds @p max_lines lines,
+    adding a line drops the oldest line. The window shows a view of @p height lines of the
+    log, which by default follows the end of the log. The view can be scrolled back using
+    ::t3_win_log_set_offset, which does not change the stored lines. Lines that are not in
+    view are stored packed together, to allow keeping a large number of lines in the log.
+
+    The other drawing functions can not be used on a log window. See ::t3_win_new for a
+    description of the other parameters.
+*/
+t3_window_t *t3_win_new_log(t3_window_t *parent, int height, int width, int y, int x, int depth,
+                            int max_lines) {
+  t3_window_t *retval;
+
+  if (max_lines <= 0) {
+    return NULL;
   }
 
+  if ((retval = t3_win_new_unbacked(parent, height, width, y, x, depth)) == NULL) {
+    return NULL;
+  }
+
+  if ((retval->log = _t3_log_new(max_lines)) == NULL) {
+    t3_win_del(retval);
+    return NULL;
+  }
   return retval;
 }
 
@@ -167,21 +320,10 @@ t3_window_t *t3_win_new_unbacked(t3_window_t *parent, int height, int width, int
     return NULL;
   }
 
-  if ((retval = calloc(1, sizeof(t3_window_t))) == NULL) {
+  if ((retval = _t3_calloc(1, sizeof(t3_window_t))) == NULL) {
     return NULL;
   }
-
-  retval->x = x;
-  retval->y = y;
-  retval->width = width;
-  retval->height = height;
-  retval->parent = parent;
-  retval->anchor = NULL;
-  retval->restrictw = NULL;
-  retval->depth = depth;
-  retval->cached_pos_line = -1;
-
-  insert_window(retval);
+  init_window(retval, parent, height, width, y, x, depth);
   return retval;
 }
 
@@ -334,9 +476,11 @@ t3_bool t3_win_set_restrict(t3_window_t *win, t3_window_t *restrictw) {
 
     Note that child windows are @em not automatically discarded as well. All
     child windows have their parent attribute set to @c NULL.
+
+    If windows are kept for reuse (see ::t3_win_set_pool_size), the window may be kept instead
+    of being freed. Either way, @p win must not be used after calling this function.
 */
 void t3_win_del(t3_window_t *win) {
-  int i;
   if (win == NULL) {
     return;
   }
@@ -350,13 +494,349 @@ void t3_win_del(t3_window_t *win) {
     t3_win_set_parent(win->head, NULL);
   }
 
+  /* Only windows created by t3_win_new can be reused. Their contents are cleared on reuse. */
+  if (pool_fill < pool_size && win->lines != NULL && win != _t3_terminal_window) {
+    win->next = pool;
+    pool = win;
+    pool_fill++;
+    return;
+  }
+  free_window(win);
+}
+
+/** @internal
+    @brief Free all memory used by a t3_window_t, which must not be in any list of windows. */
+static void free_window(t3_window_t *win) {
+  int i;
+
   if (win->lines != NULL) {
+    /* Only lines that outgrew their buffer in the slab have their own allocation. */
     for (i = 0; i < win->height; i++) {
-      free(win->lines[i].data);
+      if (!_t3_win_in_slab(win, win->lines[i].data)) {
+        _t3_free(win->lines[i].data);
+      }
     }
-    free(win->lines);
+    _t3_free(win->lines);
+  }
+  while (win->slab != NULL) {
+    line_slab_t *slab = win->slab;
+    win->slab = slab->next;
+    _t3_free(slab);
+  }
+  _t3_grid_free(win->grid);
+  _t3_log_free(win->log);
+  _t3_free(win);
+}
+
+/** Set the maximum number of deleted windows kept for reuse.
+    @param size The maximum number of windows to keep. Zero, the default, disables reuse.
+
+    Applications that create and delete windows at a high rate, for example for menus,
+    tooltips and completion lists, can keep deleted windows to avoid allocating a new window
+    and its line buffers each time. Windows created by ::t3_win_new (and therefore by the C++
+    @c window_t::alloc) are kept by ::t3_win_del, and reused by ::t3_win_new for a window of any
+    size. The contents of a reused window are cleared by marking its lines as empty, such that
+    the line buffers are reused as well. Reducing @p size releases the windows that no longer
+    fit in the pool.
+*/
+void t3_win_set_pool_size(int size) {
+  t3_window_t *win;
+
+  pool_size = size < 0 ? 0 : size;
+  while (pool_fill > pool_size) {
+    win = pool;
+    pool = win->next;
+    pool_fill--;
+    free_window(win);
+  }
+}
+
+/** @internal
+    @brief Take a window from the pool of deleted windows, for use as a window of a given height.
+    @param height The number of lines required.
+    @return A zeroed t3_window_t with @p height empty lines, or @c NULL if the pool is empty or
+        no memory could be allocated.
+
+    A window of at least @p height lines is preferred, such that the line array need not be
+    reallocated.
+*/
+static t3_window_t *reuse_pooled_window(int height) {
+  t3_window_t **ptr, **best = NULL, *win;
+  line_data_t *lines;
+  line_slab_t *slab;
+  int i, old_height;
+
+  for (ptr = &pool; *ptr != NULL; ptr = &(*ptr)->next) {
+    if (best == NULL || ((*best)->height < height && (*ptr)->height > (*best)->height) ||
+        ((*ptr)->height >= height && (*ptr)->height < (*best)->height)) {
+      best = ptr;
+    }
+  }
+  if (best == NULL) {
+    return NULL;
+  }
+  win = *best;
+  *best = win->next;
+  pool_fill--;
+
+  old_height = win->height;
+  if (height > old_height) {
+    if ((lines = _t3_realloc(win->lines, height * sizeof(line_data_t))) == NULL) {
+      free_window(win);
+      return NULL;
+    }
+    win->lines = lines;
+    memset(win->lines + old_height, 0, sizeof(line_data_t) * (height - old_height));
+  } else {
+    for (i = height; i < old_height; i++) {
+      if (!_t3_win_in_slab(win, win->lines[i].data)) {
+        _t3_free(win->lines[i].data);
+      }
+    }
+    /* The array is not shrunk, but the lines past the new height are no longer used. */
+    memset(win->lines + height, 0, sizeof(line_data_t) * (old_height - height));
+  }
+  for (i = 0; i < height && i < old_height; i++) {
+    win->lines[i].length = 0;
+    win->lines[i].width = 0;
+    win->lines[i].start = 0;
+  }
+
+  lines = win->lines;
+  slab = win->slab;
+  memset(win, 0, sizeof(t3_window_t));
+  win->lines = lines;
+  win->slab = slab;
+  return win;
+}
+
+/** @internal
+    @brief Add the memory used by the pool of deleted windows to a t3_memory_usage_t.
+
+    As the windows are kept for their buffers, all their memory is counted as used.
+*/
+void _t3_win_pool_memory_usage(t3_memory_usage_t *usage) {
+  t3_memory_usage_t win_usage;
+  const t3_window_t *win;
+
+  for (win = pool; win != NULL; win = win->next) {
+    t3_win_get_memory_usage(win, &win_usage);
+    usage->allocated += win_usage.allocated;
+    usage->used += win_usage.allocated;
+  }
+}
+
+/** @internal
+    @brief Free all windows in the pool of deleted windows, without changing its size. */
+void _t3_win_pool_release(void) {
+  int size = pool_size;
+
+  t3_win_set_pool_size(0);
+  pool_size = size;
+}
+
+/** @internal
+    @brief Allocate the first buffer of a line of a t3_window_t.
+    @param win The t3_window_t the line belongs to.
+    @param size The size of the buffer.
+    @return A pointer to the buffer, or @c NULL if the buffer should be allocated separately.
+
+    The buffers are allocated consecutively from a slab, such that the lines of a window are
+    mostly stored together, and the whole window can be freed at once. When a line needs a
+    larger buffer, it is moved to a separate allocation, and its buffer in the slab is not
+    reused.
+*/
+char *_t3_win_slab_alloc(t3_window_t *win, int size) {
+  line_slab_t *slab = win->slab;
+  size_t slab_size;
+  char *result;
+
+  /* The lines of the terminal window are exchanged with _t3_old_data during the terminal
+     update, so they must be allocated separately. */
+  if (win == _t3_terminal_window) {
+    return NULL;
+  }
+  /* A slab for a single line only adds overhead. Furthermore, the line of a single line window
+     is exchanged with a line of another window by t3_win_set_line. */
+  if (win->height == 1) {
+    return NULL;
+  }
+
+  if (slab == NULL || slab->size - slab->fill < (size_t)size) {
+    slab_size = (size_t)win->height * INITIAL_ALLOC;
+    if (slab_size > LINE_SLAB_SIZE) {
+      slab_size = LINE_SLAB_SIZE;
+    }
+    if (slab_size < (size_t)size) {
+      slab_size = size;
+    }
+    /* The data is allocated together with the slab. */
+    if ((slab = _t3_malloc(sizeof(line_slab_t) + slab_size)) == NULL) {
+      return NULL;
+    }
+    slab->data = (char *)(slab + 1);
+    slab->size = slab_size;
+    slab->fill = 0;
+    slab->next = win->slab;
+    win->slab = slab;
+  }
+
+  result = slab->data + slab->fill;
+  slab->fill += size;
+  return result;
+}
+
+/** @internal
+    @brief Check whether a line buffer was allocated from the slabs of a t3_window_t. */
+t3_bool _t3_win_in_slab(const t3_window_t *win, const char *data) {
+  const line_slab_t *slab;
+
+  if (data == NULL) {
+    return t3_false;
+  }
+  for (slab = win->slab; slab != NULL; slab = slab->next) {
+    if (data >= slab->data && data < slab->data + slab->size) {
+      return t3_true;
+    }
+  }
+  return t3_false;
+}
+
+/** Get the amount of memory used by a t3_window_t.
+    @param win The t3_window_t to get the memory usage of.
+    @param usage The location to store the memory usage.
+
+    The memory used for storing the contents of a window only grows while drawing, so the
+    allocated size is the high-water mark of the contents since the window was created or last
+    compacted with ::t3_win_compact. Child windows are not included.
+*/
+void t3_win_get_memory_usage(const t3_window_t *win, t3_memory_usage_t *usage) {
+  const line_slab_t *slab;
+  int i;
+
+  usage->allocated = sizeof(t3_window_t);
+  usage->used = sizeof(t3_window_t);
+
+  if (win->lines != NULL) {
+    usage->allocated += win->height * sizeof(line_data_t);
+    usage->used += win->height * sizeof(line_data_t);
+    for (i = 0; i < win->height; i++) {
+      if (!_t3_win_in_slab(win, win->lines[i].data)) {
+        usage->allocated += win->lines[i].allocated;
+      }
+      usage->used += win->lines[i].length;
+    }
+  }
+  for (slab = win->slab; slab != NULL; slab = slab->next) {
+    usage->allocated += sizeof(line_slab_t) + slab->size;
+  }
+  if (win->grid != NULL) {
+    _t3_grid_memory_usage(win->grid, win->height, usage);
+  }
+  if (win->log != NULL) {
+    _t3_log_memory_usage(win->log, usage);
+  }
+}
+
+/** Release unused memory of a t3_window_t.
+    @param win The t3_window_t to compact.
+
+    The buffers of lines are shrunk to the size of their contents, and buffers of empty lines are
+    released. Line buffers allocated from a slab can not be shrunk individually, but a slab is
+    released once none of the lines use it. The contents of the window are not changed.
+*/
+void t3_win_compact(t3_window_t *win) {
+  line_slab_t **slab_ptr, *slab;
+  line_data_t *line;
+  char *resized;
+  int i;
+
+  if (win->lines != NULL) {
+    for (i = 0; i < win->height; i++) {
+      line = win->lines + i;
+      if (line->length == 0) {
+        if (!_t3_win_in_slab(win, line->data)) {
+          _t3_free(line->data);
+        }
+        line->data = NULL;
+        line->allocated = 0;
+      } else if (line->allocated > line->length && !_t3_win_in_slab(win, line->data) &&
+                 (resized = _t3_realloc(line->data, line->length)) != NULL) {
+        line->data = resized;
+        line->allocated = line->length;
+      }
+    }
+  }
+
+  for (slab_ptr = &win->slab; *slab_ptr != NULL;) {
+    slab = *slab_ptr;
+    if (win->lines != NULL) {
+      for (i = 0; i < win->height; i++) {
+        if (win->lines[i].data >= slab->data && win->lines[i].data < slab->data + slab->size) {
+          break;
+        }
+      }
+      if (i < win->height) {
+        slab_ptr = &slab->next;
+        continue;
+      }
+    }
+    *slab_ptr = slab->next;
+    _t3_free(slab);
+  }
+
+  if (win->grid != NULL) {
+    _t3_grid_compact(win->grid);
+  }
+  if (win->log != NULL) {
+    _t3_log_compact(win->log);
+  }
+}
+
+/** @internal
+    @brief Reverse the order of a range of lines. */
+static void reverse_lines(line_data_t *lines, int count) {
+  line_data_t save;
+  int i;
+
+  for (i = 0; i < count / 2; i++) {
+    save = lines[i];
+    lines[i] = lines[count - 1 - i];
+    lines[count - 1 - i] = save;
+  }
+}
+
+/** @internal
+    @brief Scroll a range of lines by rotating the line_data_t structs.
+    @param lines The lines to scroll.
+    @param count The number of lines in @p lines.
+    @param n The number of lines to scroll up, or down if negative.
+
+    The data of the lines is not copied. The lines that are scrolled in are cleared.
+*/
+void _t3_rotate_lines(line_data_t *lines, int count, int n) {
+  int i, first, last, shift;
+
+  if (n == 0) {
+    return;
+  } else if (n >= count || -n >= count) {
+    first = 0;
+    last = count;
+  } else {
+    /* Scrolling down by -n lines is the same as scrolling up by count + n lines. */
+    shift = n < 0 ? count + n : n;
+    reverse_lines(lines, shift);
+    reverse_lines(lines + shift, count - shift);
+    reverse_lines(lines, count);
+    first = n > 0 ? count - n : 0;
+    last = n > 0 ? count : -n;
+  }
+
+  for (i = first; i < last; i++) {
+    lines[i].length = 0;
+    lines[i].width = 0;
+    lines[i].start = 0;
   }
-  free(win);
 }
 
 /** Change a t3_window_t's size.
@@ -374,6 +854,15 @@ t3_bool t3_win_resize(t3_window_t *win, int height, int width) {
     return t3_false;
   }
 
+  if (win->grid != NULL) {
+    if (!_t3_grid_resize(win, height, width)) {
+      return t3_false;
+    }
+    win->height = height;
+    win->width = width;
+    return t3_true;
+  }
+
   if (win->lines == NULL) {
     win->height = height;
     win->width = width;
@@ -382,23 +871,16 @@ t3_bool t3_win_resize(t3_window_t *win, int height, int width) {
 
   if (height > win->height) {
     void *result;
-    if ((result = realloc(win->lines, height * sizeof(line_data_t))) == NULL) {
+    if ((result = _t3_realloc(win->lines, height * sizeof(line_data_t))) == NULL) {
       return t3_false;
     }
     win->lines = result;
     memset(win->lines + win->height, 0, sizeof(line_data_t) * (height - win->height));
-    for (i = win->height; i < height; i++) {
-      if ((win->lines[i].data = malloc(INITIAL_ALLOC)) == NULL) {
-        for (i = win->height; i < height && win->lines[i].data != NULL; i++) {
-          free(win->lines[i].data);
-        }
-        return t3_false;
-      }
-      win->lines[i].allocated = INITIAL_ALLOC;
-    }
   } else if (height < win->height) {
     for (i = height; i < win->height; i++) {
-      free(win->lines[i].data);
+      if (!_t3_win_in_slab(win, win->lines[i].data)) {
+        _t3_free(win->lines[i].data);
+      }
     }
     memset(win->lines + height, 0, sizeof(line_data_t) * (win->height - height));
   }
@@ -423,6 +905,96 @@ t3_bool t3_win_resize(t3_window_t *win, int height, int width) {
   return t3_true;
 }
 
+/** Scroll the contents of a t3_window_t.
+    @param win The t3_window_t to scroll.
+    @param n The number of lines to scroll up, or down if negative.
+
+    The lines that are scrolled into view are cleared. For windows with line storage, the lines
+    are scrolled without copying their contents. If the visible part of @p win spans the full
+    width of the terminal, the next ::t3_term_update will also try to scroll the terminal
+    contents using the scrolling region of the terminal, instead of drawing all lines again.
+
+    For windows created with ::t3_win_new_log or ::t3_win_new_viewport, this moves the view
+    instead, and no lines are cleared.
+*/
+void t3_win_scroll(t3_window_t *win, int n) {
+  if (n == 0) {
+    return;
+  }
+
+  if (win->log != NULL) {
+    t3_win_log_set_offset(win, t3_win_log_get_offset(win) - n);
+    return;
+  } else if (win->canvas != NULL) {
+    t3_win_set_viewport_offset(win, win->canvas_y + n, win->canvas_x);
+    return;
+  } else if (win->grid != NULL) {
+    _t3_grid_scroll(win, n);
+  } else if (win->lines != NULL) {
+    _t3_rotate_lines(win->lines, win->height, n);
+    win->cached_pos_line = -1;
+  } else {
+    return;
+  }
+  _t3_win_scroll_hint(win, n);
+}
+
+/** @internal
+    @brief Tell the terminal update code that the contents of a t3_window_t have been scrolled.
+    @param win The t3_window_t that was scrolled.
+    @param n The number of lines scrolled up, or down if negative.
+
+    Only windows that are visible and span the full width of the terminal can be scrolled using
+    the scrolling region of the terminal. The part of the window that is visible is used, i.e.
+    the window is clipped to its parents first. For other windows this function does nothing.
+*/
+void _t3_win_scroll_hint(t3_window_t *win, int n) {
+  t3_window_t *parent;
+  int top, bottom, left, right, tmp;
+
+  if (n == 0 || _t3_terminal_window == NULL || win == _t3_terminal_window ||
+      !_t3_win_is_shown(win)) {
+    return;
+  }
+
+  top = t3_win_get_abs_y(win);
+  bottom = top + win->height;
+  left = t3_win_get_abs_x(win);
+  right = left + win->width;
+  for (parent = win->parent; parent != NULL; parent = parent->parent) {
+    tmp = t3_win_get_abs_y(parent);
+    if (tmp > top) {
+      top = tmp;
+    }
+    tmp += parent->height;
+    if (tmp < bottom) {
+      bottom = tmp;
+    }
+
+    tmp = t3_win_get_abs_x(parent);
+    if (tmp > left) {
+      left = tmp;
+    }
+    tmp += parent->width;
+    if (tmp < right) {
+      right = tmp;
+    }
+  }
+
+  if (left > 0 || right < _t3_terminal_window->width) {
+    return;
+  }
+  if (top < 0) {
+    top = 0;
+  }
+  if (bottom > _t3_terminal_window->height) {
+    bottom = _t3_terminal_window->height;
+  }
+  if (top < bottom - 1) {
+    _t3_term_scroll_hint(top, bottom - 1, n);
+  }
+}
+
 /** Change a t3_window_t's position.
     @param win The t3_window_t to change the position of.
     @param y The desired new vertical position of the t3_window_t in terminal lines.
@@ -435,6 +1007,36 @@ void t3_win_move(t3_window_t *win, int y, int x) {
   win->x = x;
 }
 
+/** Set the position in the canvas shown by a viewport.
+    @param win The t3_window_t created by ::t3_win_new_viewport.
+    @param y The line of the canvas shown at the top of the viewport.
+    @param x The column of the canvas shown at the left of the viewport.
+
+    The position may lie outside the canvas. Like ::t3_win_move, this function only updates
+    the internal book keeping. It does nothing for other windows.
+*/
+void t3_win_set_viewport_offset(t3_window_t *win, int y, int x) {
+  int scroll;
+
+  if (win->canvas == NULL) {
+    return;
+  }
+  scroll = y - win->canvas_y;
+  win->canvas_y = y;
+  if (x != win->canvas_x) {
+    win->canvas_x = x;
+  } else {
+    /* A vertical move only scrolls the contents of the viewport. */
+    _t3_win_scroll_hint(win, scroll);
+  }
+}
+
+/** Get the line of the canvas shown at the top of a viewport. */
+int t3_win_get_viewport_y(const t3_window_t *win) { return win->canvas_y; }
+
+/** Get the column of the canvas shown at the left of a viewport. */
+int t3_win_get_viewport_x(const t3_window_t *win) { return win->canvas_x; }
+
 /** Get a t3_window_t's width. */
 int t3_win_get_width(const t3_window_t *win) { return win->width; }
 
@@ -57,11 +57,41 @@ enum t3_win_anchor_t {
 */
 typedef struct t3_window_t t3_window_t;
 
+/** Attributes resolved for drawing in a window, as returned by ::t3_win_resolve_attr.
+
+    The members of this struct should be considered private. They are only
+    exposed such that handles can be stored without extra allocations.
+    @ingroup t3window_other
+*/
+typedef struct {
+  t3_attr_t attrs;         /**< The attributes which were resolved. */
+  unsigned long fg_rgb;    /**< The RGB value of the foreground color which was resolved. */
+  unsigned long bg_rgb;    /**< The RGB value of the background color which was resolved. */
+  t3_attr_t default_attrs; /**< The default attributes of the window used for resolving. */
+  int idx;                 /**< The index of the resolved attributes in the attribute map. */
+  unsigned int generation; /**< The generation of the attribute map at the time of resolving. */
+} t3_attr_handle_t;
+
+/** An opaque struct holding a string prepared for repeated drawing.
+
+    See ::t3_prepare_str for details.
+    @ingroup t3window_other
+*/
+typedef struct t3_prepared_str_t t3_prepared_str_t;
+
 T3_WINDOW_API t3_window_t *t3_win_new(t3_window_t *parent, int height, int width, int y, int x,
                                       int depth);
 T3_WINDOW_API t3_window_t *t3_win_new_unbacked(t3_window_t *parent, int height, int width, int y,
                                                int x, int depth);
+T3_WINDOW_API t3_window_t *t3_win_new_grid(t3_window_t *parent, int height, int width, int y,
+                                           int x, int depth);
+T3_WINDOW_API t3_window_t *t3_win_new_canvas(int height, int width);
+T3_WINDOW_API t3_window_t *t3_win_new_viewport(t3_window_t *parent, int height, int width, int y,
+                                               int x, int depth, t3_window_t *canvas);
+T3_WINDOW_API t3_window_t *t3_win_new_log(t3_window_t *parent, int height, int width, int y, int x,
+                                          int depth, int max_lines);
 T3_WINDOW_API void t3_win_del(t3_window_t *win);
+T3_WINDOW_API void t3_win_set_pool_size(int size);
 
 T3_WINDOW_API t3_bool t3_win_set_parent(t3_window_t *win, t3_window_t *parent);
 T3_WINDOW_API t3_bool t3_win_set_anchor(t3_window_t *win, t3_window_t *anchor, int relation);
@@ -71,6 +101,12 @@ T3_WINDOW_API t3_bool t3_win_set_restrict(t3_window_t *win, t3_window_t *restric
 
 T3_WINDOW_API t3_bool t3_win_resize(t3_window_t *win, int height, int width);
 T3_WINDOW_API void t3_win_move(t3_window_t *win, int y, int x);
+T3_WINDOW_API void t3_win_scroll(t3_window_t *win, int n);
+T3_WINDOW_API void t3_win_get_memory_usage(const t3_window_t *win, t3_memory_usage_t *usage);
+T3_WINDOW_API void t3_win_compact(t3_window_t *win);
+T3_WINDOW_API void t3_win_set_viewport_offset(t3_window_t *win, int y, int x);
+T3_WINDOW_API int t3_win_get_viewport_y(const t3_window_t *win);
+T3_WINDOW_API int t3_win_get_viewport_x(const t3_window_t *win);
 T3_WINDOW_API int t3_win_get_width(const t3_window_t *win);
 T3_WINDOW_API int t3_win_get_height(const t3_window_t *win);
 T3_WINDOW_API int t3_win_get_x(const t3_window_t *win);
@@ -89,6 +125,23 @@ T3_WINDOW_API t3_bool t3_win_is_shown(t3_window_t *win);
 T3_WINDOW_API int t3_win_addnstr(t3_window_t *win, const char *str, size_t n, t3_attr_t attr);
 T3_WINDOW_API int t3_win_addstr(t3_window_t *win, const char *str, t3_attr_t attr);
 T3_WINDOW_API int t3_win_addch(t3_window_t *win, char c, t3_attr_t attr);
+T3_WINDOW_API int t3_win_put_cell(t3_window_t *win, int y, int x, const char *str, size_t n,
+                                  t3_attr_t attr);
+T3_WINDOW_API int t3_win_addnstr_ext(t3_window_t *win, const char *str, size_t n,
+                                     const t3_attr_ext_t *attr);
+
+T3_WINDOW_API t3_attr_handle_t t3_win_resolve_attr(const t3_window_t *win, t3_attr_t attr);
+T3_WINDOW_API t3_attr_handle_t t3_win_resolve_attr_ext(const t3_window_t *win,
+                                                       const t3_attr_ext_t *attr);
+T3_WINDOW_API int t3_win_addnstr_h(t3_window_t *win, const char *str, size_t n,
+                                   t3_attr_handle_t *handle);
+T3_WINDOW_API int t3_win_addstr_h(t3_window_t *win, const char *str, t3_attr_handle_t *handle);
+T3_WINDOW_API int t3_win_addch_h(t3_window_t *win, char c, t3_attr_handle_t *handle);
+
+T3_WINDOW_API t3_prepared_str_t *t3_prepare_str(const char *str, size_t n, t3_attr_t attr);
+T3_WINDOW_API void t3_prepared_str_free(t3_prepared_str_t *prepared);
+T3_WINDOW_API int t3_prepared_str_get_width(const t3_prepared_str_t *prepared);
+T3_WINDOW_API int t3_win_add_prepared(t3_window_t *win, t3_prepared_str_t *prepared);
 
 T3_WINDOW_API int t3_win_addnstrrep(t3_window_t *win, const char *str, size_t n, t3_attr_t attr,
                                     int rep);
@@ -96,6 +149,19 @@ T3_WINDOW_API int t3_win_addstrrep(t3_window_t *win, const char *str, t3_attr_t
 T3_WINDOW_API int t3_win_addchrep(t3_window_t *win, char c, t3_attr_t attr, int rep);
 
 T3_WINDOW_API int t3_win_box(t3_window_t *win, int y, int x, int height, int width, t3_attr_t attr);
+T3_WINDOW_API int t3_win_fill_rect(t3_window_t *win, int y, int x, int height, int width,
+                                   const char *str, t3_attr_t attr);
+T3_WINDOW_API int t3_win_hline(t3_window_t *win, int y, int x, int length, t3_attr_t attr);
+T3_WINDOW_API int t3_win_vline(t3_window_t *win, int y, int x, int length, t3_attr_t attr);
+T3_WINDOW_API t3_bool t3_win_copy_region(t3_window_t *src, int src_y, int src_x, t3_window_t *dst,
+                                         int dst_y, int dst_x, int height, int width);
+T3_WINDOW_API t3_bool t3_win_set_line(t3_window_t *win, int y, t3_window_t *line);
+
+T3_WINDOW_API int t3_win_log_append(t3_window_t *win, const char *str, size_t n, t3_attr_t attr);
+T3_WINDOW_API void t3_win_log_set_offset(t3_window_t *win, int offset);
+T3_WINDOW_API int t3_win_log_get_offset(const t3_window_t *win);
+T3_WINDOW_API int t3_win_log_get_lines(const t3_window_t *win);
+T3_WINDOW_API void t3_win_log_clear(t3_window_t *win);
 
 T3_WINDOW_API void t3_win_clrtoeol(t3_window_t *win);
 T3_WINDOW_API void t3_win_clrtobot(t3_window_t *win);
@@ -188,6 +254,51 @@ class T3_WINDOW_API window_t {
     }
   }
 
+  /** Call t3_win_new_grid. To preserve consistency with t3_win_new->alloc, this is named
+      alloc_grid. */
+  void alloc_grid(const window_t *parent, int height, int width, int y, int x, int depth) {
+    t3_win_del(window_);
+    window_ = t3_win_new_grid(parent == _T3_WINDOW_NULLPTR ? _T3_WINDOW_NULLPTR : parent->window_,
+                              height, width, y, x, depth);
+    if (window_ == _T3_WINDOW_NULLPTR) {
+      throw std::bad_alloc();
+    }
+  }
+
+  /** Call t3_win_new_canvas. To preserve consistency with t3_win_new->alloc, this is named
+      alloc_canvas. */
+  void alloc_canvas(int height, int width) {
+    t3_win_del(window_);
+    window_ = t3_win_new_canvas(height, width);
+    if (window_ == _T3_WINDOW_NULLPTR) {
+      throw std::bad_alloc();
+    }
+  }
+
+  /** Call t3_win_new_viewport. To preserve consistency with t3_win_new->alloc, this is named
+      alloc_viewport. */
+  void alloc_viewport(const window_t *parent, int height, int width, int y, int x, int depth,
+                      const window_t *canvas) {
+    t3_win_del(window_);
+    window_ = t3_win_new_viewport(parent == _T3_WINDOW_NULLPTR ? _T3_WINDOW_NULLPTR : parent->window_,
+                                  height, width, y, x, depth, canvas->window_);
+    if (window_ == _T3_WINDOW_NULLPTR) {
+      throw std::bad_alloc();
+    }
+  }
+
+  /** Call t3_win_new_log. To preserve consistency with t3_win_new->alloc, this is named
+      alloc_log. */
+  void alloc_log(const window_t *parent, int height, int width, int y, int x, int depth,
+                 int max_lines) {
+    t3_win_del(window_);
+    window_ = t3_win_new_log(parent == _T3_WINDOW_NULLPTR ? _T3_WINDOW_NULLPTR : parent->window_,
+                             height, width, y, x, depth, max_lines);
+    if (window_ == _T3_WINDOW_NULLPTR) {
+      throw std::bad_alloc();
+    }
+  }
+
   /** Call t3_win_new_unbacked. To preserve consistency with t3_win_new->alloc, this is named
       alloc_unbacked. */
   void alloc_unbacked(const window_t *parent, int height, int width, int y, int x, int depth) {
@@ -216,6 +327,14 @@ class T3_WINDOW_API window_t {
   }
   bool resize(int height, int width) { return t3_win_resize(window_, height, width) != t3_false; }
   void move(int y, int x) { t3_win_move(window_, y, x); }
+  void scroll(int n) { t3_win_scroll(window_, n); }
+  void get_memory_usage(t3_memory_usage_t *usage) const {
+    t3_win_get_memory_usage(window_, usage);
+  }
+  void compact() { t3_win_compact(window_); }
+  void set_viewport_offset(int y, int x) { t3_win_set_viewport_offset(window_, y, x); }
+  int get_viewport_y() const { return t3_win_get_viewport_y(window_); }
+  int get_viewport_x() const { return t3_win_get_viewport_x(window_); }
   int get_width() const { return t3_win_get_width(window_); }
   int get_height() const { return t3_win_get_height(window_); }
   int get_x() const { return t3_win_get_x(window_); }
@@ -235,6 +354,24 @@ class T3_WINDOW_API window_t {
   }
   int addstr(const char *str, t3_attr_t attr) { return t3_win_addstr(window_, str, attr); }
   int addch(char ch, t3_attr_t attr) { return t3_win_addch(window_, ch, attr); }
+  int put_cell(int y, int x, const char *str, size_t size, t3_attr_t attr) {
+    return t3_win_put_cell(window_, y, x, str, size, attr);
+  }
+  int addnstr(const char *str, size_t size, const t3_attr_ext_t *attr) {
+    return t3_win_addnstr_ext(window_, str, size, attr);
+  }
+  t3_attr_handle_t resolve_attr(t3_attr_t attr) const { return t3_win_resolve_attr(window_, attr); }
+  t3_attr_handle_t resolve_attr(const t3_attr_ext_t *attr) const {
+    return t3_win_resolve_attr_ext(window_, attr);
+  }
+  int addnstr(const char *str, size_t size, t3_attr_handle_t *handle) {
+    return t3_win_addnstr_h(window_, str, size, handle);
+  }
+  int addstr(const char *str, t3_attr_handle_t *handle) {
+    return t3_win_addstr_h(window_, str, handle);
+  }
+  int addch(char ch, t3_attr_handle_t *handle) { return t3_win_addch_h(window_, ch, handle); }
+  int add_prepared(t3_prepared_str_t *prepared) { return t3_win_add_prepared(window_, prepared); }
   int addnstrrep(const char *str, size_t size, t3_attr_t attr, int rep) {
     return t3_win_addnstrrep(window_, str, size, attr, rep);
   }
@@ -245,6 +382,30 @@ class T3_WINDOW_API window_t {
   int box(int y, int x, int height, int width, t3_attr_t attr) {
     return t3_win_box(window_, y, x, height, width, attr);
   }
+  int fill_rect(int y, int x, int height, int width, const char *str, t3_attr_t attr) {
+    return t3_win_fill_rect(window_, y, x, height, width, str, attr);
+  }
+  int hline(int y, int x, int length, t3_attr_t attr) {
+    return t3_win_hline(window_, y, x, length, attr);
+  }
+  int vline(int y, int x, int length, t3_attr_t attr) {
+    return t3_win_vline(window_, y, x, length, attr);
+  }
+  bool copy_region(int src_y, int src_x, window_t *dst, int dst_y, int dst_x, int height,
+                   int width) {
+    return t3_win_copy_region(window_, src_y, src_x, dst->window_, dst_y, dst_x, height, width) !=
+           t3_false;
+  }
+  bool set_line(int y, window_t *line) {
+    return t3_win_set_line(window_, y, line->window_) != t3_false;
+  }
+  int log_append(const char *str, size_t size, t3_attr_t attr) {
+    return t3_win_log_append(window_, str, size, attr);
+  }
+  void log_set_offset(int offset) { t3_win_log_set_offset(window_, offset); }
+  int log_get_offset() const { return t3_win_log_get_offset(window_); }
+  int log_get_lines() const { return t3_win_log_get_lines(window_); }
+  void log_clear() { t3_win_log_clear(window_); }
   void clrtoeol() { t3_win_clrtoeol(window_); }
   void clrtobot() { t3_win_clrtobot(window_); }
 
@@ -0,0 +1,809 @@
+/* Copyright (C) 2018 G.P. Halkes
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License version 3, as
+   published by the Free Software Foundation.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/** @file */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "internal.h"
+#include "window.h"
+
+/* Cell grid storage. Windows created with t3_win_new_grid store their contents as a fixed
+   size grid of cells, instead of the variable length encoded lines used for other windows.
+   This allows writing any cell in constant time. The contents are encoded as blocks (see
+   window_paint.c) only when compositing the terminal lines.
+
+   Each cell has an attribute index, up to four bytes of UTF-8 text and a flags byte. The flags
+   byte holds the width of the cell (1 or 2), or 0 for cells that have not been written. The
+   right half of a double width character is marked as a continuation cell. When the text of a
+   cell does not fit in four bytes, it is stored in the intern table of the grid, and the text
+   of the cell holds the index in that table instead.
+
+   The grid also keeps the range of used cells of each row. Like for line storage, unused cells
+   between a write and the used cells of the row are filled with spaces with the default
+   attributes of the window, so all cells in the range are used.
+*/
+
+/** @internal
+    @brief Mask for the width of a cell in the flags byte. */
+#define CELL_WIDTH_MASK 3
+/** @internal
+    @brief Flag indicating the cell is the right half of a double width character. */
+#define CELL_CONTINUATION 4
+/** @internal
+    @brief Flag indicating the text of the cell is stored in the intern table. */
+#define CELL_INTERNED 8
+
+/** @internal
+    @brief The initial size of the intern table and its hash chains. Must be a power of two. */
+#define INTERN_START_SIZE 16
+
+/** @internal
+    @brief Compute the hash value of a grapheme cluster for the intern table (FNV-1a). */
+static uint32_t hash_cluster(const char *str, size_t n) {
+  uint32_t hash = UINT32_C(0x811c9dc5);
+  for (; n > 0; n--, str++) {
+    hash = (hash ^ (unsigned char)*str) * UINT32_C(0x01000193);
+  }
+  return hash;
+}
+
+/** @internal
+    @brief Rebuild the hash chains of the intern table with a new number of chains.
+    @param grid The grid to rebuild the hash chains of.
+    @param count The new number of hash chains. Must be a power of two.
+    @return A boolean indicating success.
+*/
+static t3_bool rehash_intern(cell_grid_t *grid, int count) {
+  int *buckets;
+  int i;
+
+  if ((buckets = _t3_malloc(count * sizeof(int))) == NULL) {
+    return t3_false;
+  }
+  for (i = 0; i < count; i++) {
+    buckets[i] = -1;
+  }
+  for (i = 0; i < grid->intern_fill; i++) {
+    if (grid->intern[i].refs > 0) {
+      grid->intern[i].next = buckets[grid->intern[i].hash & (count - 1)];
+      buckets[grid->intern[i].hash & (count - 1)] = i;
+    }
+  }
+  _t3_free(grid->intern_buckets);
+  grid->intern_buckets = buckets;
+  grid->intern_bucket_count = count;
+  return t3_true;
+}
+
+/** @internal
+    @brief Add a reference to a grapheme cluster in the intern table.
+    @param grid The grid to add the cluster to.
+    @param str The UTF-8 encoded cluster.
+    @param n The size of @p str.
+    @return The index of the cluster in the intern table, or -1 if no memory could be allocated.
+*/
+static int intern_cluster(cell_grid_t *grid, const char *str, size_t n) {
+  uint32_t hash = hash_cluster(str, n);
+  grid_intern_entry_t *entry;
+  char *data;
+  int idx;
+
+  if (grid->intern_bucket_count > 0) {
+    for (idx = grid->intern_buckets[hash & (grid->intern_bucket_count - 1)]; idx >= 0;
+         idx = entry->next) {
+      entry = grid->intern + idx;
+      if (entry->hash == hash && entry->length == n && memcmp(entry->data, str, n) == 0) {
+        entry->refs++;
+        return idx;
+      }
+    }
+  }
+
+  if ((data = _t3_malloc(n)) == NULL) {
+    return -1;
+  }
+
+  if (grid->intern_free < 0 && grid->intern_fill >= grid->intern_allocated) {
+    int new_allocation =
+        grid->intern_allocated == 0 ? INTERN_START_SIZE : grid->intern_allocated * 2;
+    grid_intern_entry_t *new_intern;
+
+    if (grid->intern_allocated > INT_MAX / 2 / (int)sizeof(grid_intern_entry_t) ||
+        (new_intern = _t3_realloc(grid->intern, new_allocation * sizeof(grid_intern_entry_t))) ==
+            NULL) {
+      _t3_free(data);
+      return -1;
+    }
+    grid->intern = new_intern;
+    grid->intern_allocated = new_allocation;
+  }
+
+  /* Keep the hash chains short by having at least as many chains as entries. */
+  if (grid->intern_fill >= grid->intern_bucket_count &&
+      !rehash_intern(grid, grid->intern_bucket_count == 0 ? INTERN_START_SIZE
+                                                          : grid->intern_bucket_count * 2)) {
+    _t3_free(data);
+    return -1;
+  }
+
+  if (grid->intern_free >= 0) {
+    idx = grid->intern_free;
+    grid->intern_free = grid->intern[idx].next;
+  } else {
+    idx = grid->intern_fill++;
+  }
+
+  entry = grid->intern + idx;
+  memcpy(data, str, n);
+  entry->data = data;
+  entry->length = n;
+  entry->hash = hash;
+  entry->refs = 1;
+  entry->next = grid->intern_buckets[hash & (grid->intern_bucket_count - 1)];
+  grid->intern_buckets[hash & (grid->intern_bucket_count - 1)] = idx;
+  return idx;
+}
+
+/** @internal
+    @brief Remove a reference to a grapheme cluster in the intern table.
+    @param grid The grid containing the intern table.
+    @param idx The index of the cluster, as returned by ::intern_cluster.
+
+    When the last reference is removed, the entry is put on the free list.
+*/
+static void release_cluster(cell_grid_t *grid, int idx) {
+  grid_intern_entry_t *entry = grid->intern + idx;
+  int *ptr;
+
+  if (--entry->refs > 0) {
+    return;
+  }
+
+  for (ptr = grid->intern_buckets + (entry->hash & (grid->intern_bucket_count - 1)); *ptr != idx;
+       ptr = &grid->intern[*ptr].next) {
+  }
+  *ptr = entry->next;
+  _t3_free(entry->data);
+  entry->data = NULL;
+  entry->next = grid->intern_free;
+  grid->intern_free = idx;
+}
+
+/** @internal
+    @brief Release the interned text of a cell, if any. */
+static void release_cell_text(cell_grid_t *grid, size_t cell) {
+  if (grid->flags[cell] & CELL_INTERNED) {
+    release_cluster(grid, grid->text[cell]);
+    grid->flags[cell] &= ~CELL_INTERNED;
+  }
+}
+
+/** @internal
+    @brief Get the text of a cell.
+    @param grid The grid containing the cell.
+    @param cell The index of the cell.
+    @param n The location to store the size of the text.
+    @return A pointer to the UTF-8 encoded text of the cell.
+*/
+static const char *get_cell_text(const cell_grid_t *grid, size_t cell, size_t *n) {
+  const char *text;
+
+  if (grid->flags[cell] & CELL_INTERNED) {
+    *n = grid->intern[grid->text[cell]].length;
+    return grid->intern[grid->text[cell]].data;
+  }
+
+  text = (const char *)(grid->text + cell);
+  for (*n = 0; *n < sizeof(uint32_t) && text[*n] != 0; (*n)++) {
+  }
+  return text;
+}
+
+/** @internal
+    @brief Check whether a cell contains a single space. */
+static t3_bool is_space(const cell_grid_t *grid, size_t cell) {
+  return (grid->flags[cell] & (CELL_WIDTH_MASK | CELL_INTERNED)) == 1 &&
+         memcmp(grid->text + cell, " \0\0\0", sizeof(uint32_t)) == 0;
+}
+
+/** @internal
+    @brief Replace a cell by a single space. */
+static void set_space(cell_grid_t *grid, size_t cell, uint32_t attr) {
+  release_cell_text(grid, cell);
+  grid->attrs[cell] = attr;
+  grid->text[cell] = 0;
+  memcpy(grid->text + cell, " ", 1);
+  grid->flags[cell] = 1;
+}
+
+/** @internal
+    @brief Store a character in a cell.
+    @param grid The grid to write to.
+    @param row The index of the first cell of the row to write to.
+    @param x The column to write to.
+    @param attr The attribute index to use.
+    @param str The UTF-8 encoded character (or grapheme cluster).
+    @param n The size of @p str.
+    @param width The width of the character, which must be 1 or 2. The character must fit in the
+        row.
+    @return A boolean indicating success. On failure, the grid is not changed.
+
+    Double width characters that are partially overwritten are replaced by spaces with their
+    original attributes, matching the behavior for windows with line storage.
+*/
+static t3_bool store_cell(cell_grid_t *grid, size_t row, int x, uint32_t attr, const char *str,
+                          size_t n, int width) {
+  size_t cell = row + x, last = cell + width - 1;
+  unsigned char flags = width;
+  uint32_t text = 0;
+  int idx;
+
+  if (n > sizeof(uint32_t)) {
+    /* Intern the new text before releasing the old, as the new text may be the same. */
+    if ((idx = intern_cluster(grid, str, n)) < 0) {
+      return t3_false;
+    }
+    text = idx;
+    flags |= CELL_INTERNED;
+  } else {
+    memcpy(&text, str, n);
+  }
+
+  if (grid->flags[cell] & CELL_CONTINUATION) {
+    set_space(grid, cell - 1, grid->attrs[cell - 1]);
+  }
+  if ((grid->flags[last] & CELL_WIDTH_MASK) == 2) {
+    set_space(grid, last + 1, grid->attrs[last]);
+  }
+  release_cell_text(grid, cell);
+  release_cell_text(grid, last);
+
+  grid->attrs[cell] = attr;
+  grid->text[cell] = text;
+  grid->flags[cell] = flags;
+  if (width == 2) {
+    grid->attrs[last] = attr;
+    grid->text[last] = 0;
+    grid->flags[last] = CELL_CONTINUATION;
+  }
+  return t3_true;
+}
+
+/** @internal
+    @brief Mark a range of cells in a row as used, before writing to them.
+    @param win The window with the cell grid.
+    @param y The row containing the cells.
+    @param x The first cell of the range.
+    @param width The number of cells in the range.
+
+    Unused cells in the range, and unused cells between the range and the used cells of the row,
+    are filled with spaces with the default attributes of the window. This matches the gaps that
+    ::_win_write_blocks fills for windows with line storage.
+*/
+static void use_cells(t3_window_t *win, int y, int x, int width) {
+  cell_grid_t *grid = win->grid;
+  size_t row = (size_t)y * grid->width;
+  uint32_t default_attr;
+  int i;
+
+  if (grid->start[y] == grid->end[y]) {
+    grid->start[y] = x;
+    grid->end[y] = x;
+  } else if (x >= grid->start[y] && x + width <= grid->end[y]) {
+    return;
+  }
+
+  default_attr = _t3_map_attr(win->default_attrs);
+  for (i = x; i < grid->start[y]; i++) {
+    set_space(grid, row + i, default_attr);
+  }
+  for (i = grid->end[y]; i < x + width; i++) {
+    set_space(grid, row + i, default_attr);
+  }
+  if (x < grid->start[y]) {
+    grid->start[y] = x;
+  }
+  if (x + width > grid->end[y]) {
+    grid->end[y] = x + width;
+  }
+}
+
+/** @internal
+    @brief Allocate the cell arrays for a grid.
+    @return A boolean indicating success. On failure, no arrays are allocated.
+*/
+static t3_bool alloc_cells(int height, int width, uint32_t **attrs, uint32_t **text,
+                           unsigned char **flags) {
+  size_t cells = (size_t)height * width;
+
+  if (cells / width != (size_t)height || cells > SIZE_MAX / sizeof(uint32_t)) {
+    return t3_false;
+  }
+
+  *attrs = _t3_malloc(cells * sizeof(uint32_t));
+  *text = _t3_malloc(cells * sizeof(uint32_t));
+  *flags = _t3_calloc(cells, 1);
+  if (*attrs == NULL || *text == NULL || *flags == NULL) {
+    _t3_free(*attrs);
+    _t3_free(*text);
+    _t3_free(*flags);
+    return t3_false;
+  }
+  return t3_true;
+}
+
+/** @internal
+    @brief Allocate the arrays holding the range of used cells of each row of a grid.
+    @return A boolean indicating success. On failure, no arrays are allocated.
+*/
+static t3_bool alloc_rows(int height, int **start, int **end) {
+  *start = _t3_calloc(height, sizeof(int));
+  *end = _t3_calloc(height, sizeof(int));
+  if (*start == NULL || *end == NULL) {
+    _t3_free(*start);
+    _t3_free(*end);
+    return t3_false;
+  }
+  return t3_true;
+}
+
+/** @internal
+    @brief Create an empty cell grid.
+    @param height The number of rows.
+    @param width The number of cells in each row.
+    @return A pointer to the new grid, or @c NULL if no memory could be allocated.
+*/
+cell_grid_t *_t3_grid_new(int height, int width) {
+  cell_grid_t *grid;
+
+  if ((grid = _t3_calloc(1, sizeof(cell_grid_t))) == NULL) {
+    return NULL;
+  }
+  if (!alloc_cells(height, width, &grid->attrs, &grid->text, &grid->flags)) {
+    _t3_free(grid);
+    return NULL;
+  }
+  if (!alloc_rows(height, &grid->start, &grid->end)) {
+    _t3_free(grid->attrs);
+    _t3_free(grid->text);
+    _t3_free(grid->flags);
+    _t3_free(grid);
+    return NULL;
+  }
+  grid->width = width;
+  grid->intern_free = -1;
+  return grid;
+}
+
+/** @internal
+    @brief Free all memory used by a cell grid. */
+void _t3_grid_free(cell_grid_t *grid) {
+  int i;
+
+  if (grid == NULL) {
+    return;
+  }
+  for (i = 0; i < grid->intern_fill; i++) {
+    _t3_free(grid->intern[i].data);
+  }
+  _t3_free(grid->intern);
+  _t3_free(grid->intern_buckets);
+  _t3_free(grid->attrs);
+  _t3_free(grid->text);
+  _t3_free(grid->flags);
+  _t3_free(grid->start);
+  _t3_free(grid->end);
+  _t3_free(grid->line.data);
+  _t3_free(grid);
+}
+
+/** @internal
+    @brief Add the memory used by a cell grid to a t3_memory_usage_t. */
+void _t3_grid_memory_usage(const cell_grid_t *grid, int height, t3_memory_usage_t *usage) {
+  size_t cells = (size_t)height * grid->width, size;
+  int i;
+
+  size = sizeof(cell_grid_t) + cells * (2 * sizeof(uint32_t) + 1) + 2 * height * sizeof(int) +
+         grid->intern_bucket_count * sizeof(int);
+  usage->allocated += size + grid->intern_allocated * sizeof(grid_intern_entry_t) +
+                      grid->line.allocated;
+  usage->used += size + grid->intern_fill * sizeof(grid_intern_entry_t);
+  for (i = 0; i < grid->intern_fill; i++) {
+    if (grid->intern[i].refs > 0) {
+      usage->allocated += grid->intern[i].length;
+      usage->used += grid->intern[i].length;
+    }
+  }
+}
+
+/** @internal
+    @brief Release unused memory of a cell grid.
+
+    The buffer used for encoding rows is only needed while compositing, so it is released.
+*/
+void _t3_grid_compact(cell_grid_t *grid) {
+  _t3_free(grid->line.data);
+  grid->line.data = NULL;
+  grid->line.allocated = 0;
+  grid->line.length = 0;
+}
+
+/** @internal
+    @brief Change the size of the cell grid of a window.
+    @param win The window to resize the grid of. Its size must not have been updated yet.
+    @param height The new number of rows.
+    @param width The new number of cells in each row.
+    @return A boolean indicating success. On failure, the grid is not changed.
+
+    The contents of the cells that remain within the grid are preserved. Double width
+    characters that are cut in half by the new width are replaced by spaces, like
+    ::t3_win_clrtoeol does.
+*/
+t3_bool _t3_grid_resize(t3_window_t *win, int height, int width) {
+  cell_grid_t *grid = win->grid;
+  uint32_t *attrs, *text;
+  unsigned char *flags;
+  int *start, *end;
+  int y, x, copy_height, copy_width;
+  size_t old_row, new_row;
+
+  if (!alloc_cells(height, width, &attrs, &text, &flags)) {
+    return t3_false;
+  }
+  if (!alloc_rows(height, &start, &end)) {
+    _t3_free(attrs);
+    _t3_free(text);
+    _t3_free(flags);
+    return t3_false;
+  }
+
+  copy_height = height < win->height ? height : win->height;
+  copy_width = width < grid->width ? width : grid->width;
+
+  for (y = 0; y < win->height; y++) {
+    old_row = (size_t)y * grid->width;
+    for (x = y < height ? copy_width : 0; x < grid->width; x++) {
+      release_cell_text(grid, old_row + x);
+    }
+  }
+
+  for (y = 0; y < copy_height; y++) {
+    old_row = (size_t)y * grid->width;
+    new_row = (size_t)y * width;
+    memcpy(attrs + new_row, grid->attrs + old_row, copy_width * sizeof(uint32_t));
+    memcpy(text + new_row, grid->text + old_row, copy_width * sizeof(uint32_t));
+    memcpy(flags + new_row, grid->flags + old_row, copy_width);
+    if (grid->start[y] < width) {
+      start[y] = grid->start[y];
+      end[y] = grid->end[y] < width ? grid->end[y] : width;
+    }
+  }
+
+  _t3_free(grid->attrs);
+  _t3_free(grid->text);
+  _t3_free(grid->flags);
+  _t3_free(grid->start);
+  _t3_free(grid->end);
+  grid->attrs = attrs;
+  grid->text = text;
+  grid->flags = flags;
+  grid->start = start;
+  grid->end = end;
+  grid->width = width;
+
+  if (copy_width < width) {
+    return t3_true;
+  }
+  for (y = 0; y < copy_height; y++) {
+    new_row = (size_t)y * width;
+    if ((flags[new_row + width - 1] & CELL_WIDTH_MASK) == 2) {
+      set_space(grid, new_row + width - 1, _t3_map_attr(win->default_attrs));
+    }
+  }
+  return t3_true;
+}
+
+/** @internal
+    @brief Write one or more blocks to a window with a cell grid.
+    @param win The window to write to.
+    @param blocks The string containing the blocks.
+    @param n The number of bytes in @p blocks.
+    @return A boolean indicating success.
+
+    This is the cell grid counterpart of ::_win_write_blocks, and handles blocks that do not
+    fit in the window in the same way.
+*/
+t3_bool _t3_grid_write_blocks(t3_window_t *win, const char *blocks, size_t n) {
+  cell_grid_t *grid = win->grid;
+  uint32_t block_size, attr;
+  size_t block_size_bytes, attr_bytes, k, row;
+  int width, end;
+
+  if (win->paint_y >= win->height || win->paint_x >= win->width || n == 0) {
+    return t3_true;
+  }
+
+  row = (size_t)win->paint_y * grid->width;
+  for (k = 0; k < n; k += _T3_BLOCK_SIZE_TO_BYTES(block_size) + block_size_bytes) {
+    block_size = _t3_get_value(blocks + k, &block_size_bytes);
+    attr = _t3_get_value(blocks + k + block_size_bytes, &attr_bytes);
+    width = _T3_BLOCK_SIZE_TO_WIDTH(block_size);
+
+    if (win->paint_x + width > win->width) {
+      /* Fill the remainder of the line with spaces, with the attributes of the block. */
+      use_cells(win, win->paint_y, win->paint_x, win->width - win->paint_x);
+      for (; win->paint_x < win->width; win->paint_x++) {
+        store_cell(grid, row, win->paint_x, attr, " ", 1, 1);
+      }
+      return t3_true;
+    }
+
+    use_cells(win, win->paint_y, win->paint_x, width);
+    if (_T3_BLOCK_IS_RUN(block_size)) {
+      for (end = win->paint_x + width; win->paint_x < end; win->paint_x++) {
+        store_cell(grid, row, win->paint_x, attr, " ", 1, 1);
+      }
+      continue;
+    }
+    if (!store_cell(grid, row, win->paint_x, attr, blocks + k + block_size_bytes + attr_bytes,
+                    _T3_BLOCK_SIZE_TO_BYTES(block_size) - attr_bytes, width)) {
+      return t3_false;
+    }
+    win->paint_x += width;
+  }
+  return t3_true;
+}
+
+/** @internal
+    @brief Add a zero-width character to the cell before the paint position of a window with a
+        cell grid.
+    @param win The window to write to.
+    @param str The string containing the UTF-8 encoded zero-width character.
+    @param n The number of bytes in @p str.
+    @return A boolean indicating success.
+
+    This is the cell grid counterpart of ::_win_add_zerowidth. Characters that do not follow a
+    used cell, or that follow a double width character, are dropped.
+*/
+t3_bool _t3_grid_add_zerowidth(t3_window_t *win, const char *str, size_t n) {
+  cell_grid_t *grid = win->grid;
+  char buffer[64], *text;
+  const char *old_text;
+  size_t row, old_n;
+  int x;
+  t3_bool result;
+
+  if (win->paint_y >= win->height || win->paint_x > win->width || win->paint_x == 0) {
+    return t3_true;
+  }
+
+  row = (size_t)win->paint_y * grid->width;
+  x = win->paint_x - 1;
+  if (x < grid->start[win->paint_y] || x >= grid->end[win->paint_y]) {
+    return t3_true;
+  }
+  if (grid->flags[row + x] & CELL_CONTINUATION) {
+    x--;
+  } else if ((grid->flags[row + x] & CELL_WIDTH_MASK) != 1) {
+    return t3_true;
+  }
+
+  old_text = get_cell_text(grid, row + x, &old_n);
+  if (old_n + n > sizeof(buffer)) {
+    if ((text = _t3_malloc(old_n + n)) == NULL) {
+      return t3_false;
+    }
+  } else {
+    text = buffer;
+  }
+  memcpy(text, old_text, old_n);
+  memcpy(text + old_n, str, n);
+  result = store_cell(grid, row, x, grid->attrs[row + x], text, old_n + n,
+                      grid->flags[row + x] & CELL_WIDTH_MASK);
+  if (text != buffer) {
+    _t3_free(text);
+  }
+  return result;
+}
+
+/** @internal
+    @brief Write a single grapheme cluster to a cell of a window with a cell grid.
+    @param win The window to write to.
+    @param y The row to write to, which must be within the window.
+    @param x The column to write to, which must be within the window.
+    @param str The UTF-8 encoded cluster.
+    @param n The size of @p str.
+    @param width The width of the cluster, which must be 1 or 2.
+    @param attr_idx The attribute index to use.
+    @return A boolean indicating success.
+
+    A double width cluster in the last column is replaced by a space, like ::t3_win_addnstr
+    does.
+*/
+t3_bool _t3_grid_put_cell(t3_window_t *win, int y, int x, const char *str, size_t n, int width,
+                          int attr_idx) {
+  size_t row = (size_t)y * win->grid->width;
+
+  if (x + width > win->width) {
+    use_cells(win, y, x, 1);
+    return store_cell(win->grid, row, x, attr_idx, " ", 1, 1);
+  }
+  use_cells(win, y, x, width);
+  return store_cell(win->grid, row, x, attr_idx, str, n, width);
+}
+
+/** @internal
+    @brief Clear a row of a window with a cell grid, from a column up to the end.
+    @param win The window to clear the row of.
+    @param y The row to clear.
+    @param x The column to start clearing at.
+
+    If @p x is in the middle of a double width character, the left half is replaced by a space
+    with the default attributes of the window, like ::t3_win_clrtoeol does for windows with line
+    storage.
+*/
+void _t3_grid_clear(t3_window_t *win, int y, int x) {
+  cell_grid_t *grid = win->grid;
+  size_t row = (size_t)y * grid->width;
+  int i, end = grid->end[y];
+
+  if (x >= end) {
+    return;
+  }
+  if (x <= grid->start[y]) {
+    x = grid->start[y];
+    grid->start[y] = 0;
+    grid->end[y] = 0;
+  } else {
+    if (grid->flags[row + x] & CELL_CONTINUATION) {
+      set_space(grid, row + x - 1, _t3_map_attr(win->default_attrs));
+    }
+    grid->end[y] = x;
+  }
+  for (i = x; i < end; i++) {
+    release_cell_text(grid, row + i);
+  }
+  memset(grid->flags + row + x, 0, end - x);
+}
+
+/** @internal
+    @brief Scroll the contents of a grid.
+    @param win The window to scroll.
+    @param n The number of rows to scroll up, or down if negative.
+
+    The rows that are scrolled out are cleared first, to release their interned text. The
+    remaining rows are then moved, and the rows that are scrolled in are left empty.
+*/
+void _t3_grid_scroll(t3_window_t *win, int n) {
+  cell_grid_t *grid = win->grid;
+  size_t width = grid->width;
+  int i, count = n < 0 ? -n : n, keep, from, to;
+
+  if (count > win->height) {
+    count = win->height;
+  }
+  keep = win->height - count;
+  /* The rows that are kept move from row from to row to. */
+  from = n > 0 ? count : 0;
+  to = n > 0 ? 0 : count;
+
+  for (i = n > 0 ? 0 : keep; i < (n > 0 ? count : win->height); i++) {
+    _t3_grid_clear(win, i, 0);
+  }
+
+  memmove(grid->attrs + to * width, grid->attrs + from * width, keep * width * sizeof(uint32_t));
+  memmove(grid->text + to * width, grid->text + from * width, keep * width * sizeof(uint32_t));
+  memmove(grid->flags + to * width, grid->flags + from * width, keep * width);
+  memmove(grid->start + to, grid->start + from, keep * sizeof(int));
+  memmove(grid->end + to, grid->end + from, keep * sizeof(int));
+
+  /* The rows that are scrolled in may still contain moved cells, which must not be released
+     again. */
+  for (i = n > 0 ? keep : 0; i < (n > 0 ? win->height : count); i++) {
+    memset(grid->flags + i * width, 0, width);
+    grid->start[i] = 0;
+    grid->end[i] = 0;
+  }
+}
+
+/** @internal
+    @brief Ensure that a line_data_t struct has at least a specified number of bytes of unused
+        space. */
+static t3_bool reserve_line(line_data_t *line, size_t n) {
+  int newsize;
+  char *resized;
+
+  if (n > INT_MAX || INT_MAX - (int)n < line->length) {
+    return t3_false;
+  }
+  if (line->allocated - line->length >= (int)n) {
+    return t3_true;
+  }
+
+  for (newsize = line->allocated == 0 ? INITIAL_ALLOC : line->allocated;
+       newsize - line->length < (int)n; newsize = newsize > INT_MAX / 2 ? INT_MAX : newsize * 2) {
+  }
+  if ((resized = _t3_realloc(line->data, newsize)) == NULL) {
+    return t3_false;
+  }
+  line->data = resized;
+  line->allocated = newsize;
+  return t3_true;
+}
+
+/** @internal
+    @brief Encode a row of a window with a cell grid as blocks, for compositing.
+    @param win The window to encode the row of.
+    @param y The row to encode.
+    @return A pointer to the encoded line, or @c NULL if no memory could be allocated. The line
+        is valid until the next call for the same window.
+
+    Neighboring cells mostly have the same attributes, so the attribute index is only encoded
+    again when it changes. Consecutive spaces with the same attributes are encoded as a single
+    run block.
+*/
+const line_data_t *_t3_grid_get_line(t3_window_t *win, int y) {
+  cell_grid_t *grid = win->grid;
+  line_data_t *line = &grid->line;
+  const unsigned char *flags = grid->flags + (size_t)y * grid->width;
+  size_t row = (size_t)y * grid->width, attr_bytes = 0, n;
+  uint32_t attr, last_attr = 0;
+  char attr_str[6];
+  const char *text;
+  int x, width, run;
+
+  line->start = grid->start[y];
+  line->width = grid->end[y] - grid->start[y];
+  line->length = 0;
+
+  for (x = grid->start[y]; x < grid->end[y]; x++) {
+    if (flags[x] & CELL_CONTINUATION) {
+      continue;
+    }
+    attr = grid->attrs[row + x];
+    text = get_cell_text(grid, row + x, &n);
+    width = flags[x] & CELL_WIDTH_MASK;
+
+    if (attr_bytes == 0 || attr != last_attr) {
+      attr_bytes = _t3_put_value(attr, attr_str);
+      last_attr = attr;
+    }
+
+    if (!reserve_line(line, 6 + attr_bytes + n)) {
+      return NULL;
+    }
+
+    if (is_space(grid, row + x)) {
+      for (run = 1; x + run < grid->end[y] && run < _T3_RUN_MAX && is_space(grid, row + x + run) &&
+                    grid->attrs[row + x + run] == attr;
+           run++) {
+      }
+      if (run > 1) {
+        line->length += _t3_put_value(_T3_RUN_HEADER(attr_bytes, run), line->data + line->length);
+        memcpy(line->data + line->length, attr_str, attr_bytes);
+        line->length += attr_bytes;
+        x += run - 1;
+        continue;
+      }
+    }
+
+    line->length += _t3_put_value(_T3_BLOCK_HEADER(attr_bytes + n, width),
+                                  line->data + line->length);
+    memcpy(line->data + line->length, attr_str, attr_bytes);
+    memcpy(line->data + line->length + attr_bytes, text, n);
+    line->length += attr_bytes + n;
+  }
+  return line;
+}
@@ -0,0 +1,385 @@
+/* Copyright (C) 2018 G.P. Halkes
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License version 3, as
+   published by the Free Software Foundation.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/** @file */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "internal.h"
+#include "window.h"
+
+/* Log storage. Windows created with t3_win_new_log show a view of a history of lines, to which
+   lines can only be added at the end. The lines are encoded as blocks (see window_paint.c) like
+   for line storage, but the data of all lines is packed in large chunks instead of each line
+   having its own allocation. The lines themselves are kept in a ring, such that both adding a
+   line and dropping the oldest line take constant time. As the data of a chunk is never moved,
+   the lines in the ring point directly into the chunks, and can be used for compositing the
+   terminal lines without any copying.
+
+   The view is described by the number of lines it is scrolled back from the end of the log.
+   While the view is scrolled back, adding lines increments this offset, such that the view
+   keeps showing the same lines.
+*/
+
+/** @internal
+    @brief The minimum size of a chunk of line data. */
+#define LOG_CHUNK_SIZE 16384
+/** @internal
+    @brief The initial number of lines allocated for the ring. */
+#define LOG_START_LINES 64
+
+log_buffer_t *_t3_log_new(int max_lines) {
+  log_buffer_t *log;
+
+  if ((log = _t3_calloc(1, sizeof(log_buffer_t))) == NULL) {
+    return NULL;
+  }
+  log->max_lines = max_lines;
+  log->allocated = max_lines < LOG_START_LINES ? max_lines : LOG_START_LINES;
+  if ((log->lines = _t3_malloc(log->allocated * sizeof(line_data_t))) == NULL) {
+    _t3_free(log);
+    return NULL;
+  }
+  if ((log->line.data = _t3_malloc(INITIAL_ALLOC)) == NULL) {
+    _t3_free(log->lines);
+    _t3_free(log);
+    return NULL;
+  }
+  log->line.allocated = INITIAL_ALLOC;
+  return log;
+}
+
+/** @internal
+    @brief Free all chunks of a log_buffer_t. */
+static void free_chunks(log_buffer_t *log) {
+  log_chunk_t *chunk;
+
+  while (log->head != NULL) {
+    chunk = log->head;
+    log->head = chunk->next;
+    _t3_free(chunk);
+  }
+  log->tail = NULL;
+}
+
+void _t3_log_free(log_buffer_t *log) {
+  if (log == NULL) {
+    return;
+  }
+  free_chunks(log);
+  _t3_free(log->spare);
+  _t3_free(log->lines);
+  _t3_free(log->line.data);
+  _t3_free(log);
+}
+
+/** @internal
+    @brief Add the memory used by a log_buffer_t to a t3_memory_usage_t. */
+void _t3_log_memory_usage(const log_buffer_t *log, t3_memory_usage_t *usage) {
+  const log_chunk_t *chunk;
+
+  usage->allocated += sizeof(log_buffer_t) + log->allocated * sizeof(line_data_t) +
+                      log->line.allocated;
+  usage->used += sizeof(log_buffer_t) + log->count * sizeof(line_data_t);
+  for (chunk = log->head; chunk != NULL; chunk = chunk->next) {
+    usage->allocated += sizeof(log_chunk_t) + chunk->size;
+    usage->used += sizeof(log_chunk_t) + chunk->fill;
+  }
+  if (log->spare != NULL) {
+    usage->allocated += sizeof(log_chunk_t) + log->spare->size;
+  }
+}
+
+/** @internal
+    @brief Release unused memory of a log_buffer_t.
+
+    The spare chunk is released, and the buffer used for drawing new lines is shrunk to its
+    initial size. The chunks holding lines can not be shrunk, as the lines point into them.
+*/
+void _t3_log_compact(log_buffer_t *log) {
+  char *resized;
+
+  _t3_free(log->spare);
+  log->spare = NULL;
+  if (log->line.allocated > INITIAL_ALLOC &&
+      (resized = _t3_realloc(log->line.data, INITIAL_ALLOC)) != NULL) {
+    log->line.data = resized;
+    log->line.allocated = INITIAL_ALLOC;
+    log->line.length = 0;
+  }
+}
+
+/** @internal
+    @brief Add a new chunk at the end of the list of chunks of a log_buffer_t.
+    @param log The log_buffer_t to add the chunk to.
+    @param size The minimum number of bytes required in the chunk.
+    @return The new chunk, or @c NULL if no memory could be allocated.
+*/
+static log_chunk_t *add_chunk(log_buffer_t *log, size_t size) {
+  log_chunk_t *chunk;
+
+  if (size < LOG_CHUNK_SIZE) {
+    size = LOG_CHUNK_SIZE;
+  }
+
+  if (log->spare != NULL && log->spare->size >= size) {
+    chunk = log->spare;
+    log->spare = NULL;
+  } else {
+    /* The data is allocated together with the chunk. */
+    if ((chunk = _t3_malloc(sizeof(log_chunk_t) + size)) == NULL) {
+      return NULL;
+    }
+    chunk->data = (char *)(chunk + 1);
+    chunk->size = size;
+  }
+  chunk->next = NULL;
+  chunk->fill = 0;
+  chunk->lines = 0;
+
+  if (log->tail == NULL) {
+    log->head = chunk;
+  } else {
+    log->tail->next = chunk;
+  }
+  log->tail = chunk;
+  return chunk;
+}
+
+/** @internal
+    @brief Drop the oldest line from a log_buffer_t, releasing its chunk if no lines remain. */
+static void drop_oldest(log_buffer_t *log) {
+  log_chunk_t *chunk;
+
+  if (log->lines[log->first].length > 0) {
+    /* Lines are stored in order, so the oldest line with data must be in the oldest chunk. */
+    log->head->lines--;
+    while (log->head->lines == 0) {
+      if (log->head == log->tail) {
+        log->head->fill = 0;
+        break;
+      }
+      chunk = log->head;
+      log->head = chunk->next;
+      _t3_free(log->spare);
+      log->spare = chunk;
+    }
+  }
+  log->first = (log->first + 1) % log->allocated;
+  log->count--;
+}
+
+/** @internal
+    @brief Add a copy of a line at the end of a log_buffer_t.
+    @param log The log_buffer_t to add the line to.
+    @param line The line to copy.
+    @return @c t3_true if the line was added, @c t3_false if no memory could be allocated.
+
+    If the log is full, the oldest line is dropped.
+*/
+static t3_bool append_line(log_buffer_t *log, const line_data_t *line) {
+  line_data_t *dest;
+
+  if (log->count == log->allocated && log->allocated < log->max_lines) {
+    /* While the ring is not full, the oldest line is always at index 0, so the ring can simply
+       be reallocated. */
+    int allocated = log->allocated * 2 > log->max_lines ? log->max_lines : log->allocated * 2;
+    line_data_t *result;
+    if ((result = _t3_realloc(log->lines, allocated * sizeof(line_data_t))) == NULL) {
+      return t3_false;
+    }
+    log->lines = result;
+    log->allocated = allocated;
+  }
+
+  if (line->length > 0 &&
+      (log->tail == NULL || log->tail->size - log->tail->fill < (size_t)line->length) &&
+      add_chunk(log, line->length) == NULL) {
+    return t3_false;
+  }
+
+  if (log->count == log->max_lines) {
+    drop_oldest(log);
+  }
+
+  dest = log->lines + (log->first + log->count) % log->allocated;
+  dest->start = line->start;
+  dest->width = line->width;
+  dest->length = line->length;
+  dest->allocated = 0;
+  if (line->length > 0) {
+    dest->data = log->tail->data + log->tail->fill;
+    memcpy(dest->data, line->data, line->length);
+    log->tail->fill += line->length;
+    log->tail->lines++;
+  } else {
+    dest->data = NULL;
+  }
+  log->count++;
+  return t3_true;
+}
+
+/** @internal
+    @brief Limit an offset of the view of a log window to the range of lines in the log. */
+static int clamp_offset(const t3_window_t *win, int offset) {
+  if (offset > win->log->count - win->height) {
+    offset = win->log->count - win->height;
+  }
+  return offset < 0 ? 0 : offset;
+}
+
+/** @internal
+    @brief Get the index in the log of the first line in view. */
+static int view_start(const log_buffer_t *log, int height) {
+  return log->count > height + log->offset ? log->count - height - log->offset : 0;
+}
+
+/** @internal
+    @brief Get a line from the view of a log window.
+    @param win The t3_window_t to get the line from.
+    @param y The line in the window to get.
+    @return The line, which must not be modified.
+*/
+const line_data_t *_t3_log_get_line(t3_window_t *win, int y) {
+  static const line_data_t empty_line;
+  int idx = view_start(win->log, win->height) + y;
+
+  if (idx >= win->log->count) {
+    return &empty_line;
+  }
+  return win->log->lines + (win->log->first + idx) % win->log->allocated;
+}
+
+/** Add a line at the end of a log window.
+    @param win The t3_window_t to add the line to.
+    @param str The text of the line.
+    @param n The size of @p str.
+    @param attrs The attributes to use.
+    @retval ::T3_ERR_SUCCESS on succes
+    @retval ::T3_ERR_NONPRINT if a control character was encountered.
+    @retval ::T3_ERR_BAD_ARG if @p win was not created by ::t3_win_new_log.
+    @retval ::T3_ERR_OUT_OF_MEMORY if the line could not be stored.
+    @retval ::T3_ERR_ERRNO otherwise.
+
+    The line is drawn as if by ::t3_win_addnstr at the start of an empty line of the window, so
+    any text that does not fit the width of the window is discarded. If the view of the log
+    follows the end of the log, the view moves to include the new line. Otherwise the view
+    keeps showing the same lines, unless these are dropped from the log.
+*/
+int t3_win_log_append(t3_window_t *win, const char *str, size_t n, t3_attr_t attrs) {
+  log_buffer_t *log = win->log;
+  int height = win->height, paint_x = win->paint_x, paint_y = win->paint_y;
+  int start, count, offset, retval;
+
+  if (log == NULL) {
+    return T3_ERR_BAD_ARG;
+  }
+
+  /* Draw the line using the regular drawing code, by temporarily making the line buffer of the
+     log the only line of the window. */
+  log->line.length = 0;
+  log->line.width = 0;
+  log->line.start = 0;
+  win->lines = &log->line;
+  win->height = 1;
+  win->paint_x = 0;
+  win->paint_y = 0;
+  win->cached_pos_line = -1;
+  retval = t3_win_addnstr(win, str, n, attrs);
+  win->lines = NULL;
+  win->height = height;
+  win->paint_x = paint_x;
+  win->paint_y = paint_y;
+  win->cached_pos_line = -1;
+
+  if (retval != T3_ERR_SUCCESS && retval != T3_ERR_NONPRINT) {
+    return retval;
+  }
+
+  start = view_start(log, win->height);
+  count = log->count;
+  offset = t3_win_log_get_offset(win);
+  if (!append_line(log, &log->line)) {
+    return T3_ERR_OUT_OF_MEMORY;
+  }
+  log->offset = offset > 0 ? clamp_offset(win, offset + 1) : 0;
+  /* If the oldest line was dropped, the index of all lines has decreased by one. */
+  _t3_win_scroll_hint(win, view_start(log, win->height) + (log->count == count) - start);
+  return retval;
+}
+
+/** Set the number of lines the view of a log window is scrolled back from the end of the log.
+    @param win The t3_window_t to set the offset for.
+    @param offset The number of lines to scroll back from the end of the log.
+
+    The @p offset is limited to the range of lines in the log. With an offset of 0, the
+    view follows the end of the log. This function only changes the view. It does nothing for
+    windows not created by ::t3_win_new_log.
+*/
+void t3_win_log_set_offset(t3_window_t *win, int offset) {
+  int start;
+
+  if (win->log == NULL) {
+    return;
+  }
+
+  start = view_start(win->log, win->height);
+  win->log->offset = clamp_offset(win, offset);
+  _t3_win_scroll_hint(win, view_start(win->log, win->height) - start);
+}
+
+/** Get the number of lines the view of a log window is scrolled back from the end of the log.
+
+    Returns 0 for windows not created by ::t3_win_new_log.
+*/
+int t3_win_log_get_offset(const t3_window_t *win) {
+  /* The window may have been resized since the offset was set. */
+  return win->log == NULL ? 0 : clamp_offset(win, win->log->offset);
+}
+
+/** Get the number of lines in a log window.
+
+    Returns 0 for windows not created by ::t3_win_new_log.
+*/
+int t3_win_log_get_lines(const t3_window_t *win) { return win->log == NULL ? 0 : win->log->count; }
+
+/** Remove all lines from a log window.
+
+    The view is reset to follow the end of the log. Part of the memory used for storing the
+    lines is kept for storing new lines.
+*/
+void t3_win_log_clear(t3_window_t *win) {
+  log_buffer_t *log = win->log;
+  log_chunk_t *chunk;
+
+  if (log == NULL) {
+    return;
+  }
+
+  /* Keep the newest chunk as spare chunk. */
+  if (log->tail != NULL) {
+    while (log->head != log->tail) {
+      chunk = log->head;
+      log->head = chunk->next;
+      _t3_free(chunk);
+    }
+    _t3_free(log->spare);
+    log->spare = log->tail;
+    log->head = NULL;
+    log->tail = NULL;
+  }
+  log->first = 0;
+  log->count = 0;
+  log->offset = 0;
+}
@@ -15,8 +15,8 @@
 
 #include <stdlib.h>
 #include <string.h>
-#include <unictype.h>
 
+#include "generated/chardata.h"
 #include "internal.h"
 #include "log.h"
 #include "utf8.h"
@@ -27,42 +27,75 @@
 */
 #define UTF8_MAX_BYTES 4
 
-/* Attribute to index mapping. To make the mapping quick, a simple hash table
-   with hash chaining is used.
+/** @internal
+    @brief The size of the buffer used for encoding runs of characters as blocks.
 */
+#define BLOCK_BUFFER_SIZE 1024
 
-typedef struct attr_map_t attr_map_t;
-struct attr_map_t {
-  t3_attr_t attr;
-  int next;
-};
+/* Attribute to index mapping. The indices are stored in the line data, so
+   they must remain stable while windows refer to them. To make the mapping
+   quick, an open addressing hash table with linear probing is kept next to the
+   array of attribute sets. The hash table only stores indices into the array.
+*/
 
 /** @internal
     @brief The initial allocation for ::attr_map.
 */
 #define ATTR_MAP_START_SIZE 32
 /** @internal
-    @brief The size of the hash map used for ::t3_attr_t mapping.
+    @brief The initial size of ::attr_hash_map. Must be a power of two.
+*/
+#define ATTR_HASH_MAP_START_SIZE 64
+
+/** @internal
+    @brief An attribute set, including the RGB values for ::T3_ATTR_FG_RGB and ::T3_ATTR_BG_RGB.
+
+    The RGB values are zero when the corresponding color is not an RGB color, such that
+    each attribute set has a unique representation.
 */
-#define ATTR_HASH_MAP_SIZE 337
+typedef struct {
+  t3_attr_t attr;
+  uint32_t fg_rgb, bg_rgb;
+} attr_map_entry_t;
 
-static attr_map_t *attr_map; /**< @internal @brief The map of indices to attribute sets. */
-static int attr_map_fill,    /**< @internal @brief The number of elements used in ::attr_map. */
+static attr_map_entry_t *attr_map; /**< @internal @brief The map of indices to attribute sets. */
+static int attr_map_fill, /**< @internal @brief The number of elements used in ::attr_map. */
     attr_map_allocated; /**< @internal @brief The number of elements allocated in ::attr_map. */
-static int attr_hash_map[ATTR_HASH_MAP_SIZE]; /**< @internal @brief Hash map for quickly mapping
-                                                 ::t3_attr_t's to indices. */
+static int *attr_hash_map; /**< @internal @brief Open addressing hash map for quickly mapping
+                              ::t3_attr_t's to indices. Empty slots contain -1. */
+static int attr_hash_map_size; /**< @internal @brief The number of slots in ::attr_hash_map. */
+/** @internal
+    @brief Counter which is incremented whenever previously mapped attribute indices may have
+        become invalid. Used to revalidate ::t3_attr_handle_t's.
+*/
+unsigned int _t3_attr_generation;
+
+#ifdef _T3_WINDOW_DEBUG
+/** @internal
+    @brief Counters for analyzing the behavior of the attribute map.
+*/
+static struct {
+  unsigned long lookups;     /**< Number of calls to ::_t3_map_attr. */
+  unsigned long probes;      /**< Total number of slots inspected by ::_t3_map_attr. */
+  int max_probes;            /**< Longest probe sequence encountered. */
+  unsigned long inserts;     /**< Number of attribute sets added to the map. */
+  unsigned long resizes;     /**< Number of times the hash map was grown. */
+  unsigned long compactions; /**< Number of times ::t3_term_compact_attrs removed entries. */
+} attr_map_stats;
+#endif
 
 /** @addtogroup t3window_win */
 /** @{ */
 
 /** Ensure that a line_data_t struct has at least a specified number of
         bytes of unused space.
+    @param win The t3_window_t the line belongs to, or @c NULL for other lines.
     @param line The line_data_t struct to check.
     @param n The required unused space in bytes.
     @return A boolean indicating whether, after possibly reallocating, the
         requested number of bytes is available.
 */
-static t3_bool ensure_space(line_data_t *line, size_t n) {
+static t3_bool ensure_space(t3_window_t *win, line_data_t *line, size_t n) {
   int newsize;
   char *resized;
 
@@ -78,14 +111,34 @@ static t3_bool ensure_space(line_data_t *line, size_t n) {
 
   do {
     /* Sanity check for overflow of allocated variable. Prevents infinite loops. */
-    if (newsize > INT_MAX / 2) {
+    if (newsize == 0) {
+      /* Lines of windows are only allocated when they are first drawn on. */
+      newsize = INITIAL_ALLOC;
+    } else if (newsize > INT_MAX / 2) {
       newsize = INT_MAX;
     } else {
       newsize *= 2;
     }
   } while (newsize - line->length < (int)n);
 
-  if ((resized = realloc(line->data, sizeof(t3_attr_t) * newsize)) == NULL) {
+  if (win != NULL && line->allocated == 0) {
+    if ((resized = _t3_win_slab_alloc(win, newsize)) != NULL) {
+      line->data = resized;
+      line->allocated = newsize;
+      return t3_true;
+    }
+  } else if (win != NULL && _t3_win_in_slab(win, line->data)) {
+    /* Buffers in the slab can not be resized, so the line gets its own buffer. */
+    if ((resized = _t3_malloc(newsize)) == NULL) {
+      return t3_false;
+    }
+    memcpy(resized, line->data, line->length);
+    line->data = resized;
+    line->allocated = newsize;
+    return t3_true;
+  }
+
+  if ((resized = _t3_realloc(line->data, newsize)) == NULL) {
     return t3_false;
   }
   line->data = resized;
@@ -94,56 +147,173 @@ static t3_bool ensure_space(line_data_t *line, size_t n) {
 }
 
 /** @internal
-    @brief Map a set of attributes to an integer.
+    @brief Compute the hash value of a ::t3_attr_t for use in ::attr_hash_map.
+
+    Attribute sets in use typically only differ in a few (color) bits, which
+    would result in clustering if the value were used directly. Therefore the
+    bits are mixed first.
+*/
+static uint32_t hash_attr(t3_attr_t attr, uint32_t fg_rgb, uint32_t bg_rgb) {
+  uint32_t hash =
+      (uint32_t)attr ^ (fg_rgb * UINT32_C(0x9e3779b1)) ^ (bg_rgb * UINT32_C(0x85ebca6b));
+  hash ^= hash >> 16;
+  hash *= UINT32_C(0x7feb352d);
+  hash ^= hash >> 15;
+  hash *= UINT32_C(0x846ca68b);
+  hash ^= hash >> 16;
+  return hash;
+}
+
+/** @internal
+    @brief Install a new ::attr_hash_map, filled with the contents of ::attr_map.
+    @param hash_map The memory to use for the hash map.
+    @param size The number of slots in @p hash_map. Must be a power of two.
+*/
+static void install_attr_hash_map(int *hash_map, int size) {
+  uint32_t slot, mask = size - 1;
+  int i;
+
+  for (i = 0; i < size; i++) {
+    hash_map[i] = -1;
+  }
+  for (i = 0; i < attr_map_fill; i++) {
+    for (slot = hash_attr(attr_map[i].attr, attr_map[i].fg_rgb, attr_map[i].bg_rgb) & mask;
+         hash_map[slot] != -1; slot = (slot + 1) & mask) {
+    }
+    hash_map[slot] = i;
+  }
+  _t3_free(attr_hash_map);
+  attr_hash_map = hash_map;
+  attr_hash_map_size = size;
+}
+
+/** @internal
+    @brief Map a set of attributes, including RGB colors, to an integer.
     @param attr The attribute set to map.
+    @param fg_rgb The RGB value of the foreground color if it is ::T3_ATTR_FG_RGB.
+    @param bg_rgb The RGB value of the background color if it is ::T3_ATTR_BG_RGB.
 */
-int _t3_map_attr(t3_attr_t attr) {
-  int ptr;
+int _t3_map_attr_rgb(t3_attr_t attr, uint32_t fg_rgb, uint32_t bg_rgb) {
+  uint32_t slot, mask;
+  attr_map_entry_t *entry;
+#ifdef _T3_WINDOW_DEBUG
+  int probes = 1;
+  attr_map_stats.lookups++;
+#endif
 
-  for (ptr = attr_hash_map[attr % ATTR_HASH_MAP_SIZE]; ptr != -1 && attr_map[ptr].attr != attr;
-       ptr = attr_map[ptr].next) {
+  if ((attr & T3_ATTR_FG_MASK) != T3_ATTR_FG_RGB) {
+    fg_rgb = 0;
+  }
+  if ((attr & T3_ATTR_BG_MASK) != T3_ATTR_BG_RGB) {
+    bg_rgb = 0;
   }
 
-  if (ptr != -1) {
-    return ptr;
+  if (attr_hash_map != NULL) {
+    mask = attr_hash_map_size - 1;
+    for (slot = hash_attr(attr, fg_rgb, bg_rgb) & mask; attr_hash_map[slot] != -1;
+         slot = (slot + 1) & mask) {
+      entry = attr_map + attr_hash_map[slot];
+      if (entry->attr == attr && entry->fg_rgb == fg_rgb && entry->bg_rgb == bg_rgb) {
+#ifdef _T3_WINDOW_DEBUG
+        attr_map_stats.probes += probes;
+        if (probes > attr_map_stats.max_probes) attr_map_stats.max_probes = probes;
+#endif
+        return attr_hash_map[slot];
+      }
+#ifdef _T3_WINDOW_DEBUG
+      probes++;
+#endif
+    }
+#ifdef _T3_WINDOW_DEBUG
+    attr_map_stats.probes += probes;
+    if (probes > attr_map_stats.max_probes) attr_map_stats.max_probes = probes;
+#endif
   }
 
   if (attr_map_fill >= attr_map_allocated) {
     int new_allocation = attr_map_allocated == 0 ? ATTR_MAP_START_SIZE : attr_map_allocated * 2;
-    attr_map_t *new_map;
+    attr_map_entry_t *new_map;
 
-    if ((new_map = realloc(attr_map, new_allocation * sizeof(attr_map_t))) == NULL) {
+    if (attr_map_allocated > INT_MAX / 32 ||
+        (new_map = _t3_realloc(attr_map, new_allocation * sizeof(attr_map_entry_t))) == NULL) {
       return -1;
     }
     attr_map = new_map;
     attr_map_allocated = new_allocation;
   }
+
+  /* Keep the load factor of the hash map at or below 1/2, such that the probe
+     sequences remain short. */
+  if ((attr_map_fill + 1) * 2 > attr_hash_map_size) {
+    int new_size = attr_hash_map_size == 0 ? ATTR_HASH_MAP_START_SIZE : attr_hash_map_size * 2;
+    int *new_hash_map;
+
+    if ((new_hash_map = _t3_malloc(new_size * sizeof(int))) == NULL) {
+      return -1;
+    }
+    install_attr_hash_map(new_hash_map, new_size);
+#ifdef _T3_WINDOW_DEBUG
+    attr_map_stats.resizes++;
+#endif
+  }
+
+  mask = attr_hash_map_size - 1;
+  for (slot = hash_attr(attr, fg_rgb, bg_rgb) & mask; attr_hash_map[slot] != -1;
+       slot = (slot + 1) & mask) {
+  }
+  attr_hash_map[slot] = attr_map_fill;
   attr_map[attr_map_fill].attr = attr;
-  attr_map[attr_map_fill].next = attr_hash_map[attr % ATTR_HASH_MAP_SIZE];
-  attr_hash_map[attr % ATTR_HASH_MAP_SIZE] = attr_map_fill;
+  attr_map[attr_map_fill].fg_rgb = fg_rgb;
+  attr_map[attr_map_fill].bg_rgb = bg_rgb;
+#ifdef _T3_WINDOW_DEBUG
+  attr_map_stats.inserts++;
+#endif
 
   return attr_map_fill++;
 }
 
+/** @internal
+    @brief Map a set of attributes to an integer.
+    @param attr The attribute set to map.
+*/
+int _t3_map_attr(t3_attr_t attr) { return _t3_map_attr_rgb(attr, 0, 0); }
+
 /** @internal
     @brief Get the set of attributes associated with a mapped integer.
     @param idx The mapped attribute index as returned by ::_t3_map_attr.
 */
 t3_attr_t _t3_get_attr(int idx) {
-  if (idx < 0 || idx > attr_map_fill) {
+  if (idx < 0 || idx >= attr_map_fill) {
     return 0;
   }
   return attr_map[idx].attr;
 }
 
+/** @internal
+    @brief Get the set of attributes, including RGB colors, associated with a mapped integer.
+    @param idx The mapped attribute index as returned by ::_t3_map_attr_rgb.
+    @param fg_rgb The location to store the RGB value of the foreground color.
+    @param bg_rgb The location to store the RGB value of the background color.
+*/
+t3_attr_t _t3_get_attr_rgb(int idx, uint32_t *fg_rgb, uint32_t *bg_rgb) {
+  if (idx < 0 || idx >= attr_map_fill) {
+    *fg_rgb = *bg_rgb = 0;
+    return 0;
+  }
+  *fg_rgb = attr_map[idx].fg_rgb;
+  *bg_rgb = attr_map[idx].bg_rgb;
+  return attr_map[idx].attr;
+}
+
 /** @internal
     @brief Initialize data structures used for attribute set mappings.
+
+    The hash map itself is allocated on first use by ::_t3_map_attr.
 */
 void _t3_init_attr_map(void) {
-  int i;
-  for (i = 0; i < ATTR_HASH_MAP_SIZE; i++) {
-    attr_hash_map[i] = -1;
-  }
+#ifdef _T3_WINDOW_DEBUG
+  memset(&attr_map_stats, 0, sizeof(attr_map_stats));
+#endif
 }
 
 /** @internal
@@ -151,30 +321,243 @@ void _t3_init_attr_map(void) {
 */
 void _t3_free_attr_map(void) {
 #ifdef _T3_WINDOW_DEBUG
-  {
-    int ptr, chain, avg = 0, max = 0, chains = 0;
-    int chain_length = 0;
-    for (chain = 0; chain < ATTR_HASH_MAP_SIZE; chain++) {
-      for (ptr = attr_hash_map[chain], chain_length = 0; ptr != -1;
-           ptr = attr_map[ptr].next, chain_length++) {
-      }
-      if (chain_length > max) max = chain_length;
-      if (chain_length > 0) {
-        chains++;
-        avg += chain_length;
-      }
-    }
-    lprintf("max: %d, chains: %d, avg: %.2f, attrs: %d\n", max, chains, (double)avg / chains,
-            attr_map_fill);
-  }
+  lprintf(
+      "attrs: %d, hash size: %d, lookups: %lu, avg probes: %.2f, max probes: %d, inserts: %lu, "
+      "resizes: %lu, compactions: %lu\n",
+      attr_map_fill, attr_hash_map_size, attr_map_stats.lookups,
+      attr_map_stats.lookups == 0 ? 0.0
+                                  : (double)attr_map_stats.probes / attr_map_stats.lookups,
+      attr_map_stats.max_probes, attr_map_stats.inserts, attr_map_stats.resizes,
+      attr_map_stats.compactions);
 #endif
-  free(attr_map);
+  _t3_free(attr_map);
   attr_map = NULL;
   attr_map_allocated = 0;
   attr_map_fill = 0;
+  _t3_free(attr_hash_map);
+  attr_hash_map = NULL;
+  attr_hash_map_size = 0;
+  _t3_attr_generation++;
   _t3_init_attr_map();
 }
 
+/** @internal
+    @brief Add the memory used for attribute set mappings to a t3_memory_usage_t. */
+void _t3_attr_map_memory_usage(t3_memory_usage_t *usage) {
+  usage->allocated +=
+      attr_map_allocated * sizeof(attr_map_entry_t) + attr_hash_map_size * sizeof(int);
+  usage->used += attr_map_fill * sizeof(attr_map_entry_t) + attr_hash_map_size * sizeof(int);
+}
+
+/** @internal
+    @brief Shrink the memory used for attribute set mappings to the number of mapped sets.
+
+    Unlike ::t3_term_compact_attrs, this does not remove any entries, so the mapped indices
+    remain valid.
+*/
+void _t3_attr_map_compact(void) {
+  attr_map_entry_t *new_map;
+  int *new_hash_map;
+  int new_size;
+
+  if (attr_map_fill == 0) {
+    _t3_free(attr_map);
+    attr_map = NULL;
+    attr_map_allocated = 0;
+    _t3_free(attr_hash_map);
+    attr_hash_map = NULL;
+    attr_hash_map_size = 0;
+    return;
+  }
+
+  if (attr_map_allocated > attr_map_fill &&
+      (new_map = _t3_realloc(attr_map, attr_map_fill * sizeof(attr_map_entry_t))) != NULL) {
+    attr_map = new_map;
+    attr_map_allocated = attr_map_fill;
+  }
+
+  for (new_size = ATTR_HASH_MAP_START_SIZE; attr_map_fill * 2 > new_size; new_size *= 2) {
+  }
+  if (new_size < attr_hash_map_size &&
+      (new_hash_map = _t3_malloc(new_size * sizeof(int))) != NULL) {
+    install_attr_hash_map(new_hash_map, new_size);
+  }
+}
+
+/** @internal
+    @brief Mark the attribute indices used in a line, or replace them by their new values.
+    @param line The line to process.
+    @param attr_idx Array indexed by attribute index. When marking, the entries of the used
+        indices are set to 1. Otherwise this contains the new index for each used index.
+    @param remap Boolean indicating whether to replace the indices.
+
+    As the new indices are never larger than the old indices, their encoding never
+    takes more bytes. Therefore the line can be rewritten in place.
+*/
+static void process_line_attrs(line_data_t *line, int *attr_idx, t3_bool remap) {
+  uint32_t block_size, attr, new_block_size;
+  size_t block_size_bytes, attr_bytes, new_block_size_bytes, new_attr_bytes, char_bytes;
+  char new_attr_str[6];
+  int i, dest;
+
+  for (i = 0, dest = 0; i < line->length;
+       i += _T3_BLOCK_SIZE_TO_BYTES(block_size) + block_size_bytes) {
+    block_size = _t3_get_value(line->data + i, &block_size_bytes);
+    attr = _t3_get_value(line->data + i + block_size_bytes, &attr_bytes);
+    if (attr >= (uint32_t)attr_map_fill) {
+      /* Should not happen, but don't write outside the array if it does. */
+      attr = 0;
+    }
+    if (!remap) {
+      attr_idx[attr] = 1;
+      continue;
+    }
+
+    new_attr_bytes = _t3_put_value(attr_idx[attr], new_attr_str);
+    char_bytes = _T3_BLOCK_SIZE_TO_BYTES(block_size) - attr_bytes;
+    new_block_size =
+        _T3_BLOCK_IS_RUN(block_size)
+            ? _T3_RUN_HEADER(new_attr_bytes, _T3_BLOCK_SIZE_TO_WIDTH(block_size))
+            : _T3_BLOCK_HEADER(new_attr_bytes + char_bytes, _T3_BLOCK_SIZE_TO_WIDTH(block_size));
+    new_block_size_bytes = _t3_put_value(new_block_size, line->data + dest);
+    memcpy(line->data + dest + new_block_size_bytes, new_attr_str, new_attr_bytes);
+    memmove(line->data + dest + new_block_size_bytes + new_attr_bytes,
+            line->data + i + block_size_bytes + attr_bytes, char_bytes);
+    dest += new_block_size_bytes + new_attr_bytes + char_bytes;
+  }
+  if (remap) {
+    line->length = dest;
+  }
+}
+
+/** @internal
+    @brief Apply ::process_line_attrs to all lines of a window.
+*/
+static void process_window_attrs(t3_window_t *win, int *attr_idx, t3_bool remap) {
+  int i;
+
+  if (win->grid != NULL) {
+    size_t cells = (size_t)win->height * win->grid->width, j;
+    for (j = 0; j < cells; j++) {
+      if (win->grid->flags[j] == 0) {
+        continue;
+      }
+      if (win->grid->attrs[j] >= (uint32_t)attr_map_fill) {
+        /* Should not happen, but don't write outside the array if it does. */
+        win->grid->attrs[j] = 0;
+      }
+      if (remap) {
+        win->grid->attrs[j] = attr_idx[win->grid->attrs[j]];
+      } else {
+        attr_idx[win->grid->attrs[j]] = 1;
+      }
+    }
+    return;
+  }
+
+  if (win->log != NULL) {
+    /* The lines in the history point into the chunks of the log. As remapping never makes a line
+       longer, the lines can be updated in place, leaving some unused bytes in the chunks. */
+    log_buffer_t *log = win->log;
+    for (i = 0; i < log->count; i++) {
+      process_line_attrs(log->lines + (log->first + i) % log->allocated, attr_idx, remap);
+    }
+    process_line_attrs(&log->line, attr_idx, remap);
+    return;
+  }
+
+  if (win->lines == NULL) {
+    return;
+  }
+  for (i = 0; i < win->height; i++) {
+    process_line_attrs(win->lines + i, attr_idx, remap);
+  }
+  /* The cached position is a byte offset, which is no longer valid after remapping. */
+  if (remap) {
+    win->cached_pos_line = -1;
+  }
+}
+
+/** @internal
+    @brief Apply ::process_window_attrs to a list of windows and all their children.
+*/
+static void process_window_list_attrs(t3_window_t *win, int *attr_idx, t3_bool remap) {
+  for (; win != NULL; win = win->next) {
+    process_window_attrs(win, attr_idx, remap);
+    process_window_list_attrs(win->head, attr_idx, remap);
+  }
+}
+
+/** Remove attribute sets that are no longer in use from the attribute map.
+    @retval ::T3_ERR_SUCCESS on success.
+    @retval ::T3_ERR_OUT_OF_MEMORY if the temporary storage could not be allocated.
+    @ingroup t3window_term
+
+    All distinct attribute sets used for drawing are stored in a global map,
+    and the window contents refer to the entries in that map. Entries are never
+    removed while drawing, so applications which cycle through many different
+    attribute sets (e.g. for highlighting) can call this function to remove
+    the entries that are not referenced by any window anymore. The remaining
+    entries are renumbered, and the contents of all windows are updated to
+    match. The time taken is proportional to the total size of the contents
+    of all windows.
+*/
+int t3_term_compact_attrs(void) {
+  int *attr_idx, *new_hash_map;
+  int i, live, new_size;
+
+  if (attr_map_fill == 0) {
+    return T3_ERR_SUCCESS;
+  }
+
+  if ((attr_idx = _t3_calloc(attr_map_fill, sizeof(int))) == NULL) {
+    return T3_ERR_OUT_OF_MEMORY;
+  }
+
+  process_window_list_attrs(_t3_head, attr_idx, t3_false);
+  if (_t3_terminal_window != NULL) {
+    process_window_attrs(_t3_terminal_window, attr_idx, t3_false);
+  }
+
+  for (i = 0, live = 0; i < attr_map_fill; i++) {
+    live += attr_idx[i];
+  }
+  if (live == attr_map_fill) {
+    _t3_free(attr_idx);
+    return T3_ERR_SUCCESS;
+  }
+
+  for (new_size = ATTR_HASH_MAP_START_SIZE; live * 2 > new_size; new_size *= 2) {
+  }
+  /* Allocate the new hash map before making any changes, such that failure leaves
+     everything intact. */
+  if ((new_hash_map = _t3_malloc(new_size * sizeof(int))) == NULL) {
+    _t3_free(attr_idx);
+    return T3_ERR_OUT_OF_MEMORY;
+  }
+
+  for (i = 0, live = 0; i < attr_map_fill; i++) {
+    if (attr_idx[i]) {
+      attr_map[live] = attr_map[i];
+      attr_idx[i] = live++;
+    }
+  }
+
+  process_window_list_attrs(_t3_head, attr_idx, t3_true);
+  if (_t3_terminal_window != NULL) {
+    process_window_attrs(_t3_terminal_window, attr_idx, t3_true);
+  }
+  _t3_free(attr_idx);
+
+  attr_map_fill = live;
+  install_attr_hash_map(new_hash_map, new_size);
+  _t3_attr_generation++;
+#ifdef _T3_WINDOW_DEBUG
+  attr_map_stats.compactions++;
+#endif
+  return T3_ERR_SUCCESS;
+}
+
 /** Get the first UTF-8 value encoded in a string.
     @param src The UTF-8 string to parse.
     @param size The location to store the size of the character.
@@ -463,11 +846,38 @@ static size_t create_space_block(int attr, char *out) {
   result_size = _t3_put_value(attr, out + 1);
   result_size++;
   out[result_size] = ' ';
-  out[0] = result_size << 1;
+  out[0] = _T3_BLOCK_HEADER(result_size, 1);
   result_size++;
   return result_size;
 }
 
+/** Create memory blocks representing a number of spaces with specific attributes.
+    @param attr The attribute index to use.
+    @param count The number of spaces.
+    @param out The location to write the blocks to, or @c NULL to only compute the size. When
+        @p count is at most ::_T3_RUN_MAX, at most 8 bytes are written.
+    @return The number of bytes (that would be) written to @p out.
+
+    The spaces are encoded as run blocks, of at most ::_T3_RUN_MAX spaces each.
+*/
+static size_t create_space_runs(int attr, int count, char *out) {
+  char attr_str[6], header_str[6];
+  size_t attr_bytes, header_bytes, result = 0;
+  int run;
+
+  attr_bytes = _t3_put_value(attr, attr_str);
+  for (; count > 0; count -= run) {
+    run = count > _T3_RUN_MAX ? _T3_RUN_MAX : count;
+    header_bytes = _t3_put_value(_T3_RUN_HEADER(attr_bytes, run), header_str);
+    if (out != NULL) {
+      memcpy(out + result, header_str, header_bytes);
+      memcpy(out + result + header_bytes, attr_str, attr_bytes);
+    }
+    result += header_bytes + attr_bytes;
+  }
+  return result;
+}
+
 /** Get the attribute index from a block. */
 static uint32_t get_block_attr(const char *block) {
   size_t discard;
@@ -489,6 +899,9 @@ static t3_bool _win_add_zerowidth(t3_window_t *win, const char *str, size_t n) {
   char new_block_size_str[6];
   int pos_width, i;
 
+  if (win->grid != NULL) {
+    return _t3_grid_add_zerowidth(win, str, n);
+  }
   if (win->lines == NULL) {
     return t3_false;
   }
@@ -514,7 +927,7 @@ static t3_bool _win_add_zerowidth(t3_window_t *win, const char *str, size_t n) {
   }
 
   /* Ensure we have space for n characters, and possibly extend the block size header by 1. */
-  if (!ensure_space(win->lines + win->paint_y, n + 1)) {
+  if (!ensure_space(win, win->lines + win->paint_y, n + 1)) {
     return t3_false;
   }
 
@@ -527,7 +940,7 @@ static t3_bool _win_add_zerowidth(t3_window_t *win, const char *str, size_t n) {
      above. */
   block_size = 0; /* Shut up the compiler. */
   for (i = win->cached_pos; i < win->lines[win->paint_y].length;
-       i += (block_size >> 1) + block_size_bytes) {
+       i += _T3_BLOCK_SIZE_TO_BYTES(block_size) + block_size_bytes) {
     block_size = _t3_get_value(win->lines[win->paint_y].data + i, &block_size_bytes);
     pos_width += _T3_BLOCK_SIZE_TO_WIDTH(block_size);
 
@@ -537,20 +950,46 @@ static t3_bool _win_add_zerowidth(t3_window_t *win, const char *str, size_t n) {
     }
   }
 
-  /* Check whether we are being asked to add a zero-width character in the middle
-     of a double-width character. If so, ignore. */
-  if (pos_width > win->paint_x) {
+  if (_T3_BLOCK_IS_RUN(block_size)) {
+    /* Split the space before the paint position off the run, such that the character can be
+       added to it. */
+    char split_str[32];
+    size_t split_bytes, space_bytes, old_bytes;
+    uint32_t attr = get_block_attr(win->lines[win->paint_y].data + i);
+    int after = pos_width - win->paint_x, i_space;
+
+    split_bytes = create_space_runs(attr, _T3_BLOCK_SIZE_TO_WIDTH(block_size) - after - 1,
+                                    split_str);
+    space_bytes = create_space_block(attr, split_str + split_bytes);
+    i_space = i + split_bytes;
+    split_bytes += space_bytes;
+    split_bytes += create_space_runs(attr, after, split_str + split_bytes);
+    old_bytes = _T3_BLOCK_SIZE_TO_BYTES(block_size) + block_size_bytes;
+    /* Splitting never makes the line shorter. */
+    if (!ensure_space(win, win->lines + win->paint_y, n + 1 + split_bytes - old_bytes)) {
+      return t3_false;
+    }
+    memmove(win->lines[win->paint_y].data + i + split_bytes,
+            win->lines[win->paint_y].data + i + old_bytes,
+            win->lines[win->paint_y].length - i - old_bytes);
+    memcpy(win->lines[win->paint_y].data + i, split_str, split_bytes);
+    win->lines[win->paint_y].length += (int)(split_bytes - old_bytes);
+    i = i_space;
+    block_size = _t3_get_value(win->lines[win->paint_y].data + i, &block_size_bytes);
+  } else if (pos_width > win->paint_x) {
+    /* Check whether we are being asked to add a zero-width character in the middle
+       of a double-width character. If so, ignore. */
     return t3_true;
   }
 
-  new_block_size = block_size + (n << 1);
+  new_block_size = block_size + (n << 2);
   new_block_size_bytes = _t3_put_value(new_block_size, new_block_size_str);
 
   /* WARNING: from this point on, the block_size and new_block_size variables have
      a new meaning: the actual size of the block, rather than including the bit
      indicating the width of the character as well. */
-  block_size >>= 1;
-  new_block_size >>= 1;
+  block_size = _T3_BLOCK_SIZE_TO_BYTES(block_size);
+  new_block_size = _T3_BLOCK_SIZE_TO_BYTES(new_block_size);
 
   /* Move the data after the insertion point up by the size of the character
      string to insert and the difference in block size header size. */
@@ -587,6 +1026,9 @@ static t3_bool _win_write_blocks(t3_window_t *win, const char *blocks, size_t n)
   uint32_t extra_spaces_attr;
   t3_bool result = t3_true;
 
+  if (win->grid != NULL) {
+    return _t3_grid_write_blocks(win, blocks, n);
+  }
   if (win->lines == NULL) {
     return t3_false;
   }
@@ -595,7 +1037,7 @@ static t3_bool _win_write_blocks(t3_window_t *win, const char *blocks, size_t n)
     return t3_true;
   }
 
-  for (k = 0; k < n; k += (block_size >> 1) + block_size_bytes) {
+  for (k = 0; k < n; k += _T3_BLOCK_SIZE_TO_BYTES(block_size) + block_size_bytes) {
     block_size = _t3_get_value(blocks + k, &block_size_bytes);
     if (win->paint_x + width + _T3_BLOCK_SIZE_TO_WIDTH(block_size) > win->width) {
       break;
@@ -617,7 +1059,7 @@ static t3_bool _win_write_blocks(t3_window_t *win, const char *blocks, size_t n)
 
   if (win->lines[win->paint_y].length == 0) {
     /* Empty line. */
-    if (!ensure_space(win->lines + win->paint_y, n)) {
+    if (!ensure_space(win, win->lines + win->paint_y, n)) {
       return t3_false;
     }
     win->lines[win->paint_y].start = win->paint_x;
@@ -627,43 +1069,33 @@ static t3_bool _win_write_blocks(t3_window_t *win, const char *blocks, size_t n)
     win->cached_pos_line = -1;
   } else if (win->lines[win->paint_y].start + win->lines[win->paint_y].width <= win->paint_x) {
     /* Add characters after existing characters. */
-    char default_attr_str[8];
-    size_t default_attr_size;
+    int default_attr = _t3_map_attr(win->default_attrs);
     int diff = win->paint_x - (win->lines[win->paint_y].start + win->lines[win->paint_y].width);
 
-    default_attr_size = create_space_block(_t3_map_attr(win->default_attrs), default_attr_str);
-
-    if (!ensure_space(win->lines + win->paint_y, n + diff * (default_attr_size))) {
+    if (!ensure_space(win, win->lines + win->paint_y,
+                      n + create_space_runs(default_attr, diff, NULL))) {
       return t3_false;
     }
 
-    for (i = diff; i > 0; i--) {
-      memcpy(win->lines[win->paint_y].data + win->lines[win->paint_y].length, default_attr_str,
-             default_attr_size);
-      win->lines[win->paint_y].length += default_attr_size;
-    }
+    win->lines[win->paint_y].length += create_space_runs(
+        default_attr, diff, win->lines[win->paint_y].data + win->lines[win->paint_y].length);
 
     memcpy(win->lines[win->paint_y].data + win->lines[win->paint_y].length, blocks, n);
     win->lines[win->paint_y].length += n;
     win->lines[win->paint_y].width += width + diff;
   } else if (win->paint_x + width <= win->lines[win->paint_y].start) {
     /* Add characters before existing characters. */
-    char default_attr_str[8];
-    size_t default_attr_size;
+    int default_attr = _t3_map_attr(win->default_attrs);
     int diff = win->lines[win->paint_y].start - (win->paint_x + width);
+    size_t spaces_size = create_space_runs(default_attr, diff, NULL);
 
-    default_attr_size = create_space_block(_t3_map_attr(win->default_attrs), default_attr_str);
-
-    if (!ensure_space(win->lines + win->paint_y, n + diff * default_attr_size)) {
+    if (!ensure_space(win, win->lines + win->paint_y, n + spaces_size)) {
       return t3_false;
     }
-    memmove(win->lines[win->paint_y].data + n + diff * default_attr_size,
-            win->lines[win->paint_y].data, win->lines[win->paint_y].length);
+    memmove(win->lines[win->paint_y].data + n + spaces_size, win->lines[win->paint_y].data,
+            win->lines[win->paint_y].length);
     memcpy(win->lines[win->paint_y].data, blocks, n);
-    for (i = diff; i > 0; i--) {
-      memcpy(win->lines[win->paint_y].data + n, default_attr_str, default_attr_size);
-      n += default_attr_size;
-    }
+    n += create_space_runs(default_attr, diff, win->lines[win->paint_y].data + n);
     win->lines[win->paint_y].length += n;
     win->lines[win->paint_y].width += width + diff;
     win->lines[win->paint_y].start = win->paint_x;
@@ -678,6 +1110,9 @@ static t3_bool _win_write_blocks(t3_window_t *win, const char *blocks, size_t n)
     char start_space_str[8], end_space_str[8];
     size_t start_space_bytes, end_space_bytes;
 
+    /* Note that the existing character may be a run of spaces, in which case it can overlap
+       with the new string for any number of positions. */
+
     /* Locate the first character that at least partially overlaps the position
        where this string is supposed to go. Note that this loop will always be
        entered once, because win->cached_pos will always be < line length.
@@ -686,7 +1121,7 @@ static t3_bool _win_write_blocks(t3_window_t *win, const char *blocks, size_t n)
        will be handled above. */
     block_size = 0; /* Shut up the compiler. */
     for (i = win->cached_pos; i < win->lines[win->paint_y].length;
-         i += (block_size >> 1) + block_size_bytes) {
+         i += _T3_BLOCK_SIZE_TO_BYTES(block_size) + block_size_bytes) {
       block_size = _t3_get_value(win->lines[win->paint_y].data + i, &block_size_bytes);
       if (_T3_BLOCK_SIZE_TO_WIDTH(block_size) + pos_width > win->paint_x) {
         break;
@@ -711,7 +1146,7 @@ static t3_bool _win_write_blocks(t3_window_t *win, const char *blocks, size_t n)
        with spaces with the old character's attributes. */
     pos_width += _T3_BLOCK_SIZE_TO_WIDTH(block_size);
 
-    i += (block_size >> 1) + block_size_bytes;
+    i += _T3_BLOCK_SIZE_TO_BYTES(block_size) + block_size_bytes;
 
     /* If the character where we start overwriting already fully overlaps with the
        new string, then we need to only replace this and any spaces that result
@@ -720,7 +1155,8 @@ static t3_bool _win_write_blocks(t3_window_t *win, const char *blocks, size_t n)
       end_space_attr = start_space_attr;
       end_replace = i;
     } else {
-      for (; i < win->lines[win->paint_y].length; i += (block_size >> 1) + block_size_bytes) {
+      for (; i < win->lines[win->paint_y].length;
+           i += _T3_BLOCK_SIZE_TO_BYTES(block_size) + block_size_bytes) {
         block_size = _t3_get_value(win->lines[win->paint_y].data + i, &block_size_bytes);
         pos_width += _T3_BLOCK_SIZE_TO_WIDTH(block_size);
         if (pos_width >= win->paint_x + width) {
@@ -728,20 +1164,24 @@ static t3_bool _win_write_blocks(t3_window_t *win, const char *blocks, size_t n)
         }
       }
 
-      end_space_attr = get_block_attr(win->lines[win->paint_y].data + i);
-      end_replace =
-          i < win->lines[win->paint_y].length ? (int)(i + (block_size >> 1) + block_size_bytes) : i;
+      if (i < win->lines[win->paint_y].length) {
+        end_space_attr = get_block_attr(win->lines[win->paint_y].data + i);
+        end_replace = (int)(i + _T3_BLOCK_SIZE_TO_BYTES(block_size) + block_size_bytes);
+      } else {
+        /* No block overlaps the end, so there will be no end spaces either. */
+        end_space_attr = 0;
+        end_replace = i;
+      }
     }
 
     end_spaces = pos_width > win->paint_x + width ? pos_width - win->paint_x - width : 0;
 
-    start_space_bytes = create_space_block(start_space_attr, start_space_str);
-    end_space_bytes = create_space_block(end_space_attr, end_space_str);
+    start_space_bytes = create_space_runs(start_space_attr, start_spaces, start_space_str);
+    end_space_bytes = create_space_runs(end_space_attr, end_spaces, end_space_str);
 
     /* Move the existing characters out of the way. */
-    sdiff = n + end_spaces * end_space_bytes + start_spaces * start_space_bytes -
-            (end_replace - start_replace);
-    if (sdiff > 0 && !ensure_space(win->lines + win->paint_y, sdiff)) {
+    sdiff = n + end_space_bytes + start_space_bytes - (end_replace - start_replace);
+    if (sdiff > 0 && !ensure_space(win, win->lines + win->paint_y, sdiff)) {
       return t3_false;
     }
 
@@ -749,17 +1189,12 @@ static t3_bool _win_write_blocks(t3_window_t *win, const char *blocks, size_t n)
             win->lines[win->paint_y].data + end_replace,
             win->lines[win->paint_y].length - end_replace);
 
-    for (i = start_replace; start_spaces > 0; start_spaces--) {
-      memcpy(win->lines[win->paint_y].data + i, start_space_str, start_space_bytes);
-      i += start_space_bytes;
-    }
-
+    i = start_replace;
+    memcpy(win->lines[win->paint_y].data + i, start_space_str, start_space_bytes);
+    i += start_space_bytes;
     memcpy(win->lines[win->paint_y].data + i, blocks, n);
     i += n;
-    for (; end_spaces > 0; end_spaces--) {
-      memcpy(win->lines[win->paint_y].data + i, end_space_str, end_space_bytes);
-      i += end_space_bytes;
-    }
+    memcpy(win->lines[win->paint_y].data + i, end_space_str, end_space_bytes);
 
     win->lines[win->paint_y].length += sdiff;
     if (win->lines[win->paint_y].start + win->lines[win->paint_y].width < width + win->paint_x) {
@@ -773,106 +1208,641 @@ static t3_bool _win_write_blocks(t3_window_t *win, const char *blocks, size_t n)
   }
   win->paint_x += width;
 
-  if (extra_spaces > 0) {
+  for (; extra_spaces > 0; extra_spaces -= i) {
     char extra_space_str[8];
-    size_t extra_space_bytes;
-
-    extra_space_bytes = create_space_block(extra_spaces_attr, extra_space_str);
 
-    for (i = 0; i < extra_spaces; i++) {
-      result &= _win_write_blocks(win, extra_space_str, extra_space_bytes);
-    }
+    i = extra_spaces > _T3_RUN_MAX ? _T3_RUN_MAX : extra_spaces;
+    result &= _win_write_blocks(
+        win, extra_space_str, create_space_runs(extra_spaces_attr, i, extra_space_str));
   }
 
   return result;
 }
 
-/** Add a string with explicitly specified size to a t3_window_t with specified attributes.
-    @param win The t3_window_t to add the string to.
-    @param str The string to add.
+/** @internal
+    @brief Determine the length of the run of printable ASCII characters at the start of a string.
+    @param str The string to scan.
     @param n The size of @p str.
-    @param attrs The attributes to use.
-    @retval ::T3_ERR_SUCCESS on succes
-    @retval ::T3_ERR_NONPRINT if a control character was encountered.
-    @retval ::T3_ERR_ERRNO otherwise.
-
-    The default attributes are combined with the specified attributes, with
-    @p attr used as the priority attributes. All other t3_win_add* functions are
-    (indirectly) implemented using this function.
+    @return The number of bytes at the start of @p str in the range 0x20-0x7e.
 
-    It is important that combining characters are provided in the same string as the
-    characters they are to combine with. In particular, this function does not check for
-    conjoining Jamo in the existing window data and explicitly prevents joining.
+    The string is checked eight bytes at a time, using plain integer arithmetic on 64-bit
+    chunks. Only the final partial chunk, or the chunk containing the end of the run, is
+    checked byte by byte.
 */
-int t3_win_addnstr(t3_window_t *win, const char *str, size_t n, t3_attr_t attrs) {
-  size_t bytes_read;
-  char block[1 + 6 + UTF8_MAX_BYTES];
-  uint32_t c;
-  int retval = T3_ERR_SUCCESS;
-  int width;
-  int attrs_idx;
-  size_t block_bytes;
-
-  attrs = _t3_term_sanitize_attrs(attrs);
-
-  attrs = t3_term_combine_attrs(attrs, win->default_attrs);
-  /* From this point on, there is no need to keep information about explicit setting of attributes,
-     as there will be no more combining. Thus we scrub that information to keep the number of
-     mapped attributes to a minimum. */
-  attrs &= ~T3_ATTR_SET_MASK;
-  attrs_idx = _t3_map_attr(attrs);
-  if (attrs_idx < 0) {
-    return T3_ERR_OUT_OF_MEMORY;
+size_t _t3_printable_ascii_run(const char *str, size_t n) {
+  size_t i;
+  uint64_t chunk;
+
+  for (i = 0; i + 8 <= n; i += 8) {
+    memcpy(&chunk, str + i, 8);
+    /* A byte is outside the range 0x20-0x7e if its high bit is set, or if subtracting 0x20 or
+       adding 0x01 sets its high bit. Borrows and carries only propagate out of bytes that are
+       themselves outside the range, so there are no false positives for a chunk as a whole. */
+    if (((chunk - UINT64_C(0x2020202020202020)) | (chunk + UINT64_C(0x0101010101010101)) | chunk) &
+        UINT64_C(0x8080808080808080)) {
+      break;
+    }
   }
+  for (; i < n && (unsigned char)str[i] >= 0x20 && (unsigned char)str[i] < 0x7f; i++) {
+  }
+  return i;
+}
 
-  int width_state = 0;
-  for (; n > 0; n -= bytes_read, str += bytes_read) {
-    bytes_read = n;
-    c = t3_utf8_get(str, &bytes_read);
-
-    int old_width_state = width_state;
-    width = t3_utf8_wcwidth_ext(c, &width_state);
-    if (old_width_state != 0 && width_state == 0) {
-      /* Ending a block with a conjoining Jamo character can cause problems when the
-         succeeding cell later is overwritten with a joining character. To prevent this
-         issue, insert a zero-with non-joiner. */
-      if (width_state != 0) {
-        _win_add_zerowidth(win, "\xE2\x80\x8C", 3);
-      }
-    }
-    /* UC_CATEGORY_MASK_Cn is for unassigned/reserved code points. These are
-       not necessarily unprintable. */
-    if (width < 0 || uc_is_general_category_withtable(c, T3_UTF8_CONTROL_MASK)) {
-      retval = T3_ERR_NONPRINT;
-      continue;
-    } else if (width == 0) {
-      _win_add_zerowidth(win, str, bytes_read);
-      continue;
-    }
+/** @internal
+    @brief Buffer for encoding (part of) a string as blocks before writing it to a window.
 
-    block_bytes = _t3_put_value(attrs_idx, block + 1);
-    memcpy(block + 1 + block_bytes, str, bytes_read);
-    block_bytes += bytes_read;
-    _t3_put_value((block_bytes << 1) + (width == 2 ? 1 : 0), block);
-    block_bytes++;
+    The blocks in the buffer always fit in the window at the current paint position, such that
+    writing them in one go has the same effect as writing them one by one. A detached buffer is
+    never written to the window, and only collects the blocks for a string regardless of the
+    paint position. If they do not fit, or the string starts with a zero-width character, the
+    @c overflow member is set instead.
+*/
+typedef struct {
+  char data[BLOCK_BUFFER_SIZE]; /**< The encoded blocks. */
+  size_t fill;                  /**< The number of bytes used in @c data. */
+  size_t last;                  /**< The offset of the last block in @c data. */
+  int width;                    /**< The total width of the blocks in @c data. */
+  t3_bool detached;             /**< Whether the buffer is detached from the window. */
+  t3_bool overflow;             /**< Whether a detached buffer could not hold all blocks. */
+} block_buffer_t;
+
+/** Write the contents of a block buffer to a window.
+    @param win The window to write to.
+    @param buffer The buffer to write, which is emptied.
+    @return A boolean indicating success.
+*/
+static t3_bool flush_block_buffer(t3_window_t *win, block_buffer_t *buffer) {
+  t3_bool result;
 
-    if (!_win_write_blocks(win, block, block_bytes)) {
-      return T3_ERR_ERRNO;
-    }
+  if (buffer->fill == 0) {
+    return t3_true;
   }
-  /* Ending a block with a conjoining Jamo character can cause problems when the
-     succeeding cell later is overwritten with a joining character. To prevent this
-     issue, insert a zero-with non-joiner. */
-  if (width_state != 0) {
-    _win_add_zerowidth(win, "\xE2\x80\x8C", 3);
+  if (buffer->detached) {
+    buffer->overflow = t3_true;
+    return t3_false;
   }
-  return retval;
+  result = _win_write_blocks(win, buffer->data, buffer->fill);
+  buffer->fill = 0;
+  buffer->width = 0;
+  return result;
 }
 
-/** Add a nul-terminated string to a t3_window_t with specified attributes.
-    @param win The t3_window_t to add the string to.
-    @param str The nul-terminated string to add.
-    @param attr The attributes to use.
+/** Add a block to a block buffer.
+    @param win The window the buffer will be written to.
+    @param buffer The buffer to add to.
+    @param block The block to add.
+    @param block_bytes The number of bytes in @p block.
+    @param width The width of @p block.
+    @return A boolean indicating success.
+
+    If the block does not fit in the window, the buffer is written and the block is passed to
+    ::_win_write_blocks directly, which takes care of partially visible blocks.
+*/
+static t3_bool buffer_block(t3_window_t *win, block_buffer_t *buffer, const char *block,
+                            size_t block_bytes, int width) {
+  if (win->lines == NULL && win->grid == NULL) {
+    return t3_false;
+  }
+
+  if (!buffer->detached &&
+      (win->paint_y >= win->height || win->paint_x + buffer->width + width > win->width)) {
+    return flush_block_buffer(win, buffer) && _win_write_blocks(win, block, block_bytes);
+  }
+
+  if (buffer->fill + block_bytes > sizeof(buffer->data) && !flush_block_buffer(win, buffer)) {
+    return t3_false;
+  }
+  buffer->last = buffer->fill;
+  memcpy(buffer->data + buffer->fill, block, block_bytes);
+  buffer->fill += block_bytes;
+  buffer->width += width;
+  return t3_true;
+}
+
+/** Add a run of printable ASCII characters to a block buffer.
+    @param win The window the buffer will be written to.
+    @param buffer The buffer to add to.
+    @param str The characters to add, which must all be in the range 0x20-0x7e.
+    @param n The number of characters in @p str.
+    @param attrs_idx The mapped attributes to use.
+    @return A boolean indicating success.
+
+    All characters in the run have width 1 and are encoded using the same block layout, so
+    the blocks can be created without further inspection of the characters. Characters that
+    fall outside the window are dropped before encoding.
+*/
+static t3_bool buffer_ascii_run(t3_window_t *win, block_buffer_t *buffer, const char *str,
+                                size_t n, int attrs_idx) {
+  char attr_str[6];
+  size_t attr_bytes, block_bytes;
+  int available;
+
+  if (win->lines == NULL && win->grid == NULL) {
+    return t3_false;
+  }
+
+  if (!buffer->detached) {
+    available = win->paint_y < win->height ? win->width - win->paint_x - buffer->width : 0;
+    if (available < 0) {
+      available = 0;
+    }
+    if ((size_t)available < n) {
+      n = available;
+    }
+  }
+
+  attr_bytes = _t3_put_value(attrs_idx, attr_str);
+  block_bytes = attr_bytes + 2;
+  for (; n > 0; n--, str++) {
+    if (buffer->fill + block_bytes > sizeof(buffer->data) && !flush_block_buffer(win, buffer)) {
+      return t3_false;
+    }
+    buffer->last = buffer->fill;
+    buffer->data[buffer->fill] = _T3_BLOCK_HEADER(attr_bytes + 1, 1);
+    memcpy(buffer->data + buffer->fill + 1, attr_str, attr_bytes);
+    buffer->data[buffer->fill + 1 + attr_bytes] = *str;
+    buffer->fill += block_bytes;
+    buffer->width++;
+  }
+  return t3_true;
+}
+
+/** Add a zero-width character to the last block in a block buffer.
+    @param win The window the buffer will be written to.
+    @param buffer The buffer to add to.
+    @param str The string containing the UTF-8 encoded zero-width character.
+    @param n The number of bytes in @p str.
+    @return A boolean indicating success.
+
+    If the buffer is empty, the character is added to the window directly.
+*/
+static t3_bool buffer_zerowidth(t3_window_t *win, block_buffer_t *buffer, const char *str,
+                                size_t n) {
+  uint32_t block_size, new_block_size;
+  size_t block_size_bytes, new_block_size_bytes;
+  char new_block_size_str[6];
+
+  /* Ensure we have space for n characters, and possibly extend the block size header by 1. */
+  if (buffer->fill + n + 1 > sizeof(buffer->data) && !flush_block_buffer(win, buffer)) {
+    return t3_false;
+  }
+  if (buffer->fill == 0) {
+    if (buffer->detached) {
+      buffer->overflow = t3_true;
+      return t3_false;
+    }
+    return _win_add_zerowidth(win, str, n);
+  }
+
+  block_size = _t3_get_value(buffer->data + buffer->last, &block_size_bytes);
+  new_block_size = block_size + (n << 2);
+  new_block_size_bytes = _t3_put_value(new_block_size, new_block_size_str);
+
+  /* The last block extends up to the end of the buffer. */
+  if (new_block_size_bytes != block_size_bytes) {
+    memmove(buffer->data + buffer->last + new_block_size_bytes,
+            buffer->data + buffer->last + block_size_bytes,
+            _T3_BLOCK_SIZE_TO_BYTES(block_size));
+    buffer->fill += new_block_size_bytes - block_size_bytes;
+  }
+  memcpy(buffer->data + buffer->last, new_block_size_str, new_block_size_bytes);
+  memcpy(buffer->data + buffer->fill, str, n);
+  buffer->fill += n;
+  return t3_true;
+}
+
+/** Map attributes for drawing in a window.
+    @param win The window the attributes will be used in.
+    @param attrs The attributes to map.
+    @param fg_rgb The RGB value of the foreground color if it is ::T3_ATTR_FG_RGB.
+    @param bg_rgb The RGB value of the background color if it is ::T3_ATTR_BG_RGB.
+    @return The attribute index, or -1 if no memory could be allocated.
+*/
+static int map_win_attrs(const t3_window_t *win, t3_attr_t attrs, uint32_t fg_rgb,
+                         uint32_t bg_rgb) {
+  fg_rgb &= 0xffffff;
+  bg_rgb &= 0xffffff;
+  attrs = _t3_term_sanitize_attrs(_t3_term_resolve_rgb(attrs, fg_rgb, bg_rgb));
+
+  attrs = t3_term_combine_attrs(attrs, win->default_attrs);
+  /* From this point on, there is no need to keep information about explicit setting of attributes,
+     as there will be no more combining. Thus we scrub that information to keep the number of
+     mapped attributes to a minimum. */
+  attrs &= ~T3_ATTR_SET_MASK;
+  return _t3_map_attr_rgb(attrs, fg_rgb, bg_rgb);
+}
+
+/** @internal
+    @brief The maximum size of a grapheme cluster that is stored as a single block.
+
+    Together with the attribute index, this keeps the block size header at two bytes.
+*/
+#define MAX_CLUSTER_BYTES 56
+
+/** Add the code points of a grapheme cluster to a block buffer one at a time.
+    @param win The window the buffer will be written to.
+    @param buffer The buffer to add to.
+    @param str The UTF-8 encoded cluster.
+    @param n The size of @p str.
+    @param attrs_idx The mapped attributes to use.
+    @return See ::t3_win_addnstr.
+
+    This is used for clusters that can not be stored as a single block. Non-printable code points
+    are dropped, zero-width code points are added to the preceding block, and all other code
+    points get a block of their own.
+*/
+static int buffer_codepoints(t3_window_t *win, block_buffer_t *buffer, const char *str, size_t n,
+                             int attrs_idx) {
+  size_t bytes_read;
+  char block[1 + 6 + UTF8_MAX_BYTES];
+  uint32_t c;
+  unsigned chardata;
+  int retval = T3_ERR_SUCCESS;
+  int width;
+  size_t block_bytes;
+  int width_state = 0;
+
+  for (; n > 0; n -= bytes_read, str += bytes_read) {
+    bytes_read = n;
+    c = t3_utf8_get(str, &bytes_read);
+
+    chardata = get_chardata(c);
+    width = _t3_utf8_wcwidth_data(c, chardata, &width_state);
+    /* Unassigned/reserved code points are not necessarily unprintable, so only the
+       control categories are rejected. The ZWJ is kept for joining emoji. */
+    if (width < 0 || ((chardata & T3_CHARDATA_CONTROL) &&
+                      T3_CHARDATA_GRAPHEME_BREAK(chardata) != T3_GCB_ZWJ)) {
+      retval = T3_ERR_NONPRINT;
+      continue;
+    } else if (width == 0) {
+      buffer_zerowidth(win, buffer, str, bytes_read);
+      continue;
+    }
+
+    block_bytes = _t3_put_value(attrs_idx, block + 1);
+    memcpy(block + 1 + block_bytes, str, bytes_read);
+    block_bytes += bytes_read;
+    _t3_put_value(_T3_BLOCK_HEADER(block_bytes, width), block);
+    block_bytes++;
+
+    if (!buffer_block(win, buffer, block, block_bytes, width)) {
+      return T3_ERR_ERRNO;
+    }
+  }
+  return retval;
+}
+
+/** Check whether a grapheme cluster ends in a conjoining Jamo sequence that can be continued.
+    @param str The UTF-8 encoded cluster.
+    @param n The size of @p str.
+    @return A boolean indicating whether a following conjoining Jamo character would join the
+        cluster.
+*/
+static t3_bool ends_conjoining_jamo(const char *str, size_t n) {
+  size_t bytes_read;
+  int width_state = 0;
+
+  /* Clusters with conjoining Jamo start with a code point in the range U+1100-U+11FF or
+     U+AC00-U+D7A3. */
+  if ((unsigned char)str[0] != 0xE1 &&
+      ((unsigned char)str[0] < 0xEA || (unsigned char)str[0] > 0xED)) {
+    return t3_false;
+  }
+  for (; n > 0; n -= bytes_read, str += bytes_read) {
+    bytes_read = n;
+    t3_utf8_wcwidth_ext(t3_utf8_get(str, &bytes_read), &width_state);
+  }
+  return width_state != 0;
+}
+
+/** Encode a string as blocks in a block buffer.
+    @param win The t3_window_t the blocks will be written to.
+    @param buffer The buffer to add the blocks to.
+    @param str The string to encode.
+    @param n The size of @p str.
+    @param attrs_idx The mapped attributes to use.
+    @return See ::t3_win_addnstr.
+
+    The string is split in grapheme clusters, each of which is stored as a single block.
+*/
+static int encode_string(t3_window_t *win, block_buffer_t *buffer, const char *str, size_t n,
+                         int attrs_idx) {
+  size_t bytes_read;
+  char block[2 + 6 + MAX_CLUSTER_BYTES], header[6];
+  const char *last_cluster = NULL;
+  size_t last_cluster_bytes = 0;
+  int retval = T3_ERR_SUCCESS, result;
+  int width;
+  t3_bool split;
+  cluster_lookahead_t lookahead;
+  size_t block_bytes, header_bytes;
+
+  lookahead.bytes = 0;
+
+  for (; n > 0; n -= bytes_read, str += bytes_read) {
+    /* Printable ASCII characters make up the bulk of most text, and do not require any of
+       the processing below. Handle runs of them in one go. The last character of the run is
+       left for the cluster handling if it may be combined with the following characters. */
+    bytes_read = _t3_printable_ascii_run(str, n);
+    if (bytes_read > 0 && bytes_read < n && (unsigned char)str[bytes_read] >= 0x80 &&
+        _t3_utf8_extends_ascii(str + bytes_read, n - bytes_read, &lookahead)) {
+      bytes_read--;
+      lookahead.bytes = 0;
+    }
+    if (bytes_read > 0) {
+      if (!buffer_ascii_run(win, buffer, str, bytes_read, attrs_idx)) {
+        return T3_ERR_ERRNO;
+      }
+      last_cluster = NULL;
+      continue;
+    }
+
+    bytes_read = _t3_utf8_get_cluster(str, n, &width, &split, &lookahead, t3_true);
+    last_cluster = str;
+    last_cluster_bytes = bytes_read;
+    if (split || bytes_read > MAX_CLUSTER_BYTES) {
+      if ((result = buffer_codepoints(win, buffer, str, bytes_read, attrs_idx)) ==
+          T3_ERR_ERRNO) {
+        return T3_ERR_ERRNO;
+      } else if (result != T3_ERR_SUCCESS) {
+        retval = result;
+      }
+      continue;
+    }
+
+    /* The block is built after the space for a two byte header. */
+    block_bytes = _t3_put_value(attrs_idx, block + 2);
+    memcpy(block + 2 + block_bytes, str, bytes_read);
+    block_bytes += bytes_read;
+    header_bytes = _t3_put_value(_T3_BLOCK_HEADER(block_bytes, width), header);
+    memcpy(block + 2 - header_bytes, header, header_bytes);
+
+    if (!buffer_block(win, buffer, block + 2 - header_bytes, block_bytes + header_bytes,
+                      width)) {
+      return T3_ERR_ERRNO;
+    }
+  }
+  /* Ending a block with a conjoining Jamo character can cause problems when the
+     succeeding cell later is overwritten with a joining character. To prevent this
+     issue, insert a zero-with non-joiner. */
+  if (last_cluster != NULL && ends_conjoining_jamo(last_cluster, last_cluster_bytes)) {
+    buffer_zerowidth(win, buffer, "\xE2\x80\x8C", 3);
+  }
+  return retval;
+}
+
+/** Add a string to a window, using already mapped attributes.
+    @param win The t3_window_t to add the string to.
+    @param str The string to add.
+    @param n The size of @p str.
+    @param attrs_idx The mapped attributes to use.
+    @return See ::t3_win_addnstr.
+*/
+static int win_addnstr_idx(t3_window_t *win, const char *str, size_t n, int attrs_idx) {
+  int retval;
+  /* The string is encoded into a buffer first, such that it can be written to the window
+     using a single call to _win_write_blocks, rather than one call per character. */
+  block_buffer_t buffer;
+
+  buffer.fill = 0;
+  buffer.width = 0;
+  buffer.detached = t3_false;
+  buffer.overflow = t3_false;
+
+  retval = encode_string(win, &buffer, str, n, attrs_idx);
+  if (retval == T3_ERR_ERRNO || !flush_block_buffer(win, &buffer)) {
+    return T3_ERR_ERRNO;
+  }
+  return retval;
+}
+
+/** Add a string with explicitly specified size to a t3_window_t with specified attributes.
+    @param win The t3_window_t to add the string to.
+    @param str The string to add.
+    @param n The size of @p str.
+    @param attrs The attributes to use.
+    @retval ::T3_ERR_SUCCESS on succes
+    @retval ::T3_ERR_NONPRINT if a control character was encountered.
+    @retval ::T3_ERR_ERRNO otherwise.
+
+    The default attributes are combined with the specified attributes, with
+    @p attr used as the priority attributes. All other t3_win_add* functions are
+    (indirectly) implemented using this function.
+
+    It is important that combining characters are provided in the same string as the
+    characters they are to combine with. In particular, this function does not check for
+    conjoining Jamo in the existing window data and explicitly prevents joining.
+*/
+int t3_win_addnstr(t3_window_t *win, const char *str, size_t n, t3_attr_t attrs) {
+  int attrs_idx = map_win_attrs(win, attrs, 0, 0);
+
+  if (attrs_idx < 0) {
+    return T3_ERR_OUT_OF_MEMORY;
+  }
+  return win_addnstr_idx(win, str, n, attrs_idx);
+}
+
+/** Add a string with explicitly specified size to a t3_window_t with attributes possibly
+    including RGB colors.
+    @param win The t3_window_t to add the string to.
+    @param str The string to add.
+    @param n The size of @p str.
+    @param attrs The attributes to use.
+    @return See ::t3_win_addnstr.
+
+    If the foreground color in @p attrs is ::T3_ATTR_FG_RGB, @c attrs->fg_rgb specifies the
+    color to use, and similarly for the background color. If the terminal does not support
+    direct RGB colors, the nearest color available on the terminal is used instead. See
+    ::t3_win_addnstr for further information.
+*/
+int t3_win_addnstr_ext(t3_window_t *win, const char *str, size_t n, const t3_attr_ext_t *attrs) {
+  int attrs_idx = map_win_attrs(win, attrs->attr, attrs->fg_rgb, attrs->bg_rgb);
+
+  if (attrs_idx < 0) {
+    return T3_ERR_OUT_OF_MEMORY;
+  }
+  return win_addnstr_idx(win, str, n, attrs_idx);
+}
+
+/** Write a single grapheme cluster to a cell of a t3_window_t.
+    @param win The t3_window_t to write to.
+    @param y The line to write to.
+    @param x The column to write to.
+    @param str The grapheme cluster to write.
+    @param n The size of @p str.
+    @param attrs The attributes to use.
+    @retval ::T3_ERR_SUCCESS on succes
+    @retval ::T3_ERR_BAD_ARG if @p str is not a single grapheme cluster.
+    @retval ::T3_ERR_NONPRINT if @p str can not be drawn as a single character cell, for
+        example because it contains a control character.
+    @retval ::T3_ERR_OUT_OF_MEMORY if no memory could be allocated to map the attributes.
+    @retval ::T3_ERR_ERRNO otherwise.
+
+    Unlike the t3_win_add* functions, this function does not use or update the paint
+    position. For windows created with ::t3_win_new_grid this takes constant time. For
+    other windows, the line has to be scanned up to column @p x. Writing outside the
+    window is silently ignored. See ::t3_win_addnstr for further information.
+*/
+int t3_win_put_cell(t3_window_t *win, int y, int x, const char *str, size_t n, t3_attr_t attrs) {
+  cluster_lookahead_t lookahead;
+  int attrs_idx, width, paint_x, paint_y, result;
+  t3_bool split;
+
+  if (n == 0) {
+    return T3_ERR_BAD_ARG;
+  }
+  lookahead.bytes = 0;
+  if (_t3_utf8_get_cluster(str, n, &width, &split, &lookahead, t3_true) != n) {
+    return T3_ERR_BAD_ARG;
+  }
+  if (split) {
+    return T3_ERR_NONPRINT;
+  }
+
+  if (y < 0 || y >= win->height || x < 0 || x >= win->width) {
+    return T3_ERR_SUCCESS;
+  }
+
+  if ((attrs_idx = map_win_attrs(win, attrs, 0, 0)) < 0) {
+    return T3_ERR_OUT_OF_MEMORY;
+  }
+
+  if (win->grid != NULL) {
+    char buffer[64], *text = NULL;
+
+    /* Like t3_win_addnstr, follow a conjoining Jamo sequence with a zero-width non-joiner. */
+    if (ends_conjoining_jamo(str, n)) {
+      if (n + 3 > sizeof(buffer)) {
+        if ((text = _t3_malloc(n + 3)) == NULL) {
+          return T3_ERR_ERRNO;
+        }
+      } else {
+        text = buffer;
+      }
+      memcpy(text, str, n);
+      memcpy(text + n, "\xE2\x80\x8C", 3);
+      str = text;
+      n += 3;
+    }
+    result = _t3_grid_put_cell(win, y, x, str, n, width, attrs_idx) ? T3_ERR_SUCCESS : T3_ERR_ERRNO;
+    if (text != buffer) {
+      _t3_free(text);
+    }
+    return result;
+  }
+
+  paint_x = win->paint_x;
+  paint_y = win->paint_y;
+  t3_win_set_paint(win, y, x);
+  result = win_addnstr_idx(win, str, n, attrs_idx);
+  win->paint_x = paint_x;
+  win->paint_y = paint_y;
+  return result;
+}
+
+/** Resolve attributes for repeated drawing in a t3_window_t.
+    @param win The t3_window_t the attributes will be used with.
+    @param attrs The attributes to resolve.
+    @return A handle for use with the t3_win_add*_h functions.
+
+    Drawing with ::t3_win_addnstr requires combining the attributes with the default
+    attributes of the window, and looking up the result in the global attribute map.
+    When drawing the same attributes many times, this work can be done once using this
+    function. The handle is revalidated automatically when it is used with a window
+    with different default attributes, or when the attribute map has been compacted or
+    reinitialized. If no memory could be allocated to map the attributes, the next use
+    of the handle will retry.
+*/
+t3_attr_handle_t t3_win_resolve_attr(const t3_window_t *win, t3_attr_t attrs) {
+  t3_attr_ext_t attrs_ext;
+
+  attrs_ext.attr = attrs;
+  attrs_ext.fg_rgb = 0;
+  attrs_ext.bg_rgb = 0;
+  return t3_win_resolve_attr_ext(win, &attrs_ext);
+}
+
+/** Resolve attributes, possibly including RGB colors, for repeated drawing in a t3_window_t.
+    @param win The t3_window_t the attributes will be used with.
+    @param attrs The attributes to resolve.
+    @return A handle for use with the t3_win_add*_h functions.
+
+    See ::t3_win_resolve_attr and ::t3_win_addnstr_ext for further information.
+*/
+t3_attr_handle_t t3_win_resolve_attr_ext(const t3_window_t *win, const t3_attr_ext_t *attrs) {
+  t3_attr_handle_t handle;
+
+  handle.attrs = attrs->attr;
+  handle.fg_rgb = attrs->fg_rgb;
+  handle.bg_rgb = attrs->bg_rgb;
+  handle.default_attrs = win->default_attrs;
+  handle.idx = map_win_attrs(win, attrs->attr, attrs->fg_rgb, attrs->bg_rgb);
+  handle.generation = _t3_attr_generation;
+  return handle;
+}
+
+/** Get the attribute index for a handle, revalidating the handle if necessary.
+    @param win The window the handle is used with.
+    @param handle The handle to validate.
+    @return The attribute index, or -1 if no memory could be allocated.
+*/
+static int get_handle_idx(const t3_window_t *win, t3_attr_handle_t *handle) {
+  if (handle->idx < 0 || handle->generation != _t3_attr_generation ||
+      handle->default_attrs != win->default_attrs) {
+    handle->default_attrs = win->default_attrs;
+    handle->idx = map_win_attrs(win, handle->attrs, handle->fg_rgb, handle->bg_rgb);
+    handle->generation = _t3_attr_generation;
+  }
+  return handle->idx;
+}
+
+/** Add a string with explicitly specified size to a t3_window_t with resolved attributes.
+    @param win The t3_window_t to add the string to.
+    @param str The string to add.
+    @param n The size of @p str.
+    @param handle The attribute handle, as returned by ::t3_win_resolve_attr.
+    @return See ::t3_win_addnstr.
+
+    The @p handle is updated if it needs to be revalidated for @p win. See
+    ::t3_win_addnstr for further information.
+*/
+int t3_win_addnstr_h(t3_window_t *win, const char *str, size_t n, t3_attr_handle_t *handle) {
+  int attrs_idx = get_handle_idx(win, handle);
+
+  if (attrs_idx < 0) {
+    return T3_ERR_OUT_OF_MEMORY;
+  }
+  return win_addnstr_idx(win, str, n, attrs_idx);
+}
+
+/** Add a nul-terminated string to a t3_window_t with resolved attributes.
+    @param win The t3_window_t to add the string to.
+    @param str The nul-terminated string to add.
+    @param handle The attribute handle, as returned by ::t3_win_resolve_attr.
+    @return See ::t3_win_addnstr.
+
+    See ::t3_win_addnstr_h for further information.
+*/
+int t3_win_addstr_h(t3_window_t *win, const char *str, t3_attr_handle_t *handle) {
+  return t3_win_addnstr_h(win, str, strlen(str), handle);
+}
+
+/** Add a single character to a t3_window_t with resolved attributes.
+    @param win The t3_window_t to add the string to.
+    @param c The character to add.
+    @param handle The attribute handle, as returned by ::t3_win_resolve_attr.
+    @return See ::t3_win_addnstr.
+
+    @p c must be an ASCII character. See ::t3_win_addnstr_h for further information.
+*/
+int t3_win_addch_h(t3_window_t *win, char c, t3_attr_handle_t *handle) {
+  return t3_win_addnstr_h(win, &c, 1, handle);
+}
+
+/** Add a nul-terminated string to a t3_window_t with specified attributes.
+    @param win The t3_window_t to add the string to.
+    @param str The nul-terminated string to add.
+    @param attr The attributes to use.
     @return See ::t3_win_addnstr.
 
         See ::t3_win_addnstr for further information.
@@ -893,6 +1863,85 @@ int t3_win_addch(t3_window_t *win, char c, t3_attr_t attr) {
   return t3_win_addnstr(win, &c, 1, attr);
 }
 
+/** Write spaces to a window as run blocks.
+    @param win The window to write to.
+    @param attrs_idx The mapped attributes to use.
+    @param count The number of spaces to write.
+    @return A boolean indicating success.
+*/
+static t3_bool write_space_runs(t3_window_t *win, int attrs_idx, int count) {
+  char space_str[8];
+  int run;
+  t3_bool result = t3_true;
+
+  for (; count > 0 && win->paint_y < win->height && win->paint_x < win->width; count -= run) {
+    run = count > _T3_RUN_MAX ? _T3_RUN_MAX : count;
+    result &= _win_write_blocks(win, space_str, create_space_runs(attrs_idx, run, space_str));
+  }
+  return result;
+}
+
+/** Encode a string once, for drawing it repeatedly.
+    @param win The window the string will be drawn in.
+    @param str The string to encode.
+    @param n The size of @p str.
+    @param attrs_idx The mapped attributes to use.
+    @param unit The detached buffer to store the blocks in.
+    @return See ::t3_win_addnstr, or ::T3_ERR_BAD_ARG if @p str can not be drawn on its own.
+
+    Strings that have no width, start with a zero-width character, or do not fit in a
+    block buffer can not be repeated by copying the blocks.
+*/
+static int encode_repeat_unit(t3_window_t *win, const char *str, size_t n, int attrs_idx,
+                              block_buffer_t *unit) {
+  int result;
+
+  unit->fill = 0;
+  unit->width = 0;
+  unit->detached = t3_true;
+  unit->overflow = t3_false;
+
+  result = encode_string(win, unit, str, n, attrs_idx);
+  if (unit->overflow || (result != T3_ERR_ERRNO && unit->width == 0)) {
+    return T3_ERR_BAD_ARG;
+  }
+  return result;
+}
+
+/** Write an encoded string repeatedly at the paint position.
+    @param win The window to write to.
+    @param unit The encoded string, as created by ::encode_repeat_unit.
+    @param rep The number of times to write @p unit.
+    @return A boolean indicating success.
+
+    The copies are created by doubling the number of copies in a buffer, and are written in as
+    few calls to ::_win_write_blocks as the buffer size allows. Copies that fall outside the
+    window are not written at all.
+*/
+static t3_bool write_repeated_blocks(t3_window_t *win, const block_buffer_t *unit, int rep) {
+  char blocks[BLOCK_BUFFER_SIZE];
+  size_t fill = unit->fill;
+  int count = 1;
+
+  memcpy(blocks, unit->data, fill);
+  while (count < rep && fill * 2 <= sizeof(blocks)) {
+    memcpy(blocks + fill, blocks, fill);
+    fill *= 2;
+    count *= 2;
+  }
+
+  for (; rep > 0 && win->paint_y < win->height && win->paint_x < win->width; rep -= count) {
+    if (count > rep) {
+      count = rep;
+      fill = count * unit->fill;
+    }
+    if (!_win_write_blocks(win, blocks, fill)) {
+      return t3_false;
+    }
+  }
+  return t3_true;
+}
+
 /** Add a string with explicitly specified size to a t3_window_t with specified attributes and
    repetition.
     @param win The t3_window_t to add the string to.
@@ -906,15 +1955,36 @@ int t3_win_addch(t3_window_t *win, char c, t3_attr_t attr) {
     function. See ::t3_win_addnstr for further information.
 */
 int t3_win_addnstrrep(t3_window_t *win, const char *str, size_t n, t3_attr_t attr, int rep) {
-  int i, ret;
+  block_buffer_t unit;
+  int i, attrs_idx, result;
+
+  if (rep <= 0) {
+    return T3_ERR_SUCCESS;
+  }
+  if ((attrs_idx = map_win_attrs(win, attr, 0, 0)) < 0) {
+    return T3_ERR_OUT_OF_MEMORY;
+  }
+
+  if (n == 1 && str[0] == ' ') {
+    return write_space_runs(win, attrs_idx, rep) ? T3_ERR_SUCCESS : T3_ERR_ERRNO;
+  }
+
+  /* The string is encoded only once, and the blocks are copied. Strings that can not be drawn
+     that way, and strings containing non-printable characters, are drawn one at a time. The
+     latter stop at the first copy, to report the error. */
+  result = encode_repeat_unit(win, str, n, attrs_idx, &unit);
+  if (result == T3_ERR_SUCCESS) {
+    return write_repeated_blocks(win, &unit, rep) ? T3_ERR_SUCCESS : T3_ERR_ERRNO;
+  } else if (result == T3_ERR_ERRNO) {
+    return result;
+  }
 
   for (i = 0; i < rep; i++) {
-    ret = t3_win_addnstr(win, str, n, attr);
-    if (ret != 0) {
-      return ret;
+    if ((result = win_addnstr_idx(win, str, n, attrs_idx)) != T3_ERR_SUCCESS) {
+      return result;
     }
   }
-  return 0;
+  return T3_ERR_SUCCESS;
 }
 
 /** Add a nul-terminated string to a t3_window_t with specified attributes and repetition.
@@ -943,6 +2013,156 @@ int t3_win_addchrep(t3_window_t *win, char c, t3_attr_t attr, int rep) {
   return t3_win_addnstrrep(win, &c, 1, attr, rep);
 }
 
+/** @internal
+    @brief A string prepared for repeated drawing, as created by ::t3_prepare_str. */
+struct t3_prepared_str_t {
+  const char *str;          /**< The string, stored after the struct. */
+  size_t n;                 /**< The size of @c str. */
+  t3_attr_t attrs;          /**< The attributes to draw the string with. */
+  int width;                /**< The width of the string in character cells. */
+  t3_bool valid;            /**< Whether @c blocks matches @c default_attrs and @c generation. */
+  t3_attr_t default_attrs;  /**< The default attributes the blocks were encoded for. */
+  unsigned int generation;  /**< The value of ::_t3_attr_generation when encoding the blocks. */
+  int result;               /**< The result of encoding, or ::T3_ERR_BAD_ARG if the string can not
+                                 be stored as blocks and is drawn using ::t3_win_addnstr. */
+  char *blocks;             /**< The encoded blocks. */
+  size_t fill;              /**< The number of bytes used in @c blocks. */
+  size_t allocated;         /**< The number of bytes allocated for @c blocks. */
+};
+
+/** Encode the blocks of a prepared string, for drawing in a window with given default attributes.
+    @param prepared The prepared string to encode.
+    @param default_attrs The default attributes of the window the blocks will be written to.
+    @return ::T3_ERR_SUCCESS, or an error code if no memory could be allocated.
+
+    The blocks are encoded as by ::t3_win_addnstrrep, which does not depend on the paint position
+    of the window. Therefore, a window which only provides the default attributes is used.
+*/
+static int encode_prepared(t3_prepared_str_t *prepared, t3_attr_t default_attrs) {
+  block_buffer_t unit;
+  t3_window_t win;
+  line_data_t line;
+  char *blocks;
+  int attrs_idx, result;
+
+  memset(&win, 0, sizeof(win));
+  memset(&line, 0, sizeof(line));
+  win.lines = &line;
+  win.height = 1;
+  win.default_attrs = default_attrs;
+
+  prepared->valid = t3_false;
+  if ((attrs_idx = map_win_attrs(&win, prepared->attrs, 0, 0)) < 0) {
+    return T3_ERR_OUT_OF_MEMORY;
+  }
+  result = encode_repeat_unit(&win, prepared->str, prepared->n, attrs_idx, &unit);
+  if (result == T3_ERR_ERRNO) {
+    return result;
+  } else if (result != T3_ERR_BAD_ARG) {
+    if (unit.fill > prepared->allocated) {
+      if ((blocks = _t3_realloc(prepared->blocks, unit.fill)) == NULL) {
+        return T3_ERR_OUT_OF_MEMORY;
+      }
+      prepared->blocks = blocks;
+      prepared->allocated = unit.fill;
+    }
+    memcpy(prepared->blocks, unit.data, unit.fill);
+    prepared->fill = unit.fill;
+    prepared->width = unit.width;
+  }
+  prepared->result = result;
+  prepared->default_attrs = default_attrs;
+  prepared->generation = _t3_attr_generation;
+  prepared->valid = t3_true;
+  return T3_ERR_SUCCESS;
+}
+
+/** Prepare a string for repeated drawing.
+    @param str The string to prepare.
+    @param n The size of @p str.
+    @param attr The attributes to draw the string with.
+    @return A pointer to the prepared string, or @c NULL if no memory could be allocated.
+
+    Strings that are drawn many times with the same attributes, like labels in status bars and
+    menus, all go through the same decoding, width calculation and encoding each time they are
+    drawn. This function does that work once, such that ::t3_win_add_prepared only needs to copy
+    the result into the window. The encoding depends on the default attributes of the window,
+    and is only redone when the string is drawn in a window with different default attributes
+    than the last time, or when the attribute map has been compacted or reinitialized.
+
+    The string is copied, so @p str need not remain valid. Strings that start with a zero-width
+    character, are too long to be copied in one go, or do not fit in the window at the paint
+    position, are drawn using ::t3_win_addnstr instead.
+    The prepared string must be freed using ::t3_prepared_str_free.
+*/
+t3_prepared_str_t *t3_prepare_str(const char *str, size_t n, t3_attr_t attr) {
+  t3_prepared_str_t *prepared;
+
+  if (n > SIZE_MAX - sizeof(t3_prepared_str_t) ||
+      (prepared = _t3_malloc(sizeof(t3_prepared_str_t) + n)) == NULL) {
+    return NULL;
+  }
+  memcpy(prepared + 1, str, n);
+  prepared->str = (const char *)(prepared + 1);
+  prepared->n = n;
+  prepared->attrs = attr;
+  prepared->blocks = NULL;
+  prepared->allocated = 0;
+
+  if (encode_prepared(prepared, 0) != T3_ERR_SUCCESS) {
+    t3_prepared_str_free(prepared);
+    return NULL;
+  }
+  if (prepared->result == T3_ERR_BAD_ARG) {
+    prepared->width = (int)t3_term_strncwidth(str, n);
+  }
+  return prepared;
+}
+
+/** Free a prepared string, as created by ::t3_prepare_str. */
+void t3_prepared_str_free(t3_prepared_str_t *prepared) {
+  if (prepared == NULL) {
+    return;
+  }
+  _t3_free(prepared->blocks);
+  _t3_free(prepared);
+}
+
+/** Get the width of a prepared string in character cells. */
+int t3_prepared_str_get_width(const t3_prepared_str_t *prepared) { return prepared->width; }
+
+/** Add a prepared string to a t3_window_t.
+    @param win The t3_window_t to add the string to.
+    @param prepared The string, as created by ::t3_prepare_str.
+    @return See ::t3_win_addnstr.
+
+    The result is the same as calling ::t3_win_addnstr with the string and attributes passed to
+    ::t3_prepare_str. See ::t3_prepare_str for further information.
+*/
+int t3_win_add_prepared(t3_window_t *win, t3_prepared_str_t *prepared) {
+  int result;
+
+  if (!prepared->valid || prepared->generation != _t3_attr_generation ||
+      prepared->default_attrs != win->default_attrs) {
+    if ((result = encode_prepared(prepared, win->default_attrs)) != T3_ERR_SUCCESS) {
+      return result;
+    }
+  }
+
+  /* When clipping at the right edge of the window, t3_win_addnstr adds zero-width characters
+     following a dropped character to the last character in the window. The blocks can not
+     reproduce that, so strings that do not fit are added using t3_win_addnstr as well. */
+  if (prepared->result == T3_ERR_BAD_ARG || win->paint_y >= win->height ||
+      win->paint_x + prepared->width > win->width) {
+    return t3_win_addnstr(win, prepared->str, prepared->n, prepared->attrs);
+  }
+  if (win->lines == NULL && win->grid == NULL) {
+    return T3_ERR_ERRNO;
+  }
+  return _win_write_blocks(win, prepared->blocks, prepared->fill) ? prepared->result
+                                                                  : T3_ERR_ERRNO;
+}
+
 /** Get the next t3_window_t, when iterating over the t3_window_t's for drawing.
     @param ptr The last t3_window_t that was handled.
 */
@@ -967,27 +2187,22 @@ static t3_window_t *get_previous_window(t3_window_t *ptr) {
 }
 
 static t3_bool write_spaces_to_terminal_window(int attr_idx, int count) {
-  char space_str[64];
-  size_t space_str_bytes;
-  int i;
-  t3_bool result = true;
-
-  space_str_bytes = create_space_block(attr_idx, space_str);
-  if (count > 1) {
-    memcpy(space_str + space_str_bytes, space_str, space_str_bytes);
-    if (count > 2) {
-      memcpy(space_str + space_str_bytes * 2, space_str, space_str_bytes * 2);
-      if (count > 4) {
-        memcpy(space_str + space_str_bytes * 4, space_str, space_str_bytes * 4);
-      }
-    }
-  }
+  return write_space_runs(_t3_terminal_window, attr_idx, count);
+}
 
-  for (i = count / 8; i > 0; i--) {
-    result &= _win_write_blocks(_t3_terminal_window, space_str, space_str_bytes * 8);
+/** @internal
+    @brief Get a line of a t3_window_t encoded as blocks, regardless of its storage.
+    @param win The t3_window_t to get the line from. Must not be an unbacked window.
+    @param y The line to get.
+    @return The line, or @c NULL if no memory could be allocated for encoding the line.
+*/
+static const line_data_t *get_line(t3_window_t *win, int y) {
+  if (win->grid != NULL) {
+    return _t3_grid_get_line(win, y);
+  } else if (win->log != NULL) {
+    return _t3_log_get_line(win, y);
   }
-  result &= _win_write_blocks(_t3_terminal_window, space_str, space_str_bytes * (count & 7));
-  return result;
+  return win->lines + y;
 }
 
 /** @internal
@@ -997,8 +2212,8 @@ static t3_bool write_spaces_to_terminal_window(int attr_idx, int count) {
     @return A boolean indicating whether redrawing succeeded without memory errors.
 */
 t3_bool _t3_win_refresh_term_line(int line) {
-  line_data_t *draw;
-  t3_window_t *ptr;
+  const line_data_t *draw;
+  t3_window_t *ptr, *src;
   int y, x, parent_y, parent_x, parent_max_y, parent_max_x;
   int data_start, length, paint_x;
   t3_bool result = t3_true;
@@ -1012,7 +2227,7 @@ t3_bool _t3_win_refresh_term_line(int line) {
 
   for (ptr = _t3_tail != NULL && !_t3_tail->shown ? get_previous_window(_t3_tail) : _t3_tail;
        ptr != NULL; ptr = get_previous_window(ptr)) {
-    if (ptr->lines == NULL) {
+    if (ptr->lines == NULL && ptr->grid == NULL && ptr->log == NULL && ptr->canvas == NULL) {
       continue;
     }
 
@@ -1069,11 +2284,36 @@ t3_bool _t3_win_refresh_term_line(int line) {
       parent_max_x = _t3_terminal_window->width;
     }
 
-    draw = ptr->lines + line - y;
     x = t3_win_get_abs_x(ptr);
+    src = ptr;
+    if (ptr->canvas != NULL) {
+      /* Draw the line of the canvas as if the canvas were positioned at the offset of the
+         viewport, clipped by the viewport. */
+      src = ptr->canvas;
+      if (x > parent_x) {
+        parent_x = x;
+      }
+      if (x + ptr->width < parent_max_x) {
+        parent_max_x = x + ptr->width;
+      }
+      x -= ptr->canvas_x;
+      if (line - y + ptr->canvas_y < 0 || line - y + ptr->canvas_y >= src->height) {
+        continue;
+      }
+    }
+
+    if ((draw = get_line(src, line - y + ptr->canvas_y)) == NULL) {
+      result = t3_false;
+      continue;
+    }
+    /* Lines in the log of a log window may be wider than the window, if the window has been
+       made narrower after adding them. */
+    if (src->log != NULL && x + src->width < parent_max_x) {
+      parent_max_x = x + src->width;
+    }
 
     /* Skip lines that are fully clipped by the parent window. */
-    if (x >= parent_max_x || x + draw->start + draw->width < parent_x) {
+    if (x >= parent_max_x || x + src->width <= parent_x || parent_x >= parent_max_x) {
       continue;
     }
 
@@ -1087,21 +2327,21 @@ t3_bool _t3_win_refresh_term_line(int line) {
         start = draw->start;
       }
 
-      if (ptr->default_attrs == 0) {
+      if (src->default_attrs == 0) {
         _t3_terminal_window->paint_x = x + start;
       } else if (x >= parent_x) {
         _t3_terminal_window->paint_x = x;
-        result &= write_spaces_to_terminal_window(_t3_map_attr(ptr->default_attrs), start);
+        result &= write_spaces_to_terminal_window(_t3_map_attr(src->default_attrs), start);
       } else {
         _t3_terminal_window->paint_x = parent_x;
         result &=
-            write_spaces_to_terminal_window(_t3_map_attr(ptr->default_attrs), start - parent_x + x);
+            write_spaces_to_terminal_window(_t3_map_attr(src->default_attrs), start - parent_x + x);
       }
     } else /* if (x < parent_x) */ {
       _t3_terminal_window->paint_x = parent_x;
 
       for (paint_x = x + draw->start; data_start < draw->length;
-           data_start += (block_size >> 1) + block_size_bytes) {
+           data_start += _T3_BLOCK_SIZE_TO_BYTES(block_size) + block_size_bytes) {
         block_size = _t3_get_value(draw->data + data_start, &block_size_bytes);
         if (paint_x + _T3_BLOCK_SIZE_TO_WIDTH(block_size) > _t3_terminal_window->paint_x) {
           break;
@@ -1113,13 +2353,13 @@ t3_bool _t3_win_refresh_term_line(int line) {
         paint_x += _T3_BLOCK_SIZE_TO_WIDTH(block_size);
         result &= write_spaces_to_terminal_window(get_block_attr(draw->data + data_start),
                                                   paint_x - _t3_terminal_window->paint_x);
-        data_start += (block_size >> 1) + block_size_bytes;
+        data_start += _T3_BLOCK_SIZE_TO_BYTES(block_size) + block_size_bytes;
       }
     }
 
     paint_x = _t3_terminal_window->paint_x;
     for (length = data_start; length < draw->length;
-         length += (block_size >> 1) + block_size_bytes) {
+         length += _T3_BLOCK_SIZE_TO_BYTES(block_size) + block_size_bytes) {
       block_size = _t3_get_value(draw->data + length, &block_size_bytes);
       if (paint_x + _T3_BLOCK_SIZE_TO_WIDTH(block_size) > parent_max_x) {
         break;
@@ -1132,17 +2372,24 @@ t3_bool _t3_win_refresh_term_line(int line) {
           _win_write_blocks(_t3_terminal_window, draw->data + data_start, length - data_start);
     }
 
-    /* Add a space for the multi-cell character that is crossed by the parent clipping. */
-    if (length < draw->length && paint_x == parent_max_x - 1) {
-      result &= write_spaces_to_terminal_window(get_block_attr(draw->data + length), 1);
+    /* Add spaces for the double width character or the run of spaces that is crossed by the
+       parent clipping. */
+    if (length < draw->length && paint_x < parent_max_x) {
+      result &= write_spaces_to_terminal_window(get_block_attr(draw->data + length),
+                                                parent_max_x - paint_x);
     }
 
-    if (ptr->default_attrs != 0 && draw->start + draw->width < ptr->width &&
+    if (src->default_attrs != 0 && draw->start + draw->width < src->width &&
         x + draw->start + draw->width < parent_max_x) {
-      result &= write_spaces_to_terminal_window(_t3_map_attr(ptr->default_attrs),
-                                                x + ptr->width <= parent_max_x
-                                                    ? ptr->width - draw->start - draw->width
-                                                    : parent_max_x - x - draw->start - draw->width);
+      /* The line may end before the parent window, if the t3_window_t is partially clipped. */
+      _t3_terminal_window->paint_x = x + draw->start + draw->width;
+      if (_t3_terminal_window->paint_x < parent_x) {
+        _t3_terminal_window->paint_x = parent_x;
+      }
+      result &= write_spaces_to_terminal_window(
+          _t3_map_attr(src->default_attrs),
+          (x + src->width <= parent_max_x ? x + src->width : parent_max_x) -
+              _t3_terminal_window->paint_x);
     }
   }
 
@@ -1175,7 +2422,14 @@ t3_bool _t3_win_refresh_term_line(int line) {
 
 /** Clear current t3_window_t painting line to end. */
 void t3_win_clrtoeol(t3_window_t *win) {
-  if (win->paint_y >= win->height || win->lines == NULL) {
+  if (win->paint_y >= win->height) {
+    return;
+  }
+  if (win->grid != NULL) {
+    _t3_grid_clear(win, win->paint_y, win->paint_x);
+    return;
+  }
+  if (win->lines == NULL) {
     return;
   }
 
@@ -1185,35 +2439,32 @@ void t3_win_clrtoeol(t3_window_t *win) {
     win->lines[win->paint_y].start = 0;
   } else if (win->paint_x < win->lines[win->paint_y].start + win->lines[win->paint_y].width) {
     int sumwidth = win->lines[win->paint_y].start, i;
-    uint32_t block_size;
+    uint32_t block_size = 0; /* Shut up the compiler. */
     size_t block_size_bytes;
 
-    block_size = _t3_get_value(win->lines[win->paint_y].data, &block_size_bytes);
-    for (i = 0; i < win->lines[win->paint_y].length &&
-                sumwidth + _T3_BLOCK_SIZE_TO_WIDTH(block_size) <= win->paint_x;
-         i += (block_size >> 1) + block_size_bytes) {
-      sumwidth += _T3_BLOCK_SIZE_TO_WIDTH(block_size);
+    for (i = 0; i < win->lines[win->paint_y].length;
+         i += _T3_BLOCK_SIZE_TO_BYTES(block_size) + block_size_bytes) {
       block_size = _t3_get_value(win->lines[win->paint_y].data + i, &block_size_bytes);
+      if (sumwidth + _T3_BLOCK_SIZE_TO_WIDTH(block_size) > win->paint_x) {
+        break;
+      }
+      sumwidth += _T3_BLOCK_SIZE_TO_WIDTH(block_size);
     }
-    win->lines[win->paint_y].length = i;
 
     if (sumwidth < win->paint_x) {
-      int spaces = win->paint_x - sumwidth;
-      char space_str[8];
-      size_t space_str_bytes;
-
-      win->paint_x = sumwidth;
-
-      space_str_bytes = create_space_block(_t3_map_attr(win->default_attrs), space_str);
-      if (ensure_space(win->lines + win->paint_y,
-                       spaces * space_str_bytes - win->lines[win->paint_y].length + i)) {
-        for (; spaces > 0; spaces--) {
-          _win_write_blocks(win, space_str, space_str_bytes);
-        }
-      }
+      /* The character at the paint position is cut. A run of spaces keeps its attributes for
+         the remaining part, while a double width character is replaced by a space with the
+         default attributes. The result is never longer than the cut block. */
+      uint32_t attr = _T3_BLOCK_IS_RUN(block_size)
+                          ? get_block_attr(win->lines[win->paint_y].data + i)
+                          : (uint32_t)_t3_map_attr(win->default_attrs);
+      i += create_space_runs(attr, win->paint_x - sumwidth, win->lines[win->paint_y].data + i);
     }
-
+    win->lines[win->paint_y].length = i;
     win->lines[win->paint_y].width = win->paint_x - win->lines[win->paint_y].start;
+    if (win->cached_pos_line == win->paint_y) {
+      win->cached_pos_line = -1;
+    }
   }
 }
 
@@ -1223,6 +2474,106 @@ void t3_win_clrtoeol(t3_window_t *win) {
     if ((retval = (x)) != 0) return retval; \
   } while (0)
 
+/** Fill a rectangle in a t3_window_t by repeating a string.
+    @param win The t3_window_t to draw on.
+    @param y The top line of the rectangle.
+    @param x The left column of the rectangle.
+    @param height The height of the rectangle.
+    @param width The width of the rectangle.
+    @param str The nul-terminated string to repeat on each line of the rectangle.
+    @param attr The attributes to use for drawing.
+    @retval ::T3_ERR_SUCCESS on succes
+    @retval ::T3_ERR_BAD_ARG if @p str has no width, starts with a zero-width character, or is
+        too long to be repeated.
+    @retval ::T3_ERR_NONPRINT if @p str contains a control character. The other characters are
+        still drawn.
+    @retval ::T3_ERR_OUT_OF_MEMORY if no memory could be allocated to map the attributes.
+    @retval ::T3_ERR_ERRNO otherwise.
+
+    On each line, @p str is repeated as many times as it fits in @p width columns. Any columns
+    left over are filled with spaces. Parts of the rectangle outside the window are not drawn,
+    and the paint position is not changed. @p str is encoded only once, which makes this much
+    cheaper than drawing each line using ::t3_win_addstrrep.
+*/
+int t3_win_fill_rect(t3_window_t *win, int y, int x, int height, int width, const char *str,
+                     t3_attr_t attr) {
+  block_buffer_t unit;
+  int i, attrs_idx, result = T3_ERR_SUCCESS, paint_x, paint_y;
+  t3_bool spaces = strcmp(str, " ") == 0, success = t3_true;
+
+  if ((attrs_idx = map_win_attrs(win, attr, 0, 0)) < 0) {
+    return T3_ERR_OUT_OF_MEMORY;
+  }
+  if (!spaces) {
+    result = encode_repeat_unit(win, str, strlen(str), attrs_idx, &unit);
+    if (result == T3_ERR_BAD_ARG || result == T3_ERR_ERRNO) {
+      return result;
+    }
+  }
+
+  if (y < 0) {
+    height += y;
+    y = 0;
+  }
+  if (x < 0) {
+    width += x;
+    x = 0;
+  }
+  if (y + height > win->height) {
+    height = win->height - y;
+  }
+  if (x + width > win->width) {
+    width = win->width - x;
+  }
+
+  paint_x = win->paint_x;
+  paint_y = win->paint_y;
+  for (i = 0; i < height; i++) {
+    t3_win_set_paint(win, y + i, x);
+    if (spaces) {
+      success &= write_space_runs(win, attrs_idx, width);
+      continue;
+    }
+    success &= write_repeated_blocks(win, &unit, width / unit.width);
+    success &= write_space_runs(win, attrs_idx, width % unit.width);
+  }
+  win->paint_x = paint_x;
+  win->paint_y = paint_y;
+  return success ? result : T3_ERR_ERRNO;
+}
+
+/** Draw a horizontal line on a t3_window_t.
+    @param win The t3_window_t to draw on.
+    @param y The line to draw on.
+    @param x The column to start drawing at.
+    @param length The length of the line.
+    @param attr The attributes to use for drawing.
+    @return See ::t3_win_fill_rect.
+
+    The line is drawn using the ::T3_ACS_HLINE character. The paint position is not changed.
+*/
+int t3_win_hline(t3_window_t *win, int y, int x, int length, t3_attr_t attr) {
+  static const char line[] = {T3_ACS_HLINE, 0};
+
+  return t3_win_fill_rect(win, y, x, 1, length, line, attr | T3_ATTR_ACS);
+}
+
+/** Draw a vertical line on a t3_window_t.
+    @param win The t3_window_t to draw on.
+    @param y The line to start drawing at.
+    @param x The column to draw in.
+    @param length The length of the line.
+    @param attr The attributes to use for drawing.
+    @return See ::t3_win_fill_rect.
+
+    The line is drawn using the ::T3_ACS_VLINE character. The paint position is not changed.
+*/
+int t3_win_vline(t3_window_t *win, int y, int x, int length, t3_attr_t attr) {
+  static const char line[] = {T3_ACS_VLINE, 0};
+
+  return t3_win_fill_rect(win, y, x, length, 1, line, attr | T3_ATTR_ACS);
+}
+
 /** Draw a box on a t3_window_t.
     @param win The t3_window_t to draw on.
     @param y The line of the t3_window_t to start drawing on.
@@ -1233,12 +2584,10 @@ void t3_win_clrtoeol(t3_window_t *win) {
     @return See ::t3_win_addnstr.
 */
 int t3_win_box(t3_window_t *win, int y, int x, int height, int width, t3_attr_t attr) {
-  int i;
-
   attr = t3_term_combine_attrs(attr | T3_ATTR_ACS, win->default_attrs);
 
   if (y >= win->height || y + height > win->height || x >= win->width || x + width > win->width ||
-      win->lines == NULL) {
+      (win->lines == NULL && win->grid == NULL)) {
     return -1;
   }
 
@@ -1246,11 +2595,9 @@ int t3_win_box(t3_window_t *win, int y, int x, int height, int width, t3_attr_t
   ABORT_ON_FAIL(t3_win_addch(win, T3_ACS_ULCORNER, attr));
   ABORT_ON_FAIL(t3_win_addchrep(win, T3_ACS_HLINE, attr, width - 2));
   ABORT_ON_FAIL(t3_win_addch(win, T3_ACS_URCORNER, attr));
-  for (i = 1; i < height - 1; i++) {
-    t3_win_set_paint(win, y + i, x);
-    ABORT_ON_FAIL(t3_win_addch(win, T3_ACS_VLINE, attr));
-    t3_win_set_paint(win, y + i, x + width - 1);
-    ABORT_ON_FAIL(t3_win_addch(win, T3_ACS_VLINE, attr));
+  if (height > 2) {
+    ABORT_ON_FAIL(t3_win_vline(win, y + 1, x, height - 2, attr));
+    ABORT_ON_FAIL(t3_win_vline(win, y + 1, x + width - 1, height - 2, attr));
   }
   t3_win_set_paint(win, y + height - 1, x);
   ABORT_ON_FAIL(t3_win_addch(win, T3_ACS_LLCORNER, attr));
@@ -1261,18 +2608,273 @@ int t3_win_box(t3_window_t *win, int y, int x, int height, int width, t3_attr_t
 
 /** Clear current t3_window_t painting line to end and all subsequent lines fully. */
 void t3_win_clrtobot(t3_window_t *win) {
-  if (win->lines == NULL) {
+  if (win->lines == NULL && win->grid == NULL) {
     return;
   }
 
   t3_win_clrtoeol(win);
   for (win->paint_y++; win->paint_y < win->height; win->paint_y++) {
+    if (win->grid != NULL) {
+      _t3_grid_clear(win, win->paint_y, 0);
+      continue;
+    }
     win->lines[win->paint_y].length = 0;
     win->lines[win->paint_y].width = 0;
     win->lines[win->paint_y].start = 0;
   }
 }
 
+/** Append the blocks of a line that cover a range of columns to another line.
+    @param copy The line to append to.
+    @param line The line to take the blocks from.
+    @param x The first column of the range.
+    @param width The number of columns in the range.
+    @param default_attr The mapped default attributes of the window containing @p line.
+    @return A boolean indicating success.
+
+    Blocks that are completely inside the range are copied without decoding them. Blocks that
+    only partially overlap the range, such as cut double width characters, are replaced by
+    spaces with the same attributes. Columns that are not covered by @p line are filled with
+    spaces using @p default_attr.
+*/
+static t3_bool append_line_range(line_data_t *copy, const line_data_t *line, int x, int width,
+                                 int default_attr) {
+  uint32_t block_size, attr;
+  size_t block_size_bytes;
+  int i, pos_width = line->start, block_width, count;
+
+  if (x < line->start) {
+    count = (line->start < x + width ? line->start : x + width) - x;
+    if (!ensure_space(NULL, copy, create_space_runs(default_attr, count, NULL))) {
+      return t3_false;
+    }
+    copy->length += create_space_runs(default_attr, count, copy->data + copy->length);
+  }
+
+  if (x <= line->start && line->start + line->width <= x + width) {
+    /* The whole line is inside the range. Lines that have not been drawn on may not have any
+       data allocated. */
+    if (line->length > 0) {
+      if (!ensure_space(NULL, copy, line->length)) {
+        return t3_false;
+      }
+      memcpy(copy->data + copy->length, line->data, line->length);
+      copy->length += line->length;
+    }
+  } else {
+    for (i = 0; i < line->length && pos_width < x + width;
+         i += _T3_BLOCK_SIZE_TO_BYTES(block_size) + block_size_bytes, pos_width += block_width) {
+      block_size = _t3_get_value(line->data + i, &block_size_bytes);
+      block_width = _T3_BLOCK_SIZE_TO_WIDTH(block_size);
+      if (pos_width + block_width <= x) {
+        continue;
+      }
+
+      if (pos_width >= x && pos_width + block_width <= x + width) {
+        if (!ensure_space(NULL, copy, _T3_BLOCK_SIZE_TO_BYTES(block_size) + block_size_bytes)) {
+          return t3_false;
+        }
+        memcpy(copy->data + copy->length, line->data + i,
+               _T3_BLOCK_SIZE_TO_BYTES(block_size) + block_size_bytes);
+        copy->length += _T3_BLOCK_SIZE_TO_BYTES(block_size) + block_size_bytes;
+      } else {
+        count = (pos_width + block_width < x + width ? pos_width + block_width : x + width) -
+                (pos_width > x ? pos_width : x);
+        attr = get_block_attr(line->data + i);
+        if (!ensure_space(NULL, copy, create_space_runs(attr, count, NULL))) {
+          return t3_false;
+        }
+        copy->length += create_space_runs(attr, count, copy->data + copy->length);
+      }
+    }
+  }
+
+  pos_width = line->start + line->width > x ? line->start + line->width : x;
+  if (pos_width < x + width) {
+    count = x + width - pos_width;
+    if (!ensure_space(NULL, copy, create_space_runs(default_attr, count, NULL))) {
+      return t3_false;
+    }
+    copy->length += create_space_runs(default_attr, count, copy->data + copy->length);
+  }
+  return t3_true;
+}
+
+/** Copy a rectangular region from one t3_window_t to another.
+    @param src The t3_window_t to copy from.
+    @param src_y The top line of the region in @p src.
+    @param src_x The left column of the region in @p src.
+    @param dst The t3_window_t to copy to. This may be the same as @p src.
+    @param dst_y The line in @p dst to copy the top line of the region to.
+    @param dst_x The column in @p dst to copy the left column of the region to.
+    @param height The height of the region.
+    @param width The width of the region.
+    @return A boolean indicating success.
+
+    The region is clipped to both windows. The encoded contents of the lines are copied
+    without decoding the text, so the cost is proportional to the size of the copied data.
+    Double width characters that are cut by the edges of the region are copied as spaces,
+    and columns in @p src that have not been drawn are copied as spaces with the default
+    attributes of @p src. Overlapping regions in the same window are copied correctly. The
+    paint position of @p dst is not changed. If @p src is a log window, the lines in its
+    current view are copied. A log window can not be used as @p dst.
+*/
+t3_bool t3_win_copy_region(t3_window_t *src, int src_y, int src_x, t3_window_t *dst, int dst_y,
+                           int dst_x, int height, int width) {
+  line_data_t copy, *dst_line;
+  const line_data_t *line;
+  int i, step, default_attr, paint_x, paint_y;
+  t3_bool result = t3_true;
+
+  if ((src->lines == NULL && src->grid == NULL && src->log == NULL) ||
+      (dst->lines == NULL && dst->grid == NULL)) {
+    return t3_false;
+  }
+
+  /* Clip the region to both windows. */
+  i = src_y < dst_y ? src_y : dst_y;
+  if (i < 0) {
+    src_y -= i;
+    dst_y -= i;
+    height += i;
+  }
+  i = src_x < dst_x ? src_x : dst_x;
+  if (i < 0) {
+    src_x -= i;
+    dst_x -= i;
+    width += i;
+  }
+  if (height > src->height - src_y) {
+    height = src->height - src_y;
+  }
+  if (height > dst->height - dst_y) {
+    height = dst->height - dst_y;
+  }
+  if (width > src->width - src_x) {
+    width = src->width - src_x;
+  }
+  if (width > dst->width - dst_x) {
+    width = dst->width - dst_x;
+  }
+  if (height <= 0 || width <= 0) {
+    return t3_true;
+  }
+
+  if ((default_attr = _t3_map_attr(src->default_attrs)) < 0) {
+    return t3_false;
+  }
+  if ((copy.data = _t3_malloc(INITIAL_ALLOC)) == NULL) {
+    return t3_false;
+  }
+  copy.allocated = INITIAL_ALLOC;
+
+  paint_x = dst->paint_x;
+  paint_y = dst->paint_y;
+  /* When copying down within a window, start at the bottom such that no line is overwritten
+     before it is copied. */
+  i = src == dst && dst_y > src_y ? height - 1 : 0;
+  step = src == dst && dst_y > src_y ? -1 : 1;
+  for (; i >= 0 && i < height; i += step) {
+    line = get_line(src, src_y + i);
+    copy.length = 0;
+    if (line == NULL || !append_line_range(&copy, line, src_x, width, default_attr)) {
+      result = t3_false;
+      break;
+    }
+    dst_line = dst->grid == NULL ? dst->lines + dst_y + i : NULL;
+    if (dst_line != NULL &&
+        (dst_line->length == 0 ||
+         (dst_x <= dst_line->start && dst_line->start + dst_line->width <= dst_x + width))) {
+      /* The copy covers all existing contents of the destination line, so it can simply
+         replace the line data. */
+      dst_line->length = 0;
+      if (!ensure_space(dst, dst_line, copy.length)) {
+        result = t3_false;
+        break;
+      }
+      memcpy(dst_line->data, copy.data, copy.length);
+      dst_line->length = copy.length;
+      dst_line->start = dst_x;
+      dst_line->width = width;
+      if (dst->cached_pos_line == dst_y + i) {
+        dst->cached_pos_line = -1;
+      }
+      continue;
+    }
+    dst->paint_y = dst_y + i;
+    dst->paint_x = dst_x;
+    result &= _win_write_blocks(dst, copy.data, copy.length);
+  }
+  dst->paint_x = paint_x;
+  dst->paint_y = paint_y;
+  _t3_free(copy.data);
+  return result;
+}
+
+/** Replace a line of a t3_window_t with the contents of a single line t3_window_t.
+    @param win The t3_window_t to replace the line of.
+    @param y The line to replace.
+    @param line The t3_window_t with height 1 holding the new contents.
+    @return A boolean indicating success.
+
+    This allows a whole line to be built separately, using all of the drawing functions on
+    @p line, after which it replaces the line in @p win at once. The buffers of the lines are
+    exchanged rather than copied: @p line is left empty, and reuses the buffer of the replaced
+    line for building the next line. Therefore, regenerating the lines of a window this way
+    does not require any allocations once all lines have their own buffer.
+
+    Both windows must have been created with ::t3_win_new, and the contents of @p line must
+    fit in @p win. @p line must not be shown: it is only a builder, and showing it would draw the
+    line being built on the terminal. The paint positions of the windows are not changed.
+
+    The attributes of the contents are resolved when drawing in @p line, so the default
+    attributes of @p line (see ::t3_win_set_default_attrs) are baked into the line. The default
+    attributes of @p win only apply to the part of the line not covered by the transferred
+    contents, so the builder should normally use the same default attributes as @p win.
+*/
+t3_bool t3_win_set_line(t3_window_t *win, int y, t3_window_t *line) {
+  line_data_t *dst, *src, save;
+  char *data;
+
+  if (win->lines == NULL || line->lines == NULL || line->height != 1 || win == line || y < 0 ||
+      y >= win->height) {
+    return t3_false;
+  }
+  dst = win->lines + y;
+  src = line->lines;
+  if (src->length > 0 && src->start + src->width > win->width) {
+    return t3_false;
+  }
+
+  /* Buffers in a slab can not be transferred to another window. Single line windows do not use
+     a slab, so this only happens if line had a larger height before. */
+  if (src->allocated > 0 && _t3_win_in_slab(line, src->data)) {
+    if (src->length == 0) {
+      data = NULL;
+    } else if ((data = _t3_malloc(src->length)) == NULL) {
+      return t3_false;
+    } else {
+      memcpy(data, src->data, src->length);
+    }
+    src->data = data;
+    src->allocated = src->length;
+  }
+  if (dst->allocated > 0 && _t3_win_in_slab(win, dst->data)) {
+    dst->data = NULL;
+    dst->allocated = 0;
+  }
+
+  save = *dst;
+  *dst = *src;
+  *src = save;
+  src->length = 0;
+  src->start = 0;
+  src->width = 0;
+  line->cached_pos_line = -1;
+  win->cached_pos_line = -1;
+  return t3_true;
+}
+
 /** Find the top-most window at a location
     @return The top-most window at the specified location, or @c NULL if no
         window covers the specified location.
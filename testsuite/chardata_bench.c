@@ -0,0 +1,93 @@
+/* Benchmark for the get_chardata lookup. Compile with:
+   gcc -O2 -D_XOPEN_SOURCE=600 -o chardata_bench chardata_bench.c \
+     ../src/generated/chardata.c -I../src -I../../t3shared/include
+
+   For each kind of text, this measures the time per code point of looking up the character data
+   with get_chardata. The first measurement does independent lookups. In the second, the position
+   of each lookup depends on the result of the previous one, such that the latency of the lookup
+   is measured. Only get_chardata is used, so the same file can be compiled against older versions
+   of the generated table for comparison. Pass a number of repetitions as the first argument to
+   change the duration of the measurement.
+*/
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "generated/chardata.h"
+
+#define BUFFER_SIZE (1 << 20)
+
+static uint32_t buffer[BUFFER_SIZE];
+
+/* Fill the buffer with random code points of the given kind of text. */
+static void fill_buffer(int kind) {
+  size_t i;
+  int r;
+
+  srand(1);
+  for (i = 0; i < BUFFER_SIZE; i++) {
+    r = rand() % 100;
+    switch (kind) {
+      case 0:
+        buffer[i] = 0x20 + rand() % 95;
+        break;
+      case 1:
+        buffer[i] = r < 85 ? 0x20 + rand() % 95 : 0xc0 + rand() % 0x180;
+        break;
+      case 2:
+        buffer[i] = r < 20 ? 0x20 : 0x400 + rand() % 0x50;
+        break;
+      case 3:
+        buffer[i] = r < 10 ? 0x3000 + rand() % 0x40 : 0x4e00 + rand() % 0x5000;
+        break;
+      default:
+        buffer[i] = r < 50 ? 0x20 + rand() % 95 : r < 90 ? 0x1f300 + rand() % 0x300 : 0x200d;
+        break;
+    }
+  }
+}
+
+static double now(void) {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+int main(int argc, char *argv[]) {
+  static const char *names[] = {"ASCII", "Latin-1 mix", "Cyrillic", "CJK", "emoji + ASCII"};
+  int repetitions = argc > 1 ? atoi(argv[1]) : 50;
+  volatile unsigned sink = 0;
+  double start, independent_time, chained_time, lookups;
+  unsigned sum;
+  size_t i;
+  int kind, j;
+
+  for (kind = 0; kind < (int)(sizeof(names) / sizeof(names[0])); kind++) {
+    fill_buffer(kind);
+    lookups = (double)repetitions * BUFFER_SIZE;
+    sum = 0;
+
+    start = now();
+    for (j = 0; j < repetitions; j++) {
+      for (i = 0; i < BUFFER_SIZE; i++) {
+        sum += get_chardata(buffer[i]);
+      }
+    }
+    independent_time = now() - start;
+
+    start = now();
+    for (j = 0; j < repetitions; j++) {
+      for (i = 0; i < BUFFER_SIZE; i++) {
+        sum += get_chardata(buffer[(i + (sum & 1)) & (BUFFER_SIZE - 1)]);
+      }
+    }
+    chained_time = now() - start;
+    sink += sum;
+
+    printf("%-14s independent: %5.2f ns/code point  chained: %5.2f ns/code point\n", names[kind],
+           independent_time * 1e9 / lookups, chained_time * 1e9 / lookups);
+  }
+  return 0;
+}
@@ -0,0 +1,107 @@
+/* Benchmark for t3_term_strncwidth. Compile with:
+   gcc -O2 -D_XOPEN_SOURCE=600 -o strwidth_bench strwidth_bench.c -I../src \
+     -I../../t3shared/include -L../src/.libs -l t3window
+
+   For each kind of text, this measures the throughput of t3_term_strncwidth and of a loop which
+   decodes and looks up every code point with t3_utf8_get and t3_utf8_wcwidth_ext, which is how
+   t3_term_strncwidth used to work. The latter does not combine grapheme clusters, so the widths it
+   computes for emoji sequences differ. Pass a number of repetitions as the first argument to
+   change the duration of the measurement.
+*/
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "utf8.h"
+#include "window.h"
+
+#define BUFFER_SIZE 65536
+
+typedef struct {
+  const char *name;
+  /* The pieces of text are picked at random to fill the buffer. */
+  const char *pieces[8];
+} text_kind_t;
+
+static const text_kind_t kinds[] = {
+    {"Latin text", {"The quick ", "brown fox ", "jumps over ", "the lazy dog. ", NULL}},
+    {"CJK with ASCII", {"\xe6\x96\x87\xe5\xad\x97", " ", "\xe3\x81\x8b\xe3\x81\xaa", "abc ", NULL}},
+    {"Emoji and accented text",
+     {"caf\xc3\xa9 ", "e\xcc\x81", "\xf0\x9f\x91\x8d\xf0\x9f\x8f\xbd",
+      "\xf0\x9f\x91\xa8\xe2\x80\x8d\xf0\x9f\x92\xbb", " na\xc3\xafve ", NULL}},
+};
+
+static char buffer[BUFFER_SIZE];
+
+static size_t fill_buffer(const text_kind_t *kind) {
+  size_t fill = 0, count, piece_len;
+  const char *piece;
+
+  for (count = 0; kind->pieces[count] != NULL; count++) {
+  }
+
+  srand(1);
+  while (1) {
+    piece = kind->pieces[rand() % count];
+    piece_len = strlen(piece);
+    if (fill + piece_len > BUFFER_SIZE) {
+      return fill;
+    }
+    memcpy(buffer + fill, piece, piece_len);
+    fill += piece_len;
+  }
+}
+
+static size_t per_codepoint_width(const char *str, size_t n) {
+  size_t total = 0, bytes_read;
+  int width, state = 0;
+  uint32_t c;
+
+  for (; n > 0; n -= bytes_read, str += bytes_read) {
+    bytes_read = n;
+    c = t3_utf8_get(str, &bytes_read);
+    width = t3_utf8_wcwidth_ext(c, &state);
+    if (width > 0) {
+      total += width;
+    }
+  }
+  return total;
+}
+
+static double now(void) {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+int main(int argc, char *argv[]) {
+  int repetitions = argc > 1 ? atoi(argv[1]) : 2000;
+  size_t i, fill;
+  volatile size_t sink = 0;
+  double start, strncwidth_time, per_codepoint_time;
+  int j;
+
+  for (i = 0; i < sizeof(kinds) / sizeof(kinds[0]); i++) {
+    fill = fill_buffer(&kinds[i]);
+
+    start = now();
+    for (j = 0; j < repetitions; j++) {
+      sink += t3_term_strncwidth(buffer, fill);
+    }
+    strncwidth_time = now() - start;
+
+    start = now();
+    for (j = 0; j < repetitions; j++) {
+      sink += per_codepoint_width(buffer, fill);
+    }
+    per_codepoint_time = now() - start;
+
+    printf("%-24s t3_term_strncwidth: %8.0f MB/s  per code point: %8.0f MB/s\n", kinds[i].name,
+           fill * (double)repetitions / strncwidth_time / 1e6,
+           fill * (double)repetitions / per_codepoint_time / 1e6);
+  }
+  return 0;
+}
@@ -0,0 +1,81 @@
+#include <string.h>
+
+/* Allocations are prefixed with a header, such that memory which was not allocated
+   through the allocator is detected when it is released. */
+#define MAGIC 0x7433616cUL
+#define HEADER_SIZE 16
+
+static long allocations, live;
+
+static void *test_malloc(size_t size) {
+	char *result;
+
+	if ((result = malloc(size + HEADER_SIZE)) == NULL)
+		return NULL;
+	*(unsigned long *) result = MAGIC;
+	allocations++;
+	live++;
+	return result + HEADER_SIZE;
+}
+
+static void check_header(void *ptr) {
+	if (*(unsigned long *) ((char *) ptr - HEADER_SIZE) != MAGIC)
+		fatal("Memory not allocated by the allocator was passed to it\n");
+}
+
+static void *test_realloc(void *ptr, size_t size) {
+	char *result;
+
+	if (ptr == NULL)
+		return test_malloc(size);
+	check_header(ptr);
+	if ((result = realloc((char *) ptr - HEADER_SIZE, size + HEADER_SIZE)) == NULL)
+		return NULL;
+	return result + HEADER_SIZE;
+}
+
+static void test_free(void *ptr) {
+	if (ptr == NULL)
+		return;
+	check_header(ptr);
+	live--;
+	free((char *) ptr - HEADER_SIZE);
+}
+
+/* The allocator must be set before any other function of the library is called, which
+   happens in main. */
+static void set_allocator(void) __attribute__((constructor));
+static void set_allocator(void) {
+	static const t3_allocator_t allocator = { test_malloc, test_realloc, test_free };
+	t3_set_allocator(&allocator);
+}
+
+static int test(void) {
+	t3_window_t *win;
+	t3_prepared_str_t *prepared;
+	long before, drawn;
+
+	ASSERT(allocations > 0);
+	before = live;
+	ASSERT(win = t3_win_new(NULL, 10, 40, 2, 2, 0));
+	t3_win_show(win);
+	t3_term_hide_cursor();
+	t3_win_addstr(win, "abＱc̃defghijk", T3_ATTR_BOLD);
+	t3_win_set_paint(win, 2, 0);
+	t3_win_addchrep(win, '-', T3_ATTR_FG_RED, 30);
+	t3_win_box(win, 4, 0, 4, 10, 0);
+	ASSERT(prepared = t3_prepare_str("prepared", 8, T3_ATTR_UNDERLINE));
+	t3_win_set_paint(win, 9, 0);
+	ASSERT(t3_win_add_prepared(win, prepared) == T3_ERR_SUCCESS);
+	next();
+
+	ASSERT(live > before);
+	drawn = live;
+	t3_prepared_str_free(prepared);
+	t3_win_del(win);
+	t3_term_compact();
+	ASSERT(live < drawn);
+	next();
+
+	return 0;
+}
@@ -0,0 +1,60 @@
+static int test(void) {
+	t3_window_t *win, *wide;
+	int i;
+
+	ASSERT(win = t3_win_new(NULL, 12, 16, 2, 2, 0));
+	t3_win_show(win);
+	t3_term_hide_cursor();
+
+	/* Runs around the eight byte chunk size. */
+	ASSERT(t3_win_addstr(win, "1234567", 0) == T3_ERR_SUCCESS);
+	t3_win_set_paint(win, 1, 0);
+	ASSERT(t3_win_addstr(win, "12345678", T3_ATTR_BOLD) == T3_ERR_SUCCESS);
+	t3_win_set_paint(win, 2, 0);
+	ASSERT(t3_win_addstr(win, "123456789", T3_ATTR_UNDERLINE) == T3_ERR_SUCCESS);
+	t3_win_set_paint(win, 3, 0);
+	ASSERT(t3_win_addstr(win, "123456789abcdef", 0) == T3_ERR_SUCCESS);
+	t3_win_set_paint(win, 4, 0);
+	ASSERT(t3_win_addstr(win, "123456789abcdefg", T3_ATTR_REVERSE) == T3_ERR_SUCCESS);
+	/* Runs extending beyond the right edge of the window are clipped. */
+	t3_win_set_paint(win, 5, 0);
+	ASSERT(t3_win_addstr(win, "123456789abcdefgh", 0) == T3_ERR_SUCCESS);
+	t3_win_set_paint(win, 6, 10);
+	ASSERT(t3_win_addstr(win, "abcdefghijklmnopqrstuvwxyz", T3_ATTR_BOLD) == T3_ERR_SUCCESS);
+	/* A control character and a non-ASCII character in the middle of a run. */
+	t3_win_set_paint(win, 7, 0);
+	ASSERT(t3_win_addstr(win, "abcdefghi\tjklmnopqrs", 0) == T3_ERR_NONPRINT);
+	t3_win_set_paint(win, 8, 0);
+	ASSERT(t3_win_addstr(win, "abcdefg\xc3\xa9hijklmn", 0) == T3_ERR_SUCCESS);
+	/* Combining characters are attached to the last character of a run. */
+	t3_win_set_paint(win, 9, 0);
+	ASSERT(t3_win_addstr(win, "abcdefgh\xcc\x83ijk\xcc\x81", 0) == T3_ERR_SUCCESS);
+	/* A run written in parts, with the string size ending in the middle of a chunk. */
+	t3_win_set_paint(win, 10, 0);
+	ASSERT(t3_win_addnstr(win, "0123456789abcdef", 11, T3_ATTR_UNDERLINE) == T3_ERR_SUCCESS);
+	ASSERT(t3_win_addnstr(win, "xyz", 3, 0) == T3_ERR_SUCCESS);
+	/* Overwriting double width characters with ASCII. */
+	t3_win_set_paint(win, 11, 0);
+	for (i = 0; i < 8; i++) {
+		ASSERT(t3_win_addstr(win, "\xef\xbc\xb1", 0) == T3_ERR_SUCCESS);
+	}
+	next();
+
+	t3_win_set_paint(win, 11, 1);
+	ASSERT(t3_win_addstr(win, "abc", T3_ATTR_BOLD) == T3_ERR_SUCCESS);
+	t3_win_set_paint(win, 11, 8);
+	ASSERT(t3_win_addstr(win, "defghijk", 0) == T3_ERR_SUCCESS);
+	next();
+
+	/* A run long enough to be encoded in more than one buffer. Only the end of the window is
+	   visible. */
+	ASSERT(wide = t3_win_new(NULL, 1, 300, 16, -130, 0));
+	t3_win_show(wide);
+	ASSERT(t3_win_addstr(wide, "0123456789abcdefghijklmnopqrstuvwxyz0123456789abcdefghijklmnopqrstuvwxyz"
+		"0123456789abcdefghijklmnopqrstuvwxyz0123456789abcdefghijklmnopqrstuvwxyz0123456789abcdefghij"
+		"klmnopqrstuvwxyz0123456789abcdefghijklmnopqrstuvwxyz0123456789abcdefghijklmnopqrstuvwxyz0123"
+		"456789abcdefghijklmnopqrstuvwxyz", T3_ATTR_UNDERLINE) == T3_ERR_SUCCESS);
+	next();
+
+	return 0;
+}
@@ -0,0 +1,45 @@
+static int test(void) {
+	t3_window_t *win1, *win2, *tmp;
+	t3_attr_handle_t bold, red;
+
+	/* Use some attributes in a window which is deleted again, such that compacting
+	   the attributes renumbers the resolved attributes. */
+	ASSERT(tmp = t3_win_new(NULL, 1, 10, 0, 0, 0));
+	t3_win_addstr(tmp, "a", T3_ATTR_FG_BLUE);
+	t3_win_addstr(tmp, "b", T3_ATTR_FG_YELLOW | T3_ATTR_UNDERLINE);
+
+	ASSERT(win1 = t3_win_new(NULL, 4, 30, 2, 2, 0));
+	ASSERT(win2 = t3_win_new(NULL, 4, 30, 8, 2, 0));
+	t3_win_set_default_attrs(win2, T3_ATTR_BG_BLUE);
+	t3_win_show(win1);
+	t3_win_show(win2);
+	t3_term_hide_cursor();
+
+	bold = t3_win_resolve_attr(win1, T3_ATTR_BOLD);
+	red = t3_win_resolve_attr(win1, T3_ATTR_FG_RED);
+	ASSERT(t3_win_addstr_h(win1, "bold", &bold) == T3_ERR_SUCCESS);
+	ASSERT(t3_win_addch_h(win1, ' ', &bold) == T3_ERR_SUCCESS);
+	ASSERT(t3_win_addnstr_h(win1, "redxxx", 3, &red) == T3_ERR_SUCCESS);
+	/* The handles are revalidated for windows with different default attributes. */
+	ASSERT(t3_win_addstr_h(win2, "bold", &bold) == T3_ERR_SUCCESS);
+	ASSERT(t3_win_addch_h(win2, ' ', &bold) == T3_ERR_SUCCESS);
+	ASSERT(t3_win_addnstr_h(win2, "redxxx", 3, &red) == T3_ERR_SUCCESS);
+	ASSERT(t3_win_addstr_h(win1, " again", &bold) == T3_ERR_SUCCESS);
+	next();
+
+	/* The handles are revalidated after compacting the attributes. */
+	t3_win_del(tmp);
+	ASSERT(t3_term_compact_attrs() == T3_ERR_SUCCESS);
+	t3_win_set_paint(win1, 1, 0);
+	ASSERT(t3_win_addstr_h(win1, "bold", &bold) == T3_ERR_SUCCESS);
+	ASSERT(t3_win_addstr_h(win1, "red", &red) == T3_ERR_SUCCESS);
+	ASSERT(t3_win_addstr(win1, "magenta", T3_ATTR_FG_MAGENTA) == T3_ERR_SUCCESS);
+	t3_win_set_paint(win2, 1, 0);
+	ASSERT(t3_win_addstr_h(win2, "red", &red) == T3_ERR_SUCCESS);
+	next();
+
+	t3_term_redraw();
+	next();
+
+	return 0;
+}
@@ -0,0 +1,53 @@
+static const t3_attr_t attrs[] = {
+	0,
+	T3_ATTR_BOLD,
+	T3_ATTR_BOLD | T3_ATTR_UNDERLINE,
+	T3_ATTR_REVERSE,
+	T3_ATTR_DIM | T3_ATTR_BLINK,
+	T3_ATTR_FG_RED,
+	T3_ATTR_FG_RED | T3_ATTR_BG_BLUE,
+	T3_ATTR_BG_BLUE | T3_ATTR_UNDERLINE,
+	T3_ATTR_FG_DEFAULT | T3_ATTR_BG_GREEN,
+	T3_ATTR_FG_YELLOW | T3_ATTR_BOLD | T3_ATTR_REVERSE,
+	T3_ATTR_ACS | T3_ATTR_FG_CYAN
+};
+
+#define NR_ATTRS ((int) (sizeof(attrs) / sizeof(attrs[0])))
+
+static int test(void) {
+	t3_window_t *win, *other;
+	int i, j;
+
+	ASSERT(win = t3_win_new(NULL, NR_ATTRS, 2 * NR_ATTRS, 1, 1, 0));
+	t3_win_show(win);
+	t3_term_hide_cursor();
+
+	/* Every row switches from one attribute set to each of the others, such that all
+	   transitions between the sets are used. */
+	for (i = 0; i < NR_ATTRS; i++) {
+		t3_win_set_paint(win, i, 0);
+		for (j = 0; j < NR_ATTRS; j++) {
+			t3_win_addch(win, 'a' + i, attrs[i]);
+			t3_win_addch(win, attrs[j] & T3_ATTR_ACS ? 'q' : 'a' + j, attrs[j]);
+		}
+	}
+	next();
+
+	/* Drawing everything again uses the same transitions, which are cached now. */
+	t3_term_redraw();
+	next();
+
+	/* A second window using the sets in a different order, such that the transitions between
+	   lines and windows differ. */
+	ASSERT(other = t3_win_new(NULL, NR_ATTRS, 2 * NR_ATTRS, 1, 30, 0));
+	t3_win_show(other);
+	for (i = 0; i < NR_ATTRS; i++) {
+		t3_win_set_paint(other, i, 0);
+		for (j = 0; j < NR_ATTRS; j++) {
+			t3_win_addch(other, 'a' + j, attrs[NR_ATTRS - 1 - j]);
+			t3_win_addch(other, 'a' + i, attrs[(i + j) % NR_ATTRS]);
+		}
+	}
+	next();
+	return 0;
+}
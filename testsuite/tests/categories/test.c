@@ -0,0 +1,45 @@
+static t3_window_t *win;
+static int line;
+
+static void check(const char *name, const char *str, int expected) {
+	int result;
+
+	t3_win_set_paint(win, line, 0);
+	t3_win_addstr(win, name, 0);
+	t3_win_set_paint(win, line++, 24);
+	t3_win_addch(win, '[', 0);
+	result = t3_win_addstr(win, str, T3_ATTR_UNDERLINE);
+	t3_win_addch(win, ']', 0);
+	ASSERT(result == expected);
+}
+
+static int test(void) {
+	ASSERT(win = t3_win_new(NULL, 20, 60, 2, 2, 0));
+	t3_win_show(win);
+	t3_term_hide_cursor();
+
+	check("Cc (tab)", "a\tb", T3_ERR_NONPRINT);
+	check("Cc (DEL)", "a\x7f" "b", T3_ERR_NONPRINT);
+	check("Cc (U+0085)", "a\xc2\x85" "b", T3_ERR_NONPRINT);
+	check("Cf (U+200B)", "a\xe2\x80\x8b" "b", T3_ERR_NONPRINT);
+	check("Cf (U+FEFF)", "a\xef\xbb\xbf" "b", T3_ERR_NONPRINT);
+	check("Zl (U+2028)", "a\xe2\x80\xa8" "b", T3_ERR_NONPRINT);
+	check("Zp (U+2029)", "a\xe2\x80\xa9" "b", T3_ERR_NONPRINT);
+	check("Co (U+E000)", "a\xee\x80\x80" "b", T3_ERR_NONPRINT);
+	check("Co (U+F0000)", "a\xf3\xb0\x80\x80" "b", T3_ERR_NONPRINT);
+	/* Unassigned code points are not necessarily unprintable. */
+	check("Cn (U+0378)", "a\xcd\xb8" "b", T3_ERR_SUCCESS);
+	check("Cn (U+2FFFF)", "a\xf0\xaf\xbf\xbf" "b", T3_ERR_SUCCESS);
+	check("Mn (U+0301)", "a\xcc\x81" "b", T3_ERR_SUCCESS);
+	check("Me (U+20DD)", "a\xe2\x83\x9d" "b", T3_ERR_SUCCESS);
+	check("Mc (U+0903)", "\xe0\xa4\x95\xe0\xa4\x83" "b", T3_ERR_SUCCESS);
+	check("Lo (U+4E00)", "a\xe4\xb8\x80" "b", T3_ERR_SUCCESS);
+	check("Zs (U+3000)", "a\xe3\x80\x80" "b", T3_ERR_SUCCESS);
+
+	ASSERT(t3_term_can_draw("abc", 3));
+	ASSERT(t3_term_can_draw("\xc3\xa9", 2));
+	ASSERT(t3_term_can_draw("", 0));
+	next();
+
+	return 0;
+}
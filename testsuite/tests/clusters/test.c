@@ -0,0 +1,72 @@
+static t3_window_t *win, *narrow;
+static int line;
+
+static void show(const char *name, const char *str) {
+	char buffer[16];
+
+	t3_win_set_paint(win, line, 0);
+	t3_win_addstr(win, name, 0);
+	sprintf(buffer, "%d", (int) t3_term_strcwidth(str));
+	t3_win_set_paint(win, line, 20);
+	t3_win_addstr(win, buffer, 0);
+	t3_win_set_paint(win, line++, 24);
+	t3_win_addch(win, '[', 0);
+	t3_win_addstr(win, str, T3_ATTR_UNDERLINE);
+	t3_win_addch(win, ']', 0);
+}
+
+static int test(void) {
+	int i;
+
+	ASSERT(win = t3_win_new(NULL, 18, 50, 1, 2, 0));
+	t3_win_show(win);
+	t3_term_hide_cursor();
+
+	/* GB9: extending characters and ZWJ. */
+	show("GB9 extend", "e\xcc\x81\xcc\xa3" "x");
+	show("GB9 ZWJ", "a\xe2\x80\x8d" "b");
+	/* GB9a: spacing marks. */
+	show("GB9a spacing mark", "\xe0\xa4\x95\xe0\xa4\x83");
+	/* GB9b: prepended concatenation marks. */
+	show("GB9b prepend", "\xe0\xb5\x8e\xe0\xb4\x95");
+	/* GB11: emoji ZWJ sequences, and emoji modifiers. */
+	show("GB11 ZWJ sequence", "\xf0\x9f\x91\xa8\xe2\x80\x8d\xf0\x9f\x92\xbb" "x");
+	show("GB11 long sequence", "\xf0\x9f\x91\xa8\xe2\x80\x8d\xf0\x9f\x91\xa9\xe2\x80\x8d\xf0\x9f\x91\xa7\xe2\x80\x8d\xf0\x9f\x91\xa6");
+	show("emoji modifier", "\xf0\x9f\x91\x8d\xf0\x9f\x8f\xbd" "x");
+	/* GB12/GB13: regional indicators pair up. */
+	show("GB12 flags", "\xf0\x9f\x87\xb3\xf0\x9f\x87\xb1\xf0\x9f\x87\xa9\xf0\x9f\x87\xaa");
+	show("GB12 odd flags", "\xf0\x9f\x87\xb3\xf0\x9f\x87\xb1\xf0\x9f\x87\xa9" "x");
+	/* GB6-GB8: Hangul syllables. */
+	show("Hangul L V T", "\xe1\x84\x80\xe1\x85\xa1\xe1\x86\xa8" "x");
+	show("Hangul LV T", "\xea\xb0\x80\xe1\x86\xa8" "x");
+	show("Hangul LVT V", "\xea\xb0\x81\xe1\x85\xa1" "x");
+	show("Hangul L L L", "\xe1\x84\x80\xe1\x84\x80\xe1\x84\x80");
+	/* Clusters that can not be drawn as a unit. */
+	show("leading mark", "\xcc\x81" "a");
+	show("with control", "a\xcc\x81\x01\xcc\x82" "b");
+	next();
+
+	/* Clusters crossing the right edge of a window are dropped as a whole, including any
+	   combining characters. */
+	ASSERT(narrow = t3_win_new(NULL, 6, 6, 1, 60, 0));
+	t3_win_show(narrow);
+	for (i = 0; i < 6; i++) {
+		t3_win_set_paint(narrow, i, 0);
+		t3_win_addstr(narrow, "......", T3_ATTR_FG_BLUE);
+	}
+	t3_win_set_paint(narrow, 0, 5);
+	ASSERT(t3_win_addstr(narrow, "e\xcc\x81" "x", 0) == T3_ERR_SUCCESS);
+	t3_win_set_paint(narrow, 1, 5);
+	ASSERT(t3_win_addstr(narrow, "\xe4\xb8\x80\xcc\x81" "x", 0) == T3_ERR_SUCCESS);
+	t3_win_set_paint(narrow, 2, 4);
+	ASSERT(t3_win_addstr(narrow, "\xf0\x9f\x91\xa8\xe2\x80\x8d\xf0\x9f\x92\xbb", 0) == T3_ERR_SUCCESS);
+	t3_win_set_paint(narrow, 3, 5);
+	ASSERT(t3_win_addstr(narrow, "\xf0\x9f\x91\xa8\xe2\x80\x8d\xf0\x9f\x92\xbb", 0) == T3_ERR_SUCCESS);
+	t3_win_set_paint(narrow, 4, 5);
+	ASSERT(t3_win_addstr(narrow, "\xf0\x9f\x87\xb3\xf0\x9f\x87\xb1", 0) == T3_ERR_SUCCESS);
+	t3_win_set_paint(narrow, 5, 5);
+	ASSERT(t3_win_addstr(narrow, "\xea\xb0\x80\xe1\x86\xa8", 0) == T3_ERR_SUCCESS);
+	next();
+
+	return 0;
+}
@@ -0,0 +1,93 @@
+static t3_window_t *win;
+static int line;
+
+static size_t append(char *dst, const char *src) {
+	size_t i;
+
+	for (i = 0; src[i] != 0; i++) {
+		dst[i] = src[i];
+	}
+	return i;
+}
+
+static void show(const char *str, size_t n, size_t column) {
+	char buffer[80];
+	size_t offset, width;
+
+	offset = t3_term_strncolumn_offset(str, n, column, &width);
+	t3_win_set_paint(win, line++, 0);
+	t3_win_addnstr(win, str, offset, T3_ATTR_REVERSE);
+	t3_win_addnstr(win, str + offset, n - offset, 0);
+	sprintf(buffer, " %d: offset %d width %d", (int) column, (int) offset, (int) width);
+	t3_win_set_paint(win, line - 1, 20);
+	t3_win_addstr(win, buffer, 0);
+}
+
+static int test(void) {
+	/* "a", U+4E00, "b", "e" with a combining acute accent, "c". */
+	static const char mixed[] = "a\xe4\xb8\x80" "be\xcc\x81" "c";
+	/* A conjoining Jamo syllable, followed by "d". */
+	static const char jamo[] = "\xe1\x84\x80\xe1\x85\xa1\xe1\x86\xa8" "d";
+	char long_str[3000];
+	t3_term_column_index_t *index;
+	size_t i, fill = 0, width;
+
+	ASSERT(win = t3_win_new(NULL, 20, 76, 2, 2, 0));
+	t3_win_show(win);
+	t3_term_hide_cursor();
+
+	for (i = 0; i <= 6; i++) {
+		show(mixed, sizeof(mixed) - 1, i);
+	}
+	show(jamo, sizeof(jamo) - 1, 1);
+	show(jamo, sizeof(jamo) - 1, 2);
+
+	/* A double width character straddling the column is not included. */
+	ASSERT(t3_term_strncolumn_offset(mixed, sizeof(mixed) - 1, 2, &width) == 1 && width == 1);
+	/* Combining characters stay with the character they combine with. */
+	ASSERT(t3_term_strncolumn_offset(mixed, sizeof(mixed) - 1, 5, &width) == 8 && width == 5);
+	ASSERT(t3_term_strncolumn_offset(mixed, sizeof(mixed) - 1, 5, NULL) == 8);
+
+	ASSERT(t3_term_str_columns_until(mixed, sizeof(mixed) - 1, 0) == 0);
+	ASSERT(t3_term_str_columns_until(mixed, sizeof(mixed) - 1, 1) == 1);
+	/* Offsets in the middle of a UTF-8 sequence refer to the start of the sequence. */
+	ASSERT(t3_term_str_columns_until(mixed, sizeof(mixed) - 1, 2) == 1);
+	ASSERT(t3_term_str_columns_until(mixed, sizeof(mixed) - 1, 4) == 3);
+	ASSERT(t3_term_str_columns_until(mixed, sizeof(mixed) - 1, 7) == 5);
+	ASSERT(t3_term_str_columns_until(mixed, sizeof(mixed) - 1, 100) == 6);
+	ASSERT(t3_term_str_columns_until(jamo, sizeof(jamo) - 1, 6) == 2);
+	ASSERT(t3_term_str_columns_until(jamo, sizeof(jamo) - 1, 9) == 2);
+
+	/* The index gives the same results as the direct functions, including around the
+	   checkpoints and for Jamo sequences crossing them. */
+	for (i = 0; fill + sizeof(jamo) + sizeof(mixed) < sizeof(long_str); i++) {
+		if (i % 7 == 3) {
+			fill += append(long_str + fill, jamo);
+		} else {
+			fill += append(long_str + fill, mixed);
+		}
+	}
+	ASSERT(index = t3_term_column_index_new(long_str, fill));
+	for (i = 0; i <= t3_term_strncwidth(long_str, fill) + 2; i++) {
+		size_t index_width;
+		ASSERT(t3_term_column_index_offset(index, i, &index_width) ==
+			t3_term_strncolumn_offset(long_str, fill, i, &width));
+		ASSERT(index_width == width);
+	}
+	for (i = 0; i <= fill + 2; i++) {
+		ASSERT(t3_term_column_index_columns(index, i) == t3_term_str_columns_until(long_str, fill, i));
+	}
+	t3_term_column_index_free(index);
+	t3_term_column_index_free(NULL);
+
+	ASSERT(index = t3_term_column_index_new("", 0));
+	ASSERT(t3_term_column_index_offset(index, 10, &width) == 0 && width == 0);
+	ASSERT(t3_term_column_index_columns(index, 10) == 0);
+	t3_term_column_index_free(index);
+
+	t3_win_set_paint(win, line++, 0);
+	t3_win_addstr(win, "index checks passed", 0);
+	next();
+
+	return 0;
+}
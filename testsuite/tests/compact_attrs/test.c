@@ -0,0 +1,41 @@
+static t3_attr_t color(int i) {
+	return T3_ATTR_FG(i % 8) | T3_ATTR_BG((i / 8) % 8) | ((i / 64) % 2 ? T3_ATTR_BOLD : 0);
+}
+
+static int test(void) {
+	t3_window_t *win, *hidden, *tmp;
+	int i;
+
+	/* Use many different attributes, such that the attribute map has to grow. */
+	ASSERT(tmp = t3_win_new(NULL, 2, 80, 20, 0, 0));
+	for (i = 0; i < 128; i++)
+		t3_win_addch(tmp, 'x', color(i) | T3_ATTR_UNDERLINE);
+
+	ASSERT(win = t3_win_new(NULL, 8, 64, 2, 2, 0));
+	ASSERT(hidden = t3_win_new(NULL, 1, 10, 12, 2, 0));
+	t3_win_addstr(hidden, "hidden", T3_ATTR_REVERSE | T3_ATTR_FG_GREEN);
+	for (i = 0; i < 128; i++) {
+		t3_win_set_paint(win, i / 32, 2 * (i % 32));
+		t3_win_addstr(win, "ab", color(i));
+	}
+	t3_win_show(win);
+	t3_term_hide_cursor();
+	next();
+
+	/* The attributes only used in the deleted window are removed. As the attributes of the
+	   terminal contents are also renumbered, the next update should not draw anything. */
+	t3_win_del(tmp);
+	ASSERT(t3_term_compact_attrs() == T3_ERR_SUCCESS);
+	t3_win_set_paint(win, 6, 0);
+	t3_win_addstr(win, "new", T3_ATTR_FG_CYAN | T3_ATTR_UNDERLINE);
+	next();
+
+	/* Attributes used in hidden windows are kept. */
+	t3_win_show(hidden);
+	next();
+
+	t3_term_redraw();
+	next();
+
+	return 0;
+}
@@ -0,0 +1,35 @@
+static int test(void) {
+	t3_window_t *win, *tmp;
+	int i;
+
+	/* Use some attributes in a window which is deleted again, such that compacting
+	   the attributes renumbers the attributes used in the log window. */
+	ASSERT(tmp = t3_win_new(NULL, 1, 10, 0, 0, 0));
+	t3_win_addstr(tmp, "a", T3_ATTR_FG_BLUE);
+	t3_win_addstr(tmp, "b", T3_ATTR_FG_GREEN | T3_ATTR_UNDERLINE);
+	t3_win_addstr(tmp, "c", T3_ATTR_BG_CYAN);
+	t3_win_del(tmp);
+
+	ASSERT(win = t3_win_new_log(NULL, 6, 30, 2, 5, 0, 100));
+	t3_win_show(win);
+	t3_term_hide_cursor();
+	for (i = 0; i < 8; i++) {
+		ASSERT(t3_win_log_append(win, i & 1 ? "bold yellow" : "red", i & 1 ? 11 : 3,
+			i & 1 ? T3_ATTR_FG_YELLOW | T3_ATTR_BOLD : T3_ATTR_FG_RED) == T3_ERR_SUCCESS);
+	}
+	next();
+
+	ASSERT(t3_term_compact_attrs() == T3_ERR_SUCCESS);
+	ASSERT(t3_win_log_append(win, "magenta", 7, T3_ATTR_FG_MAGENTA) == T3_ERR_SUCCESS);
+	next();
+
+	/* Show the lines from the history which were scrolled out of view before compacting. */
+	t3_win_log_set_offset(win, 3);
+	next();
+
+	ASSERT(t3_win_log_append(win, "blue", 4, T3_ATTR_FG_BLUE) == T3_ERR_SUCCESS);
+	t3_win_log_set_offset(win, 0);
+	next();
+
+	return 0;
+}
@@ -0,0 +1,44 @@
+static int test(void) {
+	t3_window_t *src, *dst, *grid, *log;
+
+	ASSERT(src = t3_win_new(NULL, 4, 16, 1, 2, 0));
+	ASSERT(dst = t3_win_new(NULL, 6, 30, 7, 2, 0));
+	ASSERT(grid = t3_win_new_grid(NULL, 6, 30, 7, 40, 0));
+	ASSERT(log = t3_win_new_log(NULL, 3, 16, 1, 40, 0, 10));
+	t3_win_set_default_attrs(src, T3_ATTR_BG_BLUE);
+	t3_win_show(src);
+	t3_win_show(dst);
+	t3_win_show(grid);
+	t3_win_show(log);
+	t3_term_hide_cursor();
+
+	t3_win_addstr(src, "abＱc̃defghij", T3_ATTR_BOLD);
+	t3_win_set_paint(src, 1, 2);
+	t3_win_addstr(src, "red", T3_ATTR_FG_RED);
+	t3_win_set_paint(src, 2, 0);
+	t3_win_addstr(src, "0123456789", 0);
+	ASSERT(t3_win_log_append(log, "log 1", 5, T3_ATTR_UNDERLINE) == T3_ERR_SUCCESS);
+	ASSERT(t3_win_log_append(log, "log 2", 5, 0) == T3_ERR_SUCCESS);
+	next();
+
+	/* Copy the region cutting the double width character, including undrawn cells. */
+	ASSERT(t3_win_copy_region(src, 0, 3, dst, 0, 0, 4, 14));
+	ASSERT(t3_win_copy_region(src, 0, 3, grid, 0, 0, 4, 14));
+	next();
+
+	/* Copy to a position where part of the region is clipped. */
+	ASSERT(t3_win_copy_region(src, 0, 0, dst, 4, 24, 3, 16));
+	ASSERT(t3_win_copy_region(src, 0, 0, grid, 4, 24, 3, 16));
+	next();
+
+	/* Overlapping copies within the same window. */
+	ASSERT(t3_win_copy_region(src, 2, 0, src, 2, 3, 1, 10));
+	ASSERT(t3_win_copy_region(src, 0, 4, src, 1, 0, 2, 8));
+	next();
+
+	ASSERT(t3_win_copy_region(log, 0, 0, dst, 5, 0, 3, 16));
+	ASSERT(!t3_win_copy_region(src, 0, 0, log, 0, 0, 1, 5));
+	next();
+
+	return 0;
+}
@@ -0,0 +1,33 @@
+static void draw(t3_window_t *win) {
+	ASSERT(t3_win_fill_rect(win, 0, 0, 3, 12, ".", T3_ATTR_FG_BLUE) == T3_ERR_SUCCESS);
+	ASSERT(t3_win_fill_rect(win, 1, 2, 4, 7, "Ｑ", T3_ATTR_BOLD) == T3_ERR_SUCCESS);
+	ASSERT(t3_win_box(win, 5, 0, 4, 12, T3_ATTR_FG_RED) == T3_ERR_SUCCESS);
+	ASSERT(t3_win_hline(win, 7, 1, 10, 0) == T3_ERR_SUCCESS);
+	ASSERT(t3_win_vline(win, 6, 5, 2, 0) == T3_ERR_SUCCESS);
+	t3_win_set_paint(win, 9, 0);
+	ASSERT(t3_win_addchrep(win, '-', 0, 5) == T3_ERR_SUCCESS);
+	ASSERT(t3_win_addstrrep(win, "ab", T3_ATTR_UNDERLINE, 3) == T3_ERR_SUCCESS);
+	ASSERT(t3_win_addnstrrep(win, "c̃d", 3, 0, 2) == T3_ERR_SUCCESS);
+	/* Rectangles extending outside the window are clipped. */
+	ASSERT(t3_win_fill_rect(win, 10, 10, 5, 5, "x", T3_ATTR_REVERSE) == T3_ERR_SUCCESS);
+}
+
+static int test(void) {
+	t3_window_t *win, *grid;
+
+	ASSERT(win = t3_win_new(NULL, 12, 16, 2, 2, 0));
+	ASSERT(grid = t3_win_new_grid(NULL, 12, 16, 2, 22, 0));
+	t3_win_show(win);
+	t3_win_show(grid);
+	t3_term_hide_cursor();
+	draw(win);
+	draw(grid);
+	next();
+
+	/* Overwrite part of the double width characters. */
+	ASSERT(t3_win_fill_rect(win, 2, 3, 2, 3, " ", 0) == T3_ERR_SUCCESS);
+	ASSERT(t3_win_fill_rect(grid, 2, 3, 2, 3, " ", 0) == T3_ERR_SUCCESS);
+	next();
+
+	return 0;
+}
@@ -0,0 +1,61 @@
+static void draw(t3_window_t *win) {
+	t3_win_set_paint(win, 0, 0);
+	t3_win_addstr(win, "abＱc̃defghijk", 0);
+	t3_win_set_paint(win, 1, 2);
+	t3_win_addstr(win, "bold", T3_ATTR_BOLD);
+	t3_win_addstr(win, "red", T3_ATTR_FG_RED);
+	ASSERT(t3_win_put_cell(win, 2, 0, "x", 1, T3_ATTR_UNDERLINE) == T3_ERR_SUCCESS);
+	ASSERT(t3_win_put_cell(win, 2, 3, "Ｑ", 3, 0) == T3_ERR_SUCCESS);
+	ASSERT(t3_win_put_cell(win, 2, 6, "c̃", 3, T3_ATTR_FG_GREEN) == T3_ERR_SUCCESS);
+	ASSERT(t3_win_put_cell(win, 2, 8, "xy", 2, 0) == T3_ERR_BAD_ARG);
+	/* Overwrite the second half of a double width character. */
+	ASSERT(t3_win_put_cell(win, 0, 3, "-", 1, 0) == T3_ERR_SUCCESS);
+	t3_win_box(win, 3, 0, 3, 8, 0);
+	/* Conjoining Jamo sequences are followed by a zero-width non-joiner, such that they are not
+	   joined with the next cell on the terminal. */
+	ASSERT(t3_win_put_cell(win, 6, 0, "\xea\xb0\x80", 3, 0) == T3_ERR_SUCCESS);
+	ASSERT(t3_win_put_cell(win, 6, 2, "\xe1\x84\x80\xe1\x85\xa1", 6, 0) == T3_ERR_SUCCESS);
+	ASSERT(t3_win_put_cell(win, 6, 4, "\xea\xb0\x81", 3, 0) == T3_ERR_SUCCESS);
+}
+
+static int test(void) {
+	t3_window_t *win, *grid, *tmp;
+
+	/* Use some attributes in a window which is deleted again, such that compacting
+	   the attributes renumbers the attributes used in the other windows. */
+	ASSERT(tmp = t3_win_new(NULL, 1, 10, 0, 0, 0));
+	t3_win_addstr(tmp, "a", T3_ATTR_FG_BLUE);
+	t3_win_addstr(tmp, "b", T3_ATTR_FG_YELLOW | T3_ATTR_UNDERLINE);
+
+	ASSERT(win = t3_win_new(NULL, 8, 15, 2, 2, 0));
+	ASSERT(grid = t3_win_new_grid(NULL, 8, 15, 2, 20, 0));
+	t3_win_show(win);
+	t3_win_show(grid);
+	t3_term_hide_cursor();
+	draw(win);
+	draw(grid);
+	next();
+
+	/* Both kinds of windows should show the same after overwriting parts of them. */
+	t3_win_set_paint(win, 0, 5);
+	t3_win_addstr(win, "Ｑ", T3_ATTR_REVERSE);
+	t3_win_set_paint(grid, 0, 5);
+	t3_win_addstr(grid, "Ｑ", T3_ATTR_REVERSE);
+	t3_win_set_paint(win, 1, 4);
+	t3_win_clrtoeol(win);
+	t3_win_set_paint(grid, 1, 4);
+	t3_win_clrtoeol(grid);
+	next();
+
+	t3_win_del(tmp);
+	ASSERT(t3_term_compact_attrs() == T3_ERR_SUCCESS);
+	ASSERT(t3_win_put_cell(win, 7, 0, "m", 1, T3_ATTR_FG_MAGENTA) == T3_ERR_SUCCESS);
+	ASSERT(t3_win_put_cell(grid, 7, 0, "m", 1, T3_ATTR_FG_MAGENTA) == T3_ERR_SUCCESS);
+	next();
+
+	/* Drawing the windows again should not change anything. */
+	t3_term_redraw();
+	next();
+
+	return 0;
+}
@@ -0,0 +1,59 @@
+static int test(void) {
+	t3_window_t *win, *popup, *child, *copy;
+	int i, j;
+
+	ASSERT(win = t3_win_new(NULL, 10, 40, 1, 2, 0));
+	t3_win_show(win);
+	t3_term_hide_cursor();
+	/* Lines drawn out of order, leaving some lines untouched. */
+	for (i = 9; i >= 0; i -= 3) {
+		t3_win_set_paint(win, i, i);
+		t3_win_addstr(win, "line", 0);
+	}
+	/* A line that outgrows the space it was given first. */
+	t3_win_set_paint(win, 1, 0);
+	t3_win_addstr(win, "x", 0);
+	for (j = 0; j < 38; j++) {
+		t3_win_addstr(win, "e\xcc\x81\xcc\x82\xcc\x83", j % 2 ? T3_ATTR_BOLD : T3_ATTR_UNDERLINE);
+	}
+	next();
+
+	/* Operations on lines that have never been drawn on. */
+	t3_win_set_paint(win, 2, 5);
+	t3_win_clrtoeol(win);
+	t3_win_set_paint(win, 7, 0);
+	t3_win_clrtobot(win);
+	ASSERT(copy = t3_win_new(NULL, 4, 20, 14, 2, 0));
+	t3_win_set_default_attrs(copy, T3_ATTR_BG_BLUE);
+	t3_win_show(copy);
+	ASSERT(t3_win_copy_region(win, 1, 0, copy, 0, 0, 4, 20));
+	t3_win_scroll(win, 2);
+	next();
+
+	/* Growing a window adds undrawn lines, shrinking it releases them. */
+	ASSERT(t3_win_resize(win, 14, 40));
+	t3_win_set_paint(win, 12, 0);
+	t3_win_addstr(win, "new line", T3_ATTR_REVERSE);
+	next();
+
+	ASSERT(t3_win_resize(win, 6, 30));
+	next();
+
+	/* Popups created and deleted on top of other windows. */
+	for (i = 0; i < 3; i++) {
+		ASSERT(popup = t3_win_new(NULL, 6, 20, 3 + i, 30 + i * 10, -1));
+		ASSERT(child = t3_win_new(popup, 2, 10, 2, 2, 0));
+		t3_win_show(popup);
+		t3_win_show(child);
+		t3_win_box(popup, 0, 0, 6, 20, 0);
+		t3_win_addstr(child, "child", T3_ATTR_BOLD);
+		t3_term_update();
+		if (i != 1) {
+			t3_win_del(popup);
+			t3_win_del(child);
+		}
+	}
+	next();
+
+	return 0;
+}
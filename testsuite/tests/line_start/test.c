@@ -0,0 +1,23 @@
+static int test(void) {
+	t3_window_t *win;
+	int i;
+
+	ASSERT(win = t3_win_new(NULL, 4, 20, 2, 2, 0));
+	t3_win_show(win);
+	t3_term_hide_cursor();
+
+	for (i = 0; i < 4; i++) {
+		t3_win_set_paint(win, i, 0);
+		t3_win_addstr(win, "abcdefghijklmnopqrst", i == 2 ? T3_ATTR_REVERSE : 0);
+	}
+	next();
+
+	/* Moving the window to the right must blank the start of the lines. */
+	t3_win_move(win, 2, 12);
+	next();
+
+	t3_win_move(win, 2, 40);
+	next();
+
+	return 0;
+}
@@ -0,0 +1,54 @@
+static int test(void) {
+	t3_window_t *win;
+	char buffer[64];
+	int i, length;
+
+	ASSERT(win = t3_win_new_log(NULL, 5, 30, 2, 5, 0, 10));
+	t3_win_show(win);
+	t3_term_hide_cursor();
+	ASSERT(t3_win_log_append(win, "first", 5, 0) == T3_ERR_SUCCESS);
+	ASSERT(t3_win_log_append(win, "abＱc̃def", 10, T3_ATTR_BOLD) == T3_ERR_SUCCESS);
+	ASSERT(t3_win_log_append(win, "", 0, 0) == T3_ERR_SUCCESS);
+	/* Text which does not fit the width of the window is discarded. */
+	ASSERT(t3_win_log_append(win, "0123456789012345678901234567890123456789", 40,
+		T3_ATTR_UNDERLINE) == T3_ERR_SUCCESS);
+	/* Lines with control characters are added, but the result indicates the problem. */
+	ASSERT(t3_win_log_append(win, "tab\there", 8, 0) == T3_ERR_NONPRINT);
+	ASSERT(t3_win_log_get_lines(win) == 5);
+	next();
+
+	/* Only the last 10 lines are kept. */
+	for (i = 0; i < 12; i++) {
+		length = sprintf(buffer, "line %d", i);
+		ASSERT(t3_win_log_append(win, buffer, length, i & 1 ? T3_ATTR_FG_RED : 0) == T3_ERR_SUCCESS);
+	}
+	ASSERT(t3_win_log_get_lines(win) == 10);
+	next();
+
+	t3_win_log_set_offset(win, 3);
+	ASSERT(t3_win_log_get_offset(win) == 3);
+	next();
+
+	/* The view stays at the same lines when appending while scrolled back. */
+	ASSERT(t3_win_log_append(win, "line 12", 7, 0) == T3_ERR_SUCCESS);
+	ASSERT(t3_win_log_get_offset(win) == 4);
+
+	t3_win_log_set_offset(win, 100);
+	ASSERT(t3_win_log_get_offset(win) == 5);
+	next();
+
+	t3_win_scroll(win, 2);
+	ASSERT(t3_win_log_get_offset(win) == 3);
+	next();
+
+	t3_win_log_set_offset(win, 0);
+	t3_win_resize(win, 3, 30);
+	next();
+
+	t3_win_log_clear(win);
+	ASSERT(t3_win_log_get_lines(win) == 0);
+	ASSERT(t3_win_log_append(win, "after clear", 11, 0) == T3_ERR_SUCCESS);
+	next();
+
+	return 0;
+}
@@ -0,0 +1,63 @@
+static int test(void) {
+	t3_window_t *win;
+	t3_memory_usage_t usage, drawn, cleared, compacted, term_before, term_after;
+	t3_memory_usage_t term_output;
+	char buffer[64];
+	int i;
+
+	ASSERT(win = t3_win_new(NULL, 20, 60, 2, 2, 0));
+	t3_win_show(win);
+	t3_term_hide_cursor();
+	t3_win_get_memory_usage(win, &usage);
+	for (i = 0; i < 20; i++) {
+		sprintf(buffer, "line %d with some text to fill the line buffer", i);
+		t3_win_set_paint(win, i, 0);
+		t3_win_addstr(win, buffer, i & 1 ? T3_ATTR_BOLD : 0);
+	}
+	t3_win_get_memory_usage(win, &drawn);
+	ASSERT(drawn.used > usage.used);
+	ASSERT(drawn.allocated >= drawn.used);
+	next();
+
+	/* Clearing lines reduces the used memory, but not the allocated memory. */
+	t3_win_set_paint(win, 3, 0);
+	t3_win_clrtobot(win);
+	t3_win_get_memory_usage(win, &cleared);
+	ASSERT(cleared.used < drawn.used);
+	ASSERT(cleared.allocated == drawn.allocated);
+	next();
+
+	/* Compacting releases the unused memory without changing the contents. */
+	t3_win_compact(win);
+	t3_win_get_memory_usage(win, &compacted);
+	ASSERT(compacted.used == cleared.used);
+	ASSERT(compacted.allocated < cleared.allocated);
+	ASSERT(compacted.allocated >= compacted.used);
+	t3_win_set_paint(win, 4, 0);
+	t3_win_addstr(win, "drawn after compacting", T3_ATTR_UNDERLINE);
+	next();
+
+	t3_term_get_memory_usage(&term_before);
+	ASSERT(term_before.allocated >= term_before.used);
+	t3_win_get_memory_usage(win, &usage);
+	ASSERT(term_before.used > usage.used);
+	t3_term_compact();
+	t3_term_get_memory_usage(&term_after);
+	ASSERT(term_after.allocated <= term_before.allocated);
+	t3_term_redraw();
+	next();
+
+	/* Text written outside of t3_term_update does not make the memory usage grow. */
+	t3_term_get_memory_usage(&term_before);
+	for (i = 0; i < 200; i++) {
+		t3_term_puts(" ");
+		t3_term_putp("");
+	}
+	t3_term_get_memory_usage(&term_output);
+	ASSERT(term_output.used == term_before.used);
+	ASSERT(term_output.allocated == term_before.allocated);
+	t3_term_redraw();
+	next();
+
+	return 0;
+}
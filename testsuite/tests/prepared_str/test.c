@@ -0,0 +1,48 @@
+static int test(void) {
+	t3_window_t *win1, *win2, *tmp;
+	t3_prepared_str_t *label, *wide, *combining;
+
+	/* Use some attributes in a window which is deleted again, such that compacting
+	   the attributes renumbers the attributes of the prepared strings. */
+	ASSERT(tmp = t3_win_new(NULL, 1, 10, 0, 0, 0));
+	t3_win_addstr(tmp, "a", T3_ATTR_FG_BLUE);
+	t3_win_addstr(tmp, "b", T3_ATTR_FG_YELLOW | T3_ATTR_UNDERLINE);
+
+	ASSERT(win1 = t3_win_new(NULL, 4, 20, 2, 2, 0));
+	ASSERT(win2 = t3_win_new(NULL, 4, 20, 2, 30, 0));
+	t3_win_set_default_attrs(win2, T3_ATTR_BG_BLUE);
+	t3_win_show(win1);
+	t3_win_show(win2);
+	t3_term_hide_cursor();
+
+	ASSERT(label = t3_prepare_str("label", 5, T3_ATTR_BOLD));
+	ASSERT(wide = t3_prepare_str("abＱc̃d", 9, T3_ATTR_FG_RED));
+	/* Strings starting with a zero-width character are drawn with t3_win_addnstr. */
+	ASSERT(combining = t3_prepare_str("\xcc\x83x", 3, 0));
+	ASSERT(t3_prepared_str_get_width(label) == 5);
+	ASSERT(t3_prepared_str_get_width(wide) == 6);
+
+	ASSERT(t3_win_add_prepared(win1, label) == T3_ERR_SUCCESS);
+	ASSERT(t3_win_add_prepared(win1, wide) == T3_ERR_SUCCESS);
+	ASSERT(t3_win_add_prepared(win1, combining) == T3_ERR_SUCCESS);
+	ASSERT(t3_win_add_prepared(win2, label) == T3_ERR_SUCCESS);
+	ASSERT(t3_win_add_prepared(win2, wide) == T3_ERR_SUCCESS);
+	/* Strings that do not fit are clipped. */
+	t3_win_set_paint(win1, 1, 16);
+	ASSERT(t3_win_add_prepared(win1, wide) == T3_ERR_SUCCESS);
+	next();
+
+	t3_win_del(tmp);
+	ASSERT(t3_term_compact_attrs() == T3_ERR_SUCCESS);
+	t3_win_set_paint(win1, 2, 0);
+	ASSERT(t3_win_add_prepared(win1, wide) == T3_ERR_SUCCESS);
+	ASSERT(t3_win_addstr(win1, "magenta", T3_ATTR_FG_MAGENTA) == T3_ERR_SUCCESS);
+	t3_win_set_paint(win2, 2, 0);
+	ASSERT(t3_win_add_prepared(win2, label) == T3_ERR_SUCCESS);
+	next();
+
+	t3_prepared_str_free(label);
+	t3_prepared_str_free(wide);
+	t3_prepared_str_free(combining);
+	return 0;
+}
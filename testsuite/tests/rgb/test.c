@@ -0,0 +1,38 @@
+static int test(void) {
+	t3_window_t *win;
+	t3_attr_ext_t attr;
+	t3_attr_handle_t handle;
+	int i;
+
+	ASSERT(win = t3_win_new(NULL, 6, 64, 2, 2, 0));
+	t3_win_show(win);
+	t3_term_hide_cursor();
+
+	attr.attr = T3_ATTR_FG_RGB;
+	for (i = 0; i < 32; i++) {
+		attr.fg_rgb = T3_RGB(i * 8, 255 - i * 8, 128);
+		ASSERT(t3_win_addnstr_ext(win, "#", 1, &attr) == T3_ERR_SUCCESS);
+	}
+	t3_win_set_paint(win, 1, 0);
+	attr.attr = T3_ATTR_FG_RGB | T3_ATTR_BG_RGB | T3_ATTR_BOLD;
+	attr.fg_rgb = T3_RGB(255, 255, 255);
+	attr.bg_rgb = T3_RGB(0, 0, 160);
+	ASSERT(t3_win_addnstr_ext(win, "white on blue", 13, &attr) == T3_ERR_SUCCESS);
+	/* The RGB values are ignored if the color is not set to T3_ATTR_FG_RGB or T3_ATTR_BG_RGB. */
+	attr.attr = T3_ATTR_FG_RED | T3_ATTR_BG_RGB;
+	attr.fg_rgb = T3_RGB(0, 255, 0);
+	attr.bg_rgb = T3_RGB(255, 255, 0);
+	ASSERT(t3_win_addnstr_ext(win, " red on yellow", 14, &attr) == T3_ERR_SUCCESS);
+	next();
+
+	attr.attr = T3_ATTR_BG_RGB;
+	attr.bg_rgb = T3_RGB(192, 0, 192);
+	handle = t3_win_resolve_attr_ext(win, &attr);
+	t3_win_set_paint(win, 3, 0);
+	ASSERT(t3_win_addstr_h(win, "purple", &handle) == T3_ERR_SUCCESS);
+	ASSERT(t3_term_compact_attrs() == T3_ERR_SUCCESS);
+	ASSERT(t3_win_addstr_h(win, " background", &handle) == T3_ERR_SUCCESS);
+	next();
+
+	return 0;
+}
@@ -0,0 +1,48 @@
+static int test(void) {
+	t3_window_t *win, *narrow;
+	char buffer[32];
+	int i;
+
+	ASSERT(win = t3_win_new(NULL, 10, 80, 2, 0, 10));
+	ASSERT(narrow = t3_win_new(NULL, 6, 20, 14, 5, 10));
+	t3_win_show(win);
+	t3_win_show(narrow);
+	t3_term_hide_cursor();
+	for (i = 0; i < 10; i++) {
+		sprintf(buffer, "line %d", i);
+		t3_win_set_paint(win, i, 2 * i);
+		t3_win_addstr(win, buffer, i & 1 ? T3_ATTR_BOLD : 0);
+	}
+	for (i = 0; i < 6; i++) {
+		sprintf(buffer, "narrow %d", i);
+		t3_win_set_paint(narrow, i, i);
+		t3_win_addstr(narrow, buffer, 0);
+	}
+	next();
+
+	/* Scrolling a full width window can use the scrolling region of the terminal. */
+	t3_win_scroll(win, 3);
+	for (i = 7; i < 10; i++) {
+		sprintf(buffer, "new line %d", i);
+		t3_win_set_paint(win, i, 0);
+		t3_win_addstr(win, buffer, T3_ATTR_UNDERLINE);
+	}
+	next();
+
+	t3_win_scroll(win, -2);
+	t3_win_set_paint(win, 0, 0);
+	t3_win_addstr(win, "top", 0);
+	next();
+
+	/* A window which does not span the full width is drawn again. */
+	t3_win_scroll(narrow, 2);
+	t3_win_set_paint(narrow, 5, 0);
+	t3_win_addstr(narrow, "bottom", 0);
+	next();
+
+	/* Scrolling by more than the height clears the window. */
+	t3_win_scroll(win, 12);
+	next();
+
+	return 0;
+}
@@ -0,0 +1,44 @@
+static int test(void) {
+	t3_window_t *win, *line, *tall;
+	char buffer[32];
+	int i;
+
+	ASSERT(win = t3_win_new(NULL, 6, 30, 2, 2, 0));
+	ASSERT(line = t3_win_new(NULL, 1, 40, 0, 0, 0));
+	ASSERT(tall = t3_win_new(NULL, 2, 30, 0, 0, 0));
+	t3_win_show(win);
+	t3_term_hide_cursor();
+	for (i = 0; i < 6; i++) {
+		sprintf(buffer, "old line %d", i);
+		t3_win_set_paint(win, i, 0);
+		t3_win_addstr(win, buffer, 0);
+	}
+	next();
+
+	/* Build new lines separately and replace the lines of the window with them. */
+	for (i = 0; i < 6; i += 2) {
+		sprintf(buffer, "new line %d", i);
+		t3_win_set_paint(line, 0, i);
+		t3_win_addstr(line, buffer, i == 2 ? T3_ATTR_BOLD : 0);
+		t3_win_addstr(line, "Ｑc̃", T3_ATTR_FG_RED);
+		ASSERT(t3_win_set_line(win, i, line));
+	}
+	/* The line window is left empty, so setting it again clears the line. */
+	ASSERT(t3_win_set_line(win, 3, line));
+	next();
+
+	/* Lines which don't fit, and windows which are not a single line, are rejected. */
+	t3_win_set_paint(line, 0, 25);
+	t3_win_addstr(line, "too long", 0);
+	ASSERT(!t3_win_set_line(win, 5, line));
+	ASSERT(!t3_win_set_line(win, 6, line));
+	ASSERT(!t3_win_set_line(win, 5, tall));
+	ASSERT(!t3_win_set_line(win, 5, win));
+	t3_win_set_paint(line, 0, 0);
+	t3_win_clrtoeol(line);
+	t3_win_addstr(line, "replaced", T3_ATTR_UNDERLINE);
+	ASSERT(t3_win_set_line(win, 5, line));
+	next();
+
+	return 0;
+}
@@ -0,0 +1,98 @@
+static int test(void) {
+	t3_window_t *win, *wide, *grid;
+	int i;
+
+	ASSERT(win = t3_win_new(NULL, 8, 30, 1, 2, 0));
+	t3_win_set_default_attrs(win, T3_ATTR_BG_BLUE);
+	t3_win_show(win);
+	t3_term_hide_cursor();
+
+	/* Gaps before and after existing text are filled with runs of spaces. */
+	t3_win_set_paint(win, 0, 10);
+	ASSERT(t3_win_addstr(win, "middle", 0) == T3_ERR_SUCCESS);
+	t3_win_set_paint(win, 0, 25);
+	ASSERT(t3_win_addstr(win, "end", T3_ATTR_BOLD) == T3_ERR_SUCCESS);
+	/* Writing into a run splits it. */
+	t3_win_set_paint(win, 0, 3);
+	ASSERT(t3_win_addstr(win, "x", 0) == T3_ERR_SUCCESS);
+	t3_win_set_paint(win, 0, 19);
+	ASSERT(t3_win_addstr(win, "\xe4\xb8\x80", 0) == T3_ERR_SUCCESS);
+	/* Runs of spaces written explicitly, with different attributes. */
+	t3_win_set_paint(win, 1, 0);
+	ASSERT(t3_win_addchrep(win, ' ', T3_ATTR_REVERSE, 12) == T3_ERR_SUCCESS);
+	ASSERT(t3_win_addchrep(win, ' ', 0, 5) == T3_ERR_SUCCESS);
+	ASSERT(t3_win_addchrep(win, ' ', T3_ATTR_BG_RED, 8) == T3_ERR_SUCCESS);
+	ASSERT(t3_win_addstr(win, "z", 0) == T3_ERR_SUCCESS);
+	/* Partially overwriting a double width character pads with a space. */
+	t3_win_set_paint(win, 2, 4);
+	ASSERT(t3_win_addstr(win, "\xef\xbc\xb1\xef\xbc\xb1\xef\xbc\xb1\xef\xbc\xb1", 0) == T3_ERR_SUCCESS);
+	t3_win_set_paint(win, 2, 7);
+	ASSERT(t3_win_addstr(win, "ab", T3_ATTR_UNDERLINE) == T3_ERR_SUCCESS);
+	/* Clearing to the end of the line, from inside a run and from inside a double width
+	   character. */
+	for (i = 3; i < 6; i++) {
+		t3_win_set_paint(win, i, 0);
+		ASSERT(t3_win_addstr(win, "abc", 0) == T3_ERR_SUCCESS);
+		t3_win_set_paint(win, i, 10);
+		ASSERT(t3_win_addstr(win, "\xef\xbc\xb1\xef\xbc\xb1" "def", 0) == T3_ERR_SUCCESS);
+	}
+	t3_win_set_paint(win, 3, 6);
+	t3_win_clrtoeol(win);
+	t3_win_set_paint(win, 4, 11);
+	t3_win_clrtoeol(win);
+	t3_win_set_paint(win, 5, 14);
+	t3_win_clrtoeol(win);
+	/* Zero-width characters added in a run are attached to a space. */
+	t3_win_set_paint(win, 6, 0);
+	ASSERT(t3_win_addchrep(win, ' ', 0, 10) == T3_ERR_SUCCESS);
+	ASSERT(t3_win_addstr(win, "w", 0) == T3_ERR_SUCCESS);
+	t3_win_set_paint(win, 6, 4);
+	ASSERT(t3_win_addstr(win, "\xcc\x83", 0) == T3_ERR_SUCCESS);
+	t3_win_set_paint(win, 6, 1);
+	ASSERT(t3_win_addstr(win, "q", 0) == T3_ERR_SUCCESS);
+	next();
+
+	/* A window wider than the terminal, of which only the middle is visible. */
+	ASSERT(wide = t3_win_new(NULL, 3, 300, 10, -100, 0));
+	t3_win_set_default_attrs(wide, T3_ATTR_BG_GREEN);
+	t3_win_show(wide);
+	for (i = 0; i < 3; i++) {
+		t3_win_set_paint(wide, i, 0);
+		ASSERT(t3_win_addstr(wide, "start", 0) == T3_ERR_SUCCESS);
+		t3_win_set_paint(wide, i, 110 + i * 20);
+		ASSERT(t3_win_addstr(wide, "text", 0) == T3_ERR_SUCCESS);
+		t3_win_set_paint(wide, i, 295);
+		ASSERT(t3_win_addstr(wide, "end", 0) == T3_ERR_SUCCESS);
+	}
+	next();
+
+	/* Runs in the rows of a grid. */
+	ASSERT(grid = t3_win_new_grid(NULL, 4, 30, 14, 2, 0));
+	t3_win_set_default_attrs(grid, T3_ATTR_BG_CYAN);
+	t3_win_show(grid);
+	t3_win_set_paint(grid, 0, 0);
+	ASSERT(t3_win_addstr(grid, "a", 0) == T3_ERR_SUCCESS);
+	t3_win_set_paint(grid, 0, 20);
+	ASSERT(t3_win_addstr(grid, "b", 0) == T3_ERR_SUCCESS);
+	t3_win_set_paint(grid, 1, 5);
+	ASSERT(t3_win_addchrep(grid, ' ', T3_ATTR_REVERSE, 10) == T3_ERR_SUCCESS);
+	t3_win_set_paint(grid, 2, 29);
+	ASSERT(t3_win_addstr(grid, "c", 0) == T3_ERR_SUCCESS);
+	t3_win_set_paint(grid, 3, 3);
+	ASSERT(t3_win_addstr(grid, "\xe4\xb8\x80", 0) == T3_ERR_SUCCESS);
+	next();
+
+	/* Changing the contents within runs updates only the changed cells. */
+	t3_win_set_paint(win, 0, 12);
+	ASSERT(t3_win_addstr(win, "D", 0) == T3_ERR_SUCCESS);
+	t3_win_set_paint(grid, 1, 8);
+	ASSERT(t3_win_addchrep(grid, ' ', T3_ATTR_BG_RED, 2) == T3_ERR_SUCCESS);
+	t3_win_set_paint(wide, 2, 148);
+	ASSERT(t3_win_addchrep(wide, ' ', T3_ATTR_BG_RED, 8) == T3_ERR_SUCCESS);
+	next();
+
+	t3_term_redraw();
+	next();
+
+	return 0;
+}
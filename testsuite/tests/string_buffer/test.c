@@ -0,0 +1,70 @@
+static int test(void) {
+	t3_window_t *win, *wide;
+	int i;
+
+	ASSERT(win = t3_win_new(NULL, 10, 16, 2, 2, 0));
+	t3_win_show(win);
+	t3_term_hide_cursor();
+
+	/* Mixed ASCII, double width and combining characters in a single string. */
+	ASSERT(t3_win_addstr(win, "a\xef\xbc\xb1" "b\xcc\x81\xcc\xa3" "cd\xe4\xb8\x80\xcc\x83" "e", 0) == T3_ERR_SUCCESS);
+	/* A zero-width character at the start of a string is added to the last character written. */
+	t3_win_set_paint(win, 1, 0);
+	ASSERT(t3_win_addstr(win, "xy", T3_ATTR_BOLD) == T3_ERR_SUCCESS);
+	ASSERT(t3_win_addstr(win, "\xcc\x83z", T3_ATTR_BOLD) == T3_ERR_SUCCESS);
+	/* A double width character which only partially fits at the right edge. */
+	t3_win_set_paint(win, 2, 0);
+	ASSERT(t3_win_addstr(win, "123456789abcdef\xef\xbc\xb1" "g", T3_ATTR_UNDERLINE) == T3_ERR_SUCCESS);
+	t3_win_set_paint(win, 3, 0);
+	ASSERT(t3_win_addstr(win, "123456789abcd\xef\xbc\xb1\xcc\x83" "ef", 0) == T3_ERR_SUCCESS);
+	/* Hangul Jamo sequences are followed by a zero-width non-joiner. */
+	t3_win_set_paint(win, 4, 0);
+	ASSERT(t3_win_addstr(win, "\xe1\x84\x80\xe1\x85\xa1" "a\xe1\x84\x80\xe1\x85\xa1\xe1\x86\xa8", 0) ==
+		T3_ERR_SUCCESS);
+	/* Writing over existing characters in the middle of a line. */
+	for (i = 5; i < 8; i++) {
+		t3_win_set_paint(win, i, 0);
+		ASSERT(t3_win_addstr(win, "\xef\xbc\xb1\xef\xbc\xb1\xef\xbc\xb1\xef\xbc\xb1\xef\xbc\xb1\xef\xbc\xb1\xef\xbc\xb1\xef\xbc\xb1", 0) ==
+			T3_ERR_SUCCESS);
+	}
+	next();
+
+	t3_win_set_paint(win, 5, 3);
+	ASSERT(t3_win_addstr(win, "ab\xe4\xb8\x80" "c", T3_ATTR_REVERSE) == T3_ERR_SUCCESS);
+	t3_win_set_paint(win, 6, 2);
+	ASSERT(t3_win_addstr(win, "\xe4\xb8\x80\xe4\xb8\x80", T3_ATTR_BOLD) == T3_ERR_SUCCESS);
+	t3_win_set_paint(win, 7, 1);
+	ASSERT(t3_win_addstr(win, "\xe4\xb8\x80\xcc\x83" "d\xe4\xb8\x80", T3_ATTR_BOLD) == T3_ERR_SUCCESS);
+	/* Strings written beyond the bottom of the window are dropped. */
+	t3_win_set_paint(win, 10, 0);
+	ASSERT(t3_win_addstr(win, "\xe4\xb8\x80" "abc", 0) == T3_ERR_SUCCESS);
+	next();
+
+	/* A string which does not fit in the buffer at once. Only the end of the window is
+	   visible. */
+	ASSERT(wide = t3_win_new(NULL, 2, 1200, 14, -1100, 0));
+	t3_win_show(wide);
+	for (i = 0; i < 2; i++) {
+		int j;
+		char str[4096];
+		size_t fill = 0;
+
+		for (j = 0; j < (i == 0 ? 1150 : 390); j++) {
+			if (i == 0) {
+				str[fill++] = 'a' + j % 26;
+				str[fill++] = '\xcc';
+				str[fill++] = '\x83';
+			} else {
+				str[fill++] = '\xe4';
+				str[fill++] = '\xb8';
+				str[fill++] = '\x80';
+				str[fill++] = 'a' + j % 26;
+			}
+		}
+		t3_win_set_paint(wide, i, 0);
+		ASSERT(t3_win_addnstr(wide, str, fill, i == 0 ? 0 : T3_ATTR_UNDERLINE) == T3_ERR_SUCCESS);
+	}
+	next();
+
+	return 0;
+}
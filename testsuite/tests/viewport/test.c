@@ -0,0 +1,56 @@
+static int test(void) {
+	t3_window_t *canvas, *view1, *view2, *tmp;
+	char buffer[32];
+	int i;
+
+	/* Use some attributes in a window which is deleted again, such that compacting
+	   the attributes renumbers the attributes used in the canvas. */
+	ASSERT(tmp = t3_win_new(NULL, 1, 10, 0, 0, 0));
+	t3_win_addstr(tmp, "a", T3_ATTR_FG_BLUE);
+	t3_win_addstr(tmp, "b", T3_ATTR_FG_YELLOW | T3_ATTR_UNDERLINE);
+
+	ASSERT(canvas = t3_win_new_canvas(1000, 500));
+	for (i = 0; i < 1000; i += 7) {
+		sprintf(buffer, "line %d", i);
+		t3_win_set_paint(canvas, i, i % 50);
+		t3_win_addstr(canvas, buffer, i % 2 ? T3_ATTR_FG_RED : 0);
+	}
+	t3_win_set_paint(canvas, 2, 10);
+	t3_win_addstr(canvas, "abＱc̃def", T3_ATTR_BOLD);
+
+	ASSERT(view1 = t3_win_new_viewport(NULL, 6, 30, 1, 2, 0, canvas));
+	ASSERT(view2 = t3_win_new_viewport(NULL, 6, 30, 10, 2, 0, canvas));
+	t3_win_set_viewport_offset(view2, 490, 20);
+	t3_win_show(view1);
+	t3_win_show(view2);
+	t3_term_hide_cursor();
+	next();
+
+	/* Cut the double width character at the left edge. */
+	t3_win_set_viewport_offset(view1, 0, 13);
+	ASSERT(t3_win_get_viewport_y(view1) == 0);
+	ASSERT(t3_win_get_viewport_x(view1) == 13);
+	next();
+
+	/* Parts outside the canvas are not drawn. */
+	t3_win_set_viewport_offset(view1, -2, -3);
+	t3_win_set_viewport_offset(view2, 996, 485);
+	next();
+
+	/* Drawing on the canvas shows in the viewports. */
+	t3_win_set_paint(canvas, 0, 0);
+	t3_win_addstr(canvas, "top", T3_ATTR_REVERSE);
+	t3_win_scroll(view2, -3);
+	next();
+
+	t3_win_del(tmp);
+	ASSERT(t3_term_compact_attrs() == T3_ERR_SUCCESS);
+	t3_win_set_paint(canvas, 1, 0);
+	t3_win_addstr(canvas, "magenta", T3_ATTR_FG_MAGENTA);
+	next();
+
+	t3_term_redraw();
+	next();
+
+	return 0;
+}
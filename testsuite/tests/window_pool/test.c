@@ -0,0 +1,39 @@
+static int test(void) {
+	t3_window_t *win, *reused, *other;
+	int i;
+
+	t3_win_set_pool_size(2);
+	ASSERT(win = t3_win_new(NULL, 6, 30, 2, 2, 0));
+	ASSERT(other = t3_win_new(NULL, 2, 30, 12, 2, 0));
+	t3_win_set_default_attrs(win, T3_ATTR_BG_BLUE);
+	t3_win_show(win);
+	t3_win_show(other);
+	t3_term_hide_cursor();
+	for (i = 0; i < 6; i++) {
+		t3_win_set_paint(win, i, i);
+		t3_win_addstr(win, "deleted window", T3_ATTR_BOLD);
+	}
+	t3_win_addstr(other, "other window", 0);
+	next();
+
+	/* A deleted window is reused for a new window of a different size, without any of its
+	   contents or settings. */
+	t3_win_del(win);
+	ASSERT((reused = t3_win_new(NULL, 4, 20, 3, 10, 0)) == win);
+	ASSERT(!t3_win_is_shown(reused));
+	t3_win_show(reused);
+	t3_win_set_paint(reused, 1, 0);
+	t3_win_addstr(reused, "reused window", 0);
+	next();
+
+	/* Windows are only reused from the pool. */
+	t3_win_del(reused);
+	t3_win_set_pool_size(0);
+	ASSERT(win = t3_win_new(NULL, 8, 20, 3, 10, 0));
+	t3_win_show(win);
+	t3_win_set_paint(win, 7, 0);
+	t3_win_addstr(win, "new window", 0);
+	next();
+
+	return 0;
+}